@@ -87,7 +87,13 @@ struct daos_eq_private {
 	struct d_hlink		eqx_hlink;
 	pthread_mutex_t		eqx_lock;
 	unsigned int		eqx_lock_init:1,
-				eqx_finalizing:1;
+				eqx_finalizing:1,
+				/* eqx_fd is readable, until the completed events are reaped */
+				eqx_fd_signaled:1;
+	/* eventfd of DAOS_EQ_FL_FD EQ, -1 otherwise */
+	int			eqx_fd;
+	/* Number of events completed since the EQ creation, never decreases */
+	uint64_t		eqx_comp_total;
 
 	/* CRT context associated with this eq */
 	crt_context_t		eqx_ctx;
@@ -13,6 +13,7 @@
  */
 #define D_LOGFAC	DD_FAC(client)
 
+#include <sys/eventfd.h>
 #include "client_internal.h"
 #include <daos/rpc.h>
 
@@ -170,6 +171,9 @@ daos_eq_free(struct d_hlink *hlink)
 	if (eqx->eqx_lock_init)
 		D_MUTEX_DESTROY(&eqx->eqx_lock);
 
+	if (eqx->eqx_fd >= 0)
+		close(eqx->eqx_fd);
+
 	D_FREE(eq);
 }
 
@@ -200,6 +204,7 @@ daos_eq_alloc(void)
 	eq->eq_n_comp = 0;
 
 	eqx = daos_eq2eqx(eq);
+	eqx->eqx_fd = -1;
 
 	rc = D_MUTEX_INIT(&eqx->eqx_lock, NULL);
 	if (rc != 0)
@@ -249,6 +254,40 @@ daos_eq_handle(struct daos_eq_private *eqx, daos_handle_t *h)
 	daos_hhash_link_key(&eqx->eqx_hlink, &h->cookie);
 }
 
+/*
+ * The EQ fd is written once when the first event completes, and read back when the
+ * last completed event is reaped, so completions don't cost a syscall each.
+ */
+static void
+daos_eq_fd_signal_locked(struct daos_eq_private *eqx)
+{
+	uint64_t	val = 1;
+
+	if (eqx->eqx_fd < 0 || eqx->eqx_fd_signaled)
+		return;
+
+	if (write(eqx->eqx_fd, &val, sizeof(val)) != sizeof(val)) {
+		D_ERROR("Failed to signal EQ fd %d: %d\n", eqx->eqx_fd, errno);
+		return;
+	}
+	eqx->eqx_fd_signaled = 1;
+}
+
+static void
+daos_eq_fd_drain_locked(struct daos_eq_private *eqx)
+{
+	uint64_t	val;
+
+	if (!eqx->eqx_fd_signaled || daos_eqx2eq(eqx)->eq_n_comp > 0)
+		return;
+
+	if (read(eqx->eqx_fd, &val, sizeof(val)) != sizeof(val)) {
+		D_ERROR("Failed to drain EQ fd %d: %d\n", eqx->eqx_fd, errno);
+		return;
+	}
+	eqx->eqx_fd_signaled = 0;
+}
+
 static void
 daos_event_launch_locked(struct daos_eq_private *eqx,
 			 struct daos_event_private *evx)
@@ -392,8 +431,10 @@ daos_event_complete_locked(struct daos_eq_private *eqx,
 		D_ASSERT(!d_list_empty(&evx->evx_link));
 		d_list_move_tail(&evx->evx_link, &eq->eq_comp);
 		eq->eq_n_comp++;
+		eqx->eqx_comp_total++;
 		D_ASSERT(eq->eq_n_running > 0);
 		eq->eq_n_running--;
+		daos_eq_fd_signal_locked(eqx);
 	}
 
 out:
@@ -570,6 +611,7 @@ ev_progress_cb(void *arg)
 		D_ASSERT(eq->eq_n_comp > 0);
 		eq->eq_n_comp--;
 		d_list_del_init(&evx->evx_link);
+		daos_eq_fd_drain_locked(eqx);
 	}
 	rc = 1;
 	D_ASSERT(evx->evx_status == DAOS_EVS_READY);
@@ -626,11 +668,20 @@ daos_event_test(struct daos_event *ev, int64_t timeout, bool *flag)
 
 int
 daos_eq_create(daos_handle_t *eqh)
+{
+	return daos_eq_create_ext(eqh, 0);
+}
+
+int
+daos_eq_create_ext(daos_handle_t *eqh, unsigned int flags)
 {
 	struct daos_eq_private	*eqx;
 	struct daos_eq		*eq;
 	int			rc = 0;
 
+	if (flags & ~DAOS_EQ_FL_FD)
+		return -DER_INVAL;
+
 	/** not thread-safe, but best effort */
 	D_MUTEX_LOCK(&daos_eq_lock);
 	if (eq_ref == 0) {
@@ -645,6 +696,16 @@ daos_eq_create(daos_handle_t *eqh)
 
 	eqx = daos_eq2eqx(eq);
 
+	if (flags & DAOS_EQ_FL_FD) {
+		eqx->eqx_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if (eqx->eqx_fd < 0) {
+			rc = daos_errno2der(errno);
+			D_ERROR("Failed to create EQ eventfd: "DF_RC"\n", DP_RC(rc));
+			daos_eq_free(&eqx->eqx_hlink);
+			return rc;
+		}
+	}
+
 	rc = crt_context_create(&eqx->eqx_ctx);
 	if (rc) {
 		D_WARN("Failed to create CART context; using the global one, "DF_RC"\n", DP_RC(rc));
@@ -668,20 +729,15 @@ struct eq_progress_arg {
 	int			  count;
 };
 
+/* Reap up to \a n_events completed events in one go */
 static int
-eq_progress_cb(void *arg)
+eq_reap_locked(struct daos_eq_private *eqx, unsigned int n_events, struct daos_event **events)
 {
-	struct eq_progress_arg		*epa = (struct eq_progress_arg  *)arg;
-	struct daos_event		*ev;
-	struct daos_eq			*eq;
+	struct daos_eq			*eq = daos_eqx2eq(eqx);
 	struct daos_event_private	*evx;
 	struct daos_event_private	*tmp;
+	int				 count = 0;
 
-	eq = daos_eqx2eq(epa->eqx);
-
-	tse_sched_progress(&epa->eqx->eqx_sched);
-
-	D_MUTEX_LOCK(&epa->eqx->eqx_lock);
 	d_list_for_each_entry_safe(evx, tmp, &eq->eq_comp, evx_link) {
 		D_ASSERT(eq->eq_n_comp > 0);
 
@@ -696,15 +752,31 @@ eq_progress_cb(void *arg)
 			 evx->evx_status == DAOS_EVS_ABORTED);
 		evx->evx_status = DAOS_EVS_READY;
 
-		if (epa->events != NULL) {
-			ev = daos_evx2ev(evx);
-			epa->events[epa->count++] = ev;
-		}
+		if (events != NULL)
+			events[count] = daos_evx2ev(evx);
+		count++;
 
-		D_ASSERT(epa->count <= epa->n_events);
-		if (epa->count == epa->n_events)
+		D_ASSERT(count <= n_events);
+		if (count == n_events)
 			break;
 	}
+	daos_eq_fd_drain_locked(eqx);
+
+	return count;
+}
+
+static int
+eq_progress_cb(void *arg)
+{
+	struct eq_progress_arg		*epa = (struct eq_progress_arg  *)arg;
+	struct daos_eq			*eq;
+
+	eq = daos_eqx2eq(epa->eqx);
+
+	tse_sched_progress(&epa->eqx->eqx_sched);
+
+	D_MUTEX_LOCK(&epa->eqx->eqx_lock);
+	epa->count = eq_reap_locked(epa->eqx, epa->n_events, epa->events);
 
 	/* exit once there are completion events */
 	if (epa->count > 0) {
@@ -768,6 +840,112 @@ daos_eq_poll(daos_handle_t eqh, int wait_running, int64_t timeout,
 	return epa.count;
 }
 
+int
+daos_eq_reap(daos_handle_t eqh, unsigned int n_events, struct daos_event **events)
+{
+	struct daos_eq_private	*eqx;
+	int			 count;
+
+	if (n_events == 0 || events == NULL)
+		return -DER_INVAL;
+
+	eqx = daos_eq_lookup(eqh);
+	if (eqx == NULL) {
+		D_ERROR("Invalid EQ handle %"PRIu64"\n", eqh.cookie);
+		return -DER_NONEXIST;
+	}
+
+	D_MUTEX_LOCK(&eqx->eqx_lock);
+	count = eq_reap_locked(eqx, n_events, events);
+	D_MUTEX_UNLOCK(&eqx->eqx_lock);
+
+	daos_eq_putref(eqx);
+	return count;
+}
+
+struct eq_progress_only_arg {
+	struct daos_eq_private	*eqx;
+	/* eqx_comp_total on entry */
+	uint64_t		 comp_total;
+};
+
+static int
+eq_progress_only_cb(void *arg)
+{
+	struct eq_progress_only_arg	*epa = arg;
+	struct daos_eq_private		*eqx = epa->eqx;
+	int				 rc;
+
+	tse_sched_progress(&eqx->eqx_sched);
+
+	D_MUTEX_LOCK(&eqx->eqx_lock);
+	if (eqx->eqx_finalizing)
+		rc = -DER_NONEXIST;
+	else
+		/* Stop once events completed during this call, the ones completed before may
+		 * not be reaped yet, that shouldn't make a waiting progress thread busy-spin.
+		 */
+		rc = eqx->eqx_comp_total != epa->comp_total ? 1 : 0;
+	D_MUTEX_UNLOCK(&eqx->eqx_lock);
+
+	return rc;
+}
+
+int
+daos_eq_progress(daos_handle_t eqh, int64_t timeout)
+{
+	struct eq_progress_only_arg	 epa;
+	struct daos_eq_private		*eqx;
+	int				 rc;
+
+	eqx = daos_eq_lookup(eqh);
+	if (eqx == NULL) {
+		D_ERROR("Invalid EQ handle %"PRIu64"\n", eqh.cookie);
+		return -DER_NONEXIST;
+	}
+
+	epa.eqx = eqx;
+	D_MUTEX_LOCK(&eqx->eqx_lock);
+	epa.comp_total = eqx->eqx_comp_total;
+	D_MUTEX_UNLOCK(&eqx->eqx_lock);
+
+	rc = crt_progress_cond(eqx->eqx_ctx, timeout, eq_progress_only_cb, &epa);
+	if (rc == 0 || rc == -DER_TIMEDOUT) {
+		D_MUTEX_LOCK(&eqx->eqx_lock);
+		rc = daos_eqx2eq(eqx)->eq_n_comp;
+		D_MUTEX_UNLOCK(&eqx->eqx_lock);
+	} else {
+		DL_ERROR(rc, "crt progress failed");
+	}
+
+	daos_eq_putref(eqx);
+	return rc;
+}
+
+int
+daos_eq_get_fd(daos_handle_t eqh, int *fd)
+{
+	struct daos_eq_private	*eqx;
+	int			 rc = 0;
+
+	if (fd == NULL)
+		return -DER_INVAL;
+
+	eqx = daos_eq_lookup(eqh);
+	if (eqx == NULL) {
+		D_ERROR("Invalid EQ handle %"PRIu64"\n", eqh.cookie);
+		return -DER_NONEXIST;
+	}
+
+	if (eqx->eqx_fd < 0)
+		rc = -DER_NOSYS;
+	else
+		*fd = eqx->eqx_fd;
+
+	daos_eq_putref(eqx);
+	return rc;
+}
+
 int
 daos_eq_query(daos_handle_t eqh, daos_eq_query_t query,
 	      unsigned int n_events, struct daos_event **events)
@@ -900,6 +1078,7 @@ daos_eq_destroy(daos_handle_t eqh, int flags)
 		D_ASSERT(eq->eq_n_comp > 0);
 		eq->eq_n_comp--;
 	}
+	daos_eq_fd_drain_locked(eqx);
 
 	tse_sched_complete(&eqx->eqx_sched, rc, true);
 
@@ -1154,6 +1333,7 @@ daos_event_fini(struct daos_event *ev)
 		if (evx->evx_status == DAOS_EVS_COMPLETED && eq != NULL) {
 			D_ASSERTF(eq->eq_n_comp > 0, "eq %p\n", eq);
 			eq->eq_n_comp--;
+			daos_eq_fd_drain_locked(eqx);
 		}
 	}
 
@@ -164,3 +164,39 @@ daos_kv_list(daos_handle_t oh, daos_handle_t th, uint32_t *nr,
 
 	return dc_task_schedule(task, true);
 }
+
+static int
+kv_multi(tse_task_func_t func, daos_handle_t oh, daos_handle_t th, uint64_t flags,
+	 unsigned int nr, daos_kv_req_t *reqs, daos_event_t *ev)
+{
+	daos_kv_multi_t	*args;
+	tse_task_t	*task;
+	int		 rc;
+
+	rc = dc_task_create(func, NULL, ev, &task);
+	if (rc)
+		return rc;
+
+	args = dc_task_get_args(task);
+	args->oh	= oh;
+	args->th	= th;
+	args->flags	= flags;
+	args->nr	= nr;
+	args->reqs	= reqs;
+
+	return dc_task_schedule(task, true);
+}
+
+int
+daos_kv_multi_put(daos_handle_t oh, daos_handle_t th, uint64_t flags, unsigned int nr,
+		  daos_kv_req_t *reqs, daos_event_t *ev)
+{
+	return kv_multi(dc_kv_multi_put, oh, th, flags, nr, reqs, ev);
+}
+
+int
+daos_kv_multi_get(daos_handle_t oh, daos_handle_t th, uint64_t flags, unsigned int nr,
+		  daos_kv_req_t *reqs, daos_event_t *ev)
+{
+	return kv_multi(dc_kv_multi_get, oh, th, flags, nr, reqs, ev);
+}
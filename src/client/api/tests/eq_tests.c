@@ -13,6 +13,7 @@
 #define D_LOGFAC	DD_FAC(tests)
 
 #include <pthread.h>
+#include <poll.h>
 #include <stdarg.h>
 #include <stdlib.h>
 #include <setjmp.h>
@@ -1237,6 +1238,141 @@ out:
 	DAOS_TEST_EXIT(rc);
 }
 
+static bool
+eq_fd_readable(int fd)
+{
+	struct pollfd	pfd = { .fd = fd, .events = POLLIN };
+
+	return poll(&pfd, 1, 0) == 1 && (pfd.revents & POLLIN);
+}
+
+#define EQ_FD_EV_NR	16
+/* 100ms */
+#define EQ_FD_PROGRESS_TIMEOUT	(100 * 1000)
+
+static void
+eq_test_11(void **state)
+{
+	struct daos_event	*events[EQ_FD_EV_NR] = { NULL };
+	struct daos_event	*eps[EQ_FD_EV_NR];
+	daos_handle_t		 eqh;
+	uint64_t		 start;
+	int			 fd;
+	int			 i;
+	int			 rc;
+
+	DAOS_TEST_ENTRY("11", "EQ eventfd and batched reaping");
+
+	rc = daos_eq_create_ext(&eqh, DAOS_EQ_FL_FD);
+	if (rc) {
+		print_error("daos_eq_create_ext() failed (%d)\n", rc);
+		goto out_nofree;
+	}
+
+	rc = daos_eq_get_fd(my_eqh, &fd);
+	if (rc != -DER_NOSYS) {
+		print_error("EQ without fd returned (%d)\n", rc);
+		rc = -DER_INVAL;
+		goto out;
+	}
+
+	rc = daos_eq_get_fd(eqh, &fd);
+	if (rc) {
+		print_error("daos_eq_get_fd() failed (%d)\n", rc);
+		goto out;
+	}
+
+	for (i = 0; i < EQ_FD_EV_NR; i++) {
+		D_ALLOC_PTR(events[i]);
+		if (events[i] == NULL) {
+			rc = -DER_NOMEM;
+			goto out;
+		}
+		rc = daos_event_init(events[i], eqh, NULL);
+		if (rc) {
+			print_error("daos_event_init() failed (%d)\n", rc);
+			goto out;
+		}
+		rc = daos_event_launch(events[i]);
+		if (rc) {
+			print_error("daos_event_launch() failed (%d)\n", rc);
+			goto out;
+		}
+	}
+
+	if (eq_fd_readable(fd)) {
+		print_error("EQ fd readable before any completion\n");
+		rc = -DER_INVAL;
+		goto out;
+	}
+
+	for (i = 0; i < EQ_FD_EV_NR; i++)
+		daos_event_complete(events[i], 0);
+
+	if (!eq_fd_readable(fd)) {
+		print_error("EQ fd not readable after completion\n");
+		rc = -DER_INVAL;
+		goto out;
+	}
+
+	/* events completed before the call don't stop the progress, it waits for new ones */
+	start = daos_get_ntime();
+	rc = daos_eq_progress(eqh, EQ_FD_PROGRESS_TIMEOUT);
+	if (rc != EQ_FD_EV_NR) {
+		print_error("daos_eq_progress() returned %d\n", rc);
+		rc = -DER_INVAL;
+		goto out;
+	}
+	if (daos_get_ntime() - start < EQ_FD_PROGRESS_TIMEOUT * NSEC_PER_USEC) {
+		print_error("daos_eq_progress() returned before the timeout\n");
+		rc = -DER_INVAL;
+		goto out;
+	}
+
+	/* a partial batch leaves the fd readable */
+	rc = daos_eq_reap(eqh, EQ_FD_EV_NR / 2, eps);
+	if (rc != EQ_FD_EV_NR / 2) {
+		print_error("daos_eq_reap() returned %d\n", rc);
+		rc = -DER_INVAL;
+		goto out;
+	}
+	if (!eq_fd_readable(fd)) {
+		print_error("EQ fd drained with events left to reap\n");
+		rc = -DER_INVAL;
+		goto out;
+	}
+
+	rc = daos_eq_reap(eqh, EQ_FD_EV_NR, eps);
+	if (rc != EQ_FD_EV_NR / 2) {
+		print_error("daos_eq_reap() returned %d\n", rc);
+		rc = -DER_INVAL;
+		goto out;
+	}
+	if (eq_fd_readable(fd)) {
+		print_error("EQ fd readable after reaping all events\n");
+		rc = -DER_INVAL;
+		goto out;
+	}
+
+	rc = daos_eq_progress(eqh, DAOS_EQ_NOWAIT);
+	if (rc != 0) {
+		print_error("daos_eq_progress() returned %d\n", rc);
+		rc = -DER_INVAL;
+		goto out;
+	}
+	rc = 0;
+out:
+	for (i = 0; i < EQ_FD_EV_NR; i++) {
+		if (events[i] == NULL)
+			break;
+		daos_event_fini(events[i]);
+		D_FREE(events[i]);
+	}
+	daos_eq_destroy(eqh, DAOS_EQ_DESTROY_FORCE);
+out_nofree:
+	DAOS_TEST_EXIT(rc);
+}
+
 static int
 eq_ut_setup(void **state)
 {
@@ -1292,7 +1428,8 @@ static const struct CMUnitTest eq_uts[] = {
 	{ "EQ_Test_7", eq_test_7, NULL, NULL},
 	{ "EQ_Test_8", eq_test_8, NULL, NULL},
 	{ "EQ_Test_9", eq_test_9, NULL, NULL},
-	{ "EQ_Test_10", eq_test_10, NULL, NULL}
+	{ "EQ_Test_10", eq_test_10, NULL, NULL},
+	{ "EQ_Test_11", eq_test_11, NULL, NULL}
 };
 
 int main(int argc, char **argv)
@@ -1409,6 +1409,304 @@ out:
 	return rc;
 }
 
+/*
+ * Create the fetch or update task of a dkey I/O and add it to \a io_task_list. A fetch of a byte
+ * array is a dependency of the short read task \a stask, other I/Os of the array task.
+ */
+static int
+create_io_task(struct dc_array *array, daos_handle_t th, daos_opc_t op_type,
+	       struct io_params *params, d_sg_list_t *sgl, tse_task_t *task, tse_task_t *stask,
+	       d_list_t *io_task_list)
+{
+	daos_handle_t	oh = array->daos_oh;
+	daos_iod_t	*iod = &params->iod;
+	daos_iom_t	*iom = &params->iom;
+	daos_key_t	*dkey = &params->dkey;
+	tse_task_t	*io_task = NULL;
+	int		rc;
+
+	/* Create the Fetch or Update task */
+	if (op_type == DAOS_OPC_ARRAY_READ) {
+		daos_obj_fetch_t *io_arg;
+
+		rc = daos_task_create(DAOS_OPC_OBJ_FETCH, tse_task2sched(task), 0, NULL, &io_task);
+		if (rc != 0) {
+			D_ERROR("Fetch dkey "DF_U64" failed "DF_RC"\n", params->dkey_val,
+				DP_RC(rc));
+			return rc;
+		}
+		io_arg = daos_task_get_args(io_task);
+		io_arg->oh	= oh;
+		io_arg->th	= th;
+		io_arg->dkey	= dkey;
+		io_arg->nr	= 1;
+		io_arg->iods	= iod;
+		io_arg->sgls	= sgl;
+
+		/** if this is a byte array, add ioms for hole mgmt */
+		if (array->byte_array) {
+			iom->iom_nr = 0;
+			iom->iom_recxs = NULL;
+			iom->iom_flags = DAOS_IOMF_DETAIL;
+			io_arg->ioms = iom;
+			rc = tse_task_register_deps(stask, 1, &io_task);
+		} else {
+			io_arg->ioms = NULL;
+			rc = tse_task_register_deps(task, 1, &io_task);
+		}
+	} else if (op_type == DAOS_OPC_ARRAY_WRITE || op_type == DAOS_OPC_ARRAY_PUNCH) {
+		daos_obj_update_t *io_arg;
+
+		rc = daos_task_create(DAOS_OPC_OBJ_UPDATE, tse_task2sched(task), 0, NULL, &io_task);
+		if (rc != 0) {
+			D_ERROR("Update dkey "DF_U64" failed "DF_RC"\n", params->dkey_val,
+				DP_RC(rc));
+			return rc;
+		}
+		io_arg = daos_task_get_args(io_task);
+		io_arg->oh	= oh;
+		io_arg->th	= th;
+		io_arg->dkey	= dkey;
+		io_arg->nr	= 1;
+		io_arg->iods	= iod;
+		io_arg->sgls	= sgl;
+		rc = tse_task_register_deps(task, 1, &io_task);
+	} else {
+		D_ASSERTF(0, "Invalid array operation.\n");
+		return -DER_INVAL;
+	}
+	if (rc) {
+		tse_task_complete(io_task, rc);
+		return rc;
+	}
+
+	tse_task_list_add(io_task, io_task_list);
+	return 0;
+}
+
+/** Part of a range of a list I/O that falls in a single dkey */
+struct io_seg {
+	uint64_t	dkey_val;
+	/** record index relative to the dkey */
+	daos_off_t	record_i;
+	daos_size_t	num_records;
+	/** position of the data of the segment in the user sgl */
+	daos_size_t	sgl_i;
+	daos_off_t	sgl_off;
+};
+
+static int
+io_seg_cmp(const void *a, const void *b)
+{
+	const struct io_seg *s1 = a;
+	const struct io_seg *s2 = b;
+
+	if (s1->dkey_val != s2->dkey_val)
+		return s1->dkey_val < s2->dkey_val ? -1 : 1;
+	if (s1->record_i != s2->record_i)
+		return s1->record_i < s2->record_i ? -1 : 1;
+	/** same records accessed twice, keep the order of the user buffer */
+	if (s1->sgl_i != s2->sgl_i)
+		return s1->sgl_i < s2->sgl_i ? -1 : 1;
+	if (s1->sgl_off != s2->sgl_off)
+		return s1->sgl_off < s2->sgl_off ? -1 : 1;
+	return 0;
+}
+
+/*
+ * Number of user sgl iovs the data of \a seg spans. If \a sgl is not NULL, also append them to
+ * it, merging with the last iov when the memory is contiguous.
+ */
+static daos_size_t
+io_seg_sgl(d_sg_list_t *user_sgl, daos_size_t cell_size, struct io_seg *seg, d_sg_list_t *sgl)
+{
+	daos_size_t	bytes = seg->num_records * cell_size;
+	daos_size_t	cur_i = seg->sgl_i;
+	daos_off_t	cur_off = seg->sgl_off;
+	daos_size_t	nr = 0;
+	daos_size_t	len;
+	d_iov_t		*last;
+	void		*buf;
+
+	while (bytes > 0) {
+		D_ASSERT(cur_i < user_sgl->sg_nr);
+		len = min(user_sgl->sg_iovs[cur_i].iov_len - cur_off, bytes);
+		buf = user_sgl->sg_iovs[cur_i].iov_buf + cur_off;
+		if (len > 0 && sgl != NULL) {
+			last = sgl->sg_nr > 0 ? &sgl->sg_iovs[sgl->sg_nr - 1] : NULL;
+			if (last != NULL && last->iov_buf + last->iov_len == buf) {
+				last->iov_len += len;
+				last->iov_buf_len = last->iov_len;
+			} else {
+				d_iov_set(&sgl->sg_iovs[sgl->sg_nr++], buf, len);
+			}
+		}
+		if (len > 0)
+			nr++;
+		bytes -= len;
+		cur_i++;
+		cur_off = 0;
+	}
+	return nr;
+}
+
+/*
+ * List I/O: split all the ranges at the dkey boundaries in one pass, then issue a single I/O
+ * per dkey with all the records it holds, whatever the order of the ranges. Strided accesses
+ * with many small ranges then cost one task per dkey instead of one per range or per run of
+ * increasing ranges, and the descriptors are allocated once instead of grown per record.
+ * Ranges that overlap within a dkey take one more I/O per overlap.
+ */
+static int
+array_list_io(struct dc_array *array, daos_handle_t th, daos_array_iod_t *rg_iod,
+	      d_sg_list_t *user_sgl, daos_opc_t op_type, tse_task_t *task, tse_task_t *stask,
+	      struct io_params **head, d_list_t *io_task_list)
+{
+	struct io_seg		*segs;
+	struct io_seg		*seg;
+	struct io_params	*params;
+	daos_size_t		nr_segs = 0;
+	daos_size_t		sgl_i = 0;
+	daos_off_t		sgl_off = 0;
+	daos_size_t		u, s, e, k;
+	int			rc = 0;
+
+	for (u = 0; u < rg_iod->arr_nr; u++) {
+		daos_off_t	idx = rg_iod->arr_rgs[u].rg_idx;
+		daos_size_t	len = rg_iod->arr_rgs[u].rg_len;
+
+		if (len != 0)
+			nr_segs += (idx + len - 1) / array->chunk_size -
+				   idx / array->chunk_size + 1;
+	}
+	if (nr_segs == 0)
+		return 0;
+
+	D_ALLOC_ARRAY(segs, nr_segs);
+	if (segs == NULL)
+		return -DER_NOMEM;
+
+	/** split the ranges in user order, to track where their data is in the user sgl */
+	k = 0;
+	for (u = 0; u < rg_iod->arr_nr; u++) {
+		daos_off_t	array_idx = rg_iod->arr_rgs[u].rg_idx;
+		daos_size_t	records = rg_iod->arr_rgs[u].rg_len;
+		daos_size_t	num_records;
+
+		while (records > 0) {
+			seg = &segs[k++];
+			compute_dkey(array, array_idx, &num_records, &seg->record_i,
+				     &seg->dkey_val);
+			seg->num_records = min(num_records, records);
+			seg->sgl_i = sgl_i;
+			seg->sgl_off = sgl_off;
+
+			array_idx += seg->num_records;
+			records -= seg->num_records;
+			if (user_sgl == NULL)
+				continue;
+
+			/** advance the user sgl position past the data of the segment */
+			num_records = seg->num_records * array->cell_size;
+			while (num_records > 0) {
+				daos_size_t avail;
+
+				D_ASSERT(sgl_i < user_sgl->sg_nr);
+				avail = user_sgl->sg_iovs[sgl_i].iov_len - sgl_off;
+				if (num_records < avail) {
+					sgl_off += num_records;
+					break;
+				}
+				num_records -= avail;
+				sgl_i++;
+				sgl_off = 0;
+			}
+		}
+	}
+	D_ASSERT(k == nr_segs);
+
+	qsort(segs, nr_segs, sizeof(*segs), io_seg_cmp);
+
+	for (s = 0; s < nr_segs; s = e) {
+		daos_size_t	dkey_records = 0;
+		daos_size_t	nr_iovs = 0;
+		daos_recx_t	*recx;
+		d_sg_list_t	*sgl;
+
+		/**
+		 * Repeated or overlapping ranges can't share an iod, which rejects overlapping
+		 * recxs. The segments are sorted by record, so the iod is cut at the first one
+		 * starting before the end of the previous ones, and the rest of the dkey goes
+		 * in another I/O.
+		 */
+		e = s + 1;
+		while (e < nr_segs && segs[e].dkey_val == segs[s].dkey_val &&
+		       segs[e].record_i >= segs[e - 1].record_i + segs[e - 1].num_records)
+			e++;
+
+		D_ALLOC_PTR(params);
+		if (params == NULL)
+			D_GOTO(out, rc = -DER_NOMEM);
+
+		/** dkeys are visited in increasing order, the list stays in non-increasing order */
+		params->dkey_val = segs[s].dkey_val;
+		params->next = *head;
+		*head = params;
+
+		params->akey_val	= '0';
+		params->cell_size	= array->cell_size;
+		params->chunk_size	= array->chunk_size;
+		d_iov_set(&params->dkey, &params->dkey_val, sizeof(uint64_t));
+		d_iov_set(&params->iod.iod_name, &params->akey_val, 1);
+		params->iod.iod_type	= DAOS_IOD_ARRAY;
+		params->iod.iod_size	= op_type == DAOS_OPC_ARRAY_PUNCH ? 0 : array->cell_size;
+		params->iom.iom_type	= DAOS_IOD_ARRAY;
+
+		D_ALLOC_ARRAY(params->iod.iod_recxs, e - s);
+		if (params->iod.iod_recxs == NULL)
+			D_GOTO(out, rc = -DER_NOMEM);
+
+		/** segments of consecutive records share a recx */
+		recx = NULL;
+		for (k = s; k < e; k++) {
+			if (recx != NULL && recx->rx_idx + recx->rx_nr == segs[k].record_i) {
+				recx->rx_nr += segs[k].num_records;
+			} else {
+				recx = &params->iod.iod_recxs[params->iod.iod_nr++];
+				recx->rx_idx = segs[k].record_i;
+				recx->rx_nr = segs[k].num_records;
+			}
+			dkey_records += segs[k].num_records;
+		}
+		params->num_records = dkey_records;
+
+		if (op_type == DAOS_OPC_ARRAY_PUNCH) {
+			sgl = user_sgl;
+			params->user_sgl_used = true;
+		} else {
+			sgl = &params->sgl;
+			for (k = s; k < e; k++)
+				nr_iovs += io_seg_sgl(user_sgl, array->cell_size, &segs[k], NULL);
+			D_ALLOC_ARRAY(sgl->sg_iovs, nr_iovs);
+			if (sgl->sg_iovs == NULL)
+				D_GOTO(out, rc = -DER_NOMEM);
+			for (k = s; k < e; k++)
+				io_seg_sgl(user_sgl, array->cell_size, &segs[k], sgl);
+		}
+
+		D_DEBUG(DB_IO, "DKEY IOD "DF_U64": %u recxs, %zu records\n", params->dkey_val,
+			params->iod.iod_nr, dkey_records);
+
+		rc = create_io_task(array, th, op_type, params, sgl, task, stask, io_task_list);
+		if (rc)
+			D_GOTO(out, rc);
+	}
+
+out:
+	D_FREE(segs);
+	return rc;
+}
+
 static int
 dc_array_io(daos_handle_t array_oh, daos_handle_t th,
 	    daos_array_iod_t *rg_iod, d_sg_list_t *user_sgl,
@@ -1428,7 +1726,7 @@ dc_array_io(daos_handle_t array_oh, daos_handle_t th,
 	daos_size_t	num_ios;
 	d_list_t	io_task_list;
 	daos_size_t	tot_num_records = 0;
-	tse_task_t	*stask; /* task for short read and hole mgmt */
+	tse_task_t	*stask = NULL; /* task for short read and hole mgmt */
 	int		rc;
 
 	if (rg_iod == NULL) {
@@ -1479,6 +1777,15 @@ dc_array_io(daos_handle_t array_oh, daos_handle_t th,
 			D_GOTO(err_task, rc);
 	}
 
+	/** many ranges, map them all at once and skip the per range loop below */
+	if (rg_iod->arr_nr > 1) {
+		rc = array_list_io(array, th, rg_iod, user_sgl, op_type, task, stask, &head,
+				   &io_task_list);
+		if (rc)
+			D_GOTO(err_iotask, rc);
+		u = rg_iod->arr_nr;
+	}
+
 	/*
 	 * Loop over every range, but at the same time combine consecutive
 	 * ranges that belong to the same dkey. If the user gives ranges that
@@ -1492,7 +1799,6 @@ dc_array_io(daos_handle_t array_oh, daos_handle_t th,
 		daos_key_t	*dkey;
 		uint64_t	dkey_val;
 		daos_size_t	dkey_records;
-		tse_task_t	*io_task = NULL;
 		struct io_params *params;
 		daos_size_t	i; /* index for iod recx */
 
@@ -1684,70 +1990,9 @@ dc_array_io(daos_handle_t array_oh, daos_handle_t th,
 		}
 		params->num_records = dkey_records;
 
-		/* Create the Fetch or Update task */
-		if (op_type == DAOS_OPC_ARRAY_READ) {
-			daos_obj_fetch_t *io_arg;
-
-			rc = daos_task_create(DAOS_OPC_OBJ_FETCH, tse_task2sched(task), 0, NULL,
-					      &io_task);
-			if (rc != 0) {
-				D_ERROR("Fetch dkey "DF_U64" failed "DF_RC"\n", params->dkey_val,
-					DP_RC(rc));
-				D_GOTO(err_iotask, rc);
-			}
-			io_arg = daos_task_get_args(io_task);
-			io_arg->oh	= oh;
-			io_arg->th	= th;
-			io_arg->dkey	= dkey;
-			io_arg->nr	= 1;
-			io_arg->iods	= iod;
-			io_arg->sgls	= sgl;
-
-			/** if this is a byte array, add ioms for hole mgmt */
-			if (array->byte_array) {
-				iom->iom_nr = 0;
-				iom->iom_recxs = NULL;
-				iom->iom_flags = DAOS_IOMF_DETAIL;
-				io_arg->ioms = iom;
-				rc = tse_task_register_deps(stask, 1, &io_task);
-				if (rc) {
-					tse_task_complete(io_task, rc);
-					D_GOTO(err_iotask, rc);
-				}
-			} else {
-				io_arg->ioms = NULL;
-				rc = tse_task_register_deps(task, 1, &io_task);
-				if (rc) {
-					tse_task_complete(io_task, rc);
-					D_GOTO(err_iotask, rc);
-				}
-			}
-		} else if (op_type == DAOS_OPC_ARRAY_WRITE || op_type == DAOS_OPC_ARRAY_PUNCH) {
-			daos_obj_update_t *io_arg;
-
-			rc = daos_task_create(DAOS_OPC_OBJ_UPDATE, tse_task2sched(task), 0, NULL,
-					      &io_task);
-			if (rc != 0) {
-				D_ERROR("Update dkey "DF_U64" failed "DF_RC"\n", params->dkey_val,
-					DP_RC(rc));
-				D_GOTO(err_iotask, rc);
-			}
-			io_arg = daos_task_get_args(io_task);
-			io_arg->oh	= oh;
-			io_arg->th	= th;
-			io_arg->dkey	= dkey;
-			io_arg->nr	= 1;
-			io_arg->iods	= iod;
-			io_arg->sgls	= sgl;
-			rc = tse_task_register_deps(task, 1, &io_task);
-			if (rc) {
-				tse_task_complete(io_task, rc);
-				D_GOTO(err_iotask, rc);
-			}
-		} else {
-			D_ASSERTF(0, "Invalid array operation.\n");
-		}
-		tse_task_list_add(io_task, &io_task_list);
+		rc = create_io_task(array, th, op_type, params, sgl, task, stask, &io_task_list);
+		if (rc)
+			D_GOTO(err_iotask, rc);
 	} /* end while */
 
 	rc = tse_task_register_comp_cb(task, free_io_params_cb, &head, sizeof(head));
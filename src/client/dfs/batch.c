@@ -0,0 +1,624 @@
+/**
+ * (C) Copyright 2024 Intel Corporation.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause-Patent
+ */
+
+/** DFS batched metadata ops on many entries of the same directory */
+
+#define D_LOGFAC DD_FAC(dfs)
+
+#include <daos/array.h>
+#include <daos/common.h>
+#include <daos/event.h>
+#include <daos/object.h>
+
+#include "dfs_internal.h"
+
+/*
+ * Object RPCs carry a single dkey, so each entry of a batch is still inserted, fetched or punched
+ * with its own RPC. The RPCs of a stage are all created up front and scheduled together under
+ * one task, so they are in flight to all the targets of the directory at the same time, and the
+ * caller waits on (or polls) a single event for the whole batch. Entries are independent: the
+ * result of each one is returned in its own errno slot, and an entry that failed a stage is
+ * skipped by the following ones.
+ */
+
+enum batch_op {
+	BATCH_CREATE,
+	BATCH_REMOVE,
+	BATCH_STAT,
+};
+
+struct batch_entry {
+	daos_key_t         dkey;
+	daos_iod_t         iod;
+	daos_recx_t        recx;
+	d_sg_list_t        sgl;
+	d_iov_t            sg_iovs[INODE_AKEYS];
+	struct dfs_entry   entry;
+	/** size and max epoch of the file, max epoch of the dir */
+	daos_array_stbuf_t stbuf;
+	/** file or dir object, open while it is punched or queried */
+	daos_handle_t      oh;
+	bool               is_array;
+	int                rc;
+};
+
+struct dfs_batch {
+	enum batch_op       op;
+	/** index of the next stage to run */
+	int                 stage;
+	dfs_t              *dfs;
+	dfs_obj_t          *parent;
+	uint32_t            nr;
+	struct batch_entry *entries;
+	int                *rcs;
+	struct stat        *stbufs;
+};
+
+struct dfs_batch_args {
+	struct dfs_batch *batch;
+};
+
+typedef int (*batch_stage_t)(tse_task_t *task, struct dfs_batch *batch, d_list_t *io_list);
+
+static void
+batch_entry_close(struct batch_entry *be)
+{
+	if (daos_handle_is_inval(be->oh))
+		return;
+
+	if (be->is_array)
+		daos_array_close(be->oh, NULL);
+	else
+		daos_obj_close(be->oh, NULL);
+	be->oh = DAOS_HDL_INVAL;
+}
+
+static int
+batch_entry_cb(tse_task_t *task, void *data)
+{
+	struct batch_entry *be = *((struct batch_entry **)data);
+	int                 rc = task->dt_result;
+
+	batch_entry_close(be);
+
+	if (rc == -DER_NONEXIST)
+		be->rc = ENOENT;
+	else if (rc)
+		be->rc = daos_der2errno(rc);
+
+	/** reported for this entry only, don't fail the batch */
+	task->dt_result = 0;
+	return 0;
+}
+
+static int
+batch_io_task(tse_task_t *task, daos_opc_t opc, struct batch_entry *be, d_list_t *io_list,
+	      void **args)
+{
+	tse_task_t *io_task;
+	int         rc;
+
+	rc = daos_task_create(opc, tse_task2sched(task), 0, NULL, &io_task);
+	if (rc)
+		return rc;
+
+	rc = tse_task_register_comp_cb(io_task, batch_entry_cb, &be, sizeof(be));
+	if (rc) {
+		tse_task_complete(io_task, rc);
+		return rc;
+	}
+
+	tse_task_list_add(io_task, io_list);
+	*args = daos_task_get_args(io_task);
+	return 0;
+}
+
+static int
+batch_rw(tse_task_t *task, struct dfs_batch *batch, d_list_t *io_list)
+{
+	bool     insert = batch->op == BATCH_CREATE;
+	uint32_t i;
+	int      rc;
+
+	for (i = 0; i < batch->nr; i++) {
+		struct batch_entry *be = &batch->entries[i];
+		daos_obj_rw_t      *args;
+
+		if (be->rc)
+			continue;
+
+		rc = batch_io_task(task, insert ? DAOS_OPC_OBJ_UPDATE : DAOS_OPC_OBJ_FETCH, be,
+				   io_list, (void **)&args);
+		if (rc)
+			return rc;
+
+		args->oh    = batch->parent->oh;
+		args->th    = DAOS_TX_NONE;
+		args->flags = insert ? DAOS_COND_DKEY_INSERT : DAOS_COND_DKEY_FETCH;
+		args->dkey  = &be->dkey;
+		args->nr    = 1;
+		args->iods  = &be->iod;
+		args->sgls  = &be->sgl;
+	}
+	return 0;
+}
+
+/** entries fetched by the previous stage, that were not found */
+static bool
+batch_entry_missing(struct batch_entry *be)
+{
+	if (be->rc == 0 && be->sgl.sg_nr_out == 0)
+		be->rc = ENOENT;
+	return be->rc != 0;
+}
+
+static int
+batch_punch_obj(tse_task_t *task, struct dfs_batch *batch, d_list_t *io_list)
+{
+	uint32_t i;
+	int      rc;
+
+	for (i = 0; i < batch->nr; i++) {
+		struct batch_entry *be = &batch->entries[i];
+		daos_obj_punch_t   *args;
+
+		if (batch_entry_missing(be))
+			continue;
+
+		/** directories are removed with dfs_remove(), to check or remove their content */
+		if (S_ISDIR(be->entry.mode)) {
+			be->rc = EISDIR;
+			continue;
+		}
+		if (S_ISLNK(be->entry.mode))
+			continue;
+
+		rc = daos_obj_open(batch->dfs->coh, be->entry.oid, DAOS_OO_RW, &be->oh, NULL);
+		if (rc) {
+			be->rc = daos_der2errno(rc);
+			continue;
+		}
+
+		rc = batch_io_task(task, DAOS_OPC_OBJ_PUNCH, be, io_list, (void **)&args);
+		if (rc) {
+			batch_entry_close(be);
+			return rc;
+		}
+
+		args->oh    = be->oh;
+		args->th    = DAOS_TX_NONE;
+		args->flags = 0;
+	}
+	return 0;
+}
+
+static int
+batch_punch_entry(tse_task_t *task, struct dfs_batch *batch, d_list_t *io_list)
+{
+	uint32_t i;
+	int      rc;
+
+	for (i = 0; i < batch->nr; i++) {
+		struct batch_entry *be = &batch->entries[i];
+		daos_obj_punch_t   *args;
+
+		if (be->rc)
+			continue;
+
+		rc = batch_io_task(task, DAOS_OPC_OBJ_PUNCH_DKEYS, be, io_list, (void **)&args);
+		if (rc)
+			return rc;
+
+		args->oh    = batch->parent->oh;
+		args->th    = DAOS_TX_NONE;
+		args->flags = DAOS_COND_PUNCH;
+		args->dkey  = &be->dkey;
+	}
+	return 0;
+}
+
+static int
+batch_query(tse_task_t *task, struct dfs_batch *batch, d_list_t *io_list)
+{
+	dfs_t   *dfs = batch->dfs;
+	uint32_t i;
+	int      rc;
+
+	for (i = 0; i < batch->nr; i++) {
+		struct batch_entry *be = &batch->entries[i];
+
+		if (batch_entry_missing(be))
+			continue;
+
+		if (S_ISREG(be->entry.mode)) {
+			daos_array_stat_t *args;
+
+			rc = daos_array_open_with_attr(dfs->coh, be->entry.oid, DAOS_TX_NONE,
+						       DAOS_OO_RO, 1,
+						       be->entry.chunk_size ? be->entry.chunk_size
+									    : dfs->attr.da_chunk_size,
+						       &be->oh, NULL);
+			if (rc) {
+				be->rc = daos_der2errno(rc);
+				continue;
+			}
+			be->is_array = true;
+
+			rc = batch_io_task(task, DAOS_OPC_ARRAY_STAT, be, io_list, (void **)&args);
+			if (rc) {
+				batch_entry_close(be);
+				return rc;
+			}
+
+			args->oh    = be->oh;
+			args->th    = DAOS_TX_NONE;
+			args->stbuf = &be->stbuf;
+		} else if (S_ISDIR(be->entry.mode)) {
+			daos_obj_query_key_t *args;
+
+			rc = daos_obj_open(dfs->coh, be->entry.oid, DAOS_OO_RO, &be->oh, NULL);
+			if (rc) {
+				be->rc = daos_der2errno(rc);
+				continue;
+			}
+
+			rc = batch_io_task(task, DAOS_OPC_OBJ_QUERY_KEY, be, io_list,
+					   (void **)&args);
+			if (rc) {
+				batch_entry_close(be);
+				return rc;
+			}
+
+			args->oh        = be->oh;
+			args->th        = DAOS_TX_NONE;
+			args->flags     = 0;
+			args->max_epoch = &be->stbuf.st_max_epoch;
+		}
+	}
+	return 0;
+}
+
+static batch_stage_t batch_stages[][4] = {
+    [BATCH_CREATE] = {batch_rw, NULL},
+    [BATCH_REMOVE] = {batch_rw, batch_punch_obj, batch_punch_entry, NULL},
+    [BATCH_STAT]   = {batch_rw, batch_query, NULL},
+};
+
+static int
+batch_run_stage(tse_task_t *task, struct dfs_batch *batch);
+
+static int
+batch_stage_task(tse_task_t *task)
+{
+	return batch_run_stage(task, tse_task_get_priv(task));
+}
+
+/*
+ * Run the current stage: its I/O tasks are scheduled together, and the next stage is a task that
+ * depends on all of them. The task of each stage completes with the next one.
+ */
+static int
+batch_run_stage(tse_task_t *task, struct dfs_batch *batch)
+{
+	batch_stage_t stage = batch_stages[batch->op][batch->stage++];
+	tse_task_t   *next  = NULL;
+	d_list_t      io_list;
+	int           rc;
+
+	D_INIT_LIST_HEAD(&io_list);
+
+	rc = stage(task, batch, &io_list);
+	if (rc)
+		D_GOTO(err, rc);
+
+	if (batch_stages[batch->op][batch->stage] != NULL) {
+		rc = tse_task_create(batch_stage_task, tse_task2sched(task), batch, &next);
+		if (rc)
+			D_GOTO(err, rc);
+
+		rc = tse_task_depend_list(next, &io_list);
+		if (rc == 0)
+			rc = tse_task_register_deps(task, 1, &next);
+		if (rc) {
+			tse_task_complete(next, rc);
+			D_GOTO(err, rc);
+		}
+	} else if (!d_list_empty(&io_list)) {
+		rc = tse_task_depend_list(task, &io_list);
+		if (rc)
+			D_GOTO(err, rc);
+	} else {
+		tse_task_complete(task, 0);
+		return 0;
+	}
+
+	tse_task_list_sched(&io_list, true);
+	if (next)
+		tse_task_schedule(next, true);
+	return 0;
+
+err:
+	tse_task_list_abort(&io_list, rc);
+	tse_task_complete(task, rc);
+	return rc;
+}
+
+static int
+batch_task(tse_task_t *task)
+{
+	struct dfs_batch_args *args = dc_task_get_args(task);
+
+	return batch_run_stage(task, args->batch);
+}
+
+static void
+batch_stat_fill(struct dfs_batch *batch, struct batch_entry *be, struct stat *stbuf)
+{
+	struct dfs_entry *entry = &be->entry;
+	int               rc    = 0;
+
+	memset(stbuf, 0, sizeof(*stbuf));
+
+	switch (entry->mode & S_IFMT) {
+	case S_IFDIR:
+		stbuf->st_size = sizeof(*entry);
+		rc             = update_stbuf_times(*entry, be->stbuf.st_max_epoch, stbuf, NULL);
+		break;
+	case S_IFREG:
+		stbuf->st_blksize = entry->chunk_size ? entry->chunk_size
+						      : batch->dfs->attr.da_chunk_size;
+		stbuf->st_size    = be->stbuf.st_size;
+		stbuf->st_blocks  = (stbuf->st_size + (1 << 9) - 1) >> 9;
+		rc                = update_stbuf_times(*entry, be->stbuf.st_max_epoch, stbuf, NULL);
+		break;
+	case S_IFLNK:
+		stbuf->st_size         = entry->value_len;
+		stbuf->st_mtim.tv_sec  = entry->mtime;
+		stbuf->st_mtim.tv_nsec = entry->mtime_nano;
+		stbuf->st_ctim.tv_sec  = entry->ctime;
+		stbuf->st_ctim.tv_nsec = entry->ctime_nano;
+		break;
+	default:
+		D_ERROR("Invalid entry type (not a dir, file, symlink).\n");
+		rc = EINVAL;
+	}
+	if (rc) {
+		be->rc = rc;
+		return;
+	}
+
+	stbuf->st_nlink = 1;
+	stbuf->st_mode  = entry->mode;
+	stbuf->st_uid   = entry->uid;
+	stbuf->st_gid   = entry->gid;
+	if (tspec_gt(stbuf->st_ctim, stbuf->st_mtim)) {
+		stbuf->st_atim.tv_sec  = stbuf->st_ctim.tv_sec;
+		stbuf->st_atim.tv_nsec = stbuf->st_ctim.tv_nsec;
+	} else {
+		stbuf->st_atim.tv_sec  = stbuf->st_mtim.tv_sec;
+		stbuf->st_atim.tv_nsec = stbuf->st_mtim.tv_nsec;
+	}
+}
+
+static void
+batch_free(struct dfs_batch *batch)
+{
+	D_FREE(batch->entries);
+	D_FREE(batch);
+}
+
+static int
+batch_comp_cb(tse_task_t *task, void *data)
+{
+	struct dfs_batch *batch = *((struct dfs_batch **)data);
+	uint32_t          i;
+
+	for (i = 0; i < batch->nr; i++) {
+		struct batch_entry *be = &batch->entries[i];
+
+		/** the batch failed before this entry was done */
+		if (be->rc == 0 && task->dt_result != 0)
+			be->rc = daos_der2errno(task->dt_result);
+
+		if (batch->op == BATCH_CREATE && be->dkey.iov_buf != NULL)
+			dfs_ncache_del(batch->dfs, batch->parent->oid, be->dkey.iov_buf,
+				       be->dkey.iov_len);
+		else if (batch->op == BATCH_STAT && be->rc == 0)
+			batch_stat_fill(batch, be, &batch->stbufs[i]);
+
+		batch->rcs[i] = be->rc;
+	}
+
+	batch_free(batch);
+	return 0;
+}
+
+static int
+batch_alloc(dfs_t *dfs, dfs_obj_t *parent, enum batch_op op, uint32_t nr, const char **names,
+	    int *rcs, struct dfs_batch **_batch)
+{
+	struct dfs_batch *batch;
+	uint32_t          i;
+
+	if (dfs == NULL || !dfs->mounted)
+		return EINVAL;
+	if (op != BATCH_STAT && dfs->amode != O_RDWR)
+		return EPERM;
+	if (parent == NULL)
+		parent = &dfs->root;
+	else if (!S_ISDIR(parent->mode))
+		return ENOTDIR;
+	if (nr == 0 || names == NULL || rcs == NULL)
+		return EINVAL;
+
+	D_ALLOC_PTR(batch);
+	if (batch == NULL)
+		return ENOMEM;
+
+	D_ALLOC_ARRAY(batch->entries, nr);
+	if (batch->entries == NULL) {
+		D_FREE(batch);
+		return ENOMEM;
+	}
+
+	batch->op     = op;
+	batch->dfs    = dfs;
+	batch->parent = parent;
+	batch->nr     = nr;
+	batch->rcs    = rcs;
+
+	for (i = 0; i < nr; i++) {
+		struct batch_entry *be    = &batch->entries[i];
+		struct dfs_entry   *entry = &be->entry;
+		unsigned int        j     = 0;
+		size_t              len;
+
+		be->oh = DAOS_HDL_INVAL;
+		be->rc = check_name(names[i], &len);
+		if (be->rc)
+			continue;
+
+		d_iov_set(&be->dkey, (void *)names[i], len);
+		d_iov_set(&be->iod.iod_name, INODE_AKEY_NAME, sizeof(INODE_AKEY_NAME) - 1);
+		be->iod.iod_nr    = 1;
+		be->recx.rx_idx   = 0;
+		be->recx.rx_nr    = END_IDX;
+		be->iod.iod_recxs = &be->recx;
+		be->iod.iod_type  = DAOS_IOD_ARRAY;
+		be->iod.iod_size  = 1;
+
+		d_iov_set(&be->sg_iovs[j++], &entry->mode, sizeof(mode_t));
+		d_iov_set(&be->sg_iovs[j++], &entry->oid, sizeof(daos_obj_id_t));
+		d_iov_set(&be->sg_iovs[j++], &entry->mtime, sizeof(uint64_t));
+		d_iov_set(&be->sg_iovs[j++], &entry->ctime, sizeof(uint64_t));
+		d_iov_set(&be->sg_iovs[j++], &entry->chunk_size, sizeof(daos_size_t));
+		d_iov_set(&be->sg_iovs[j++], &entry->oclass, sizeof(daos_oclass_id_t));
+		d_iov_set(&be->sg_iovs[j++], &entry->mtime_nano, sizeof(uint64_t));
+		d_iov_set(&be->sg_iovs[j++], &entry->ctime_nano, sizeof(uint64_t));
+		d_iov_set(&be->sg_iovs[j++], &entry->uid, sizeof(uid_t));
+		d_iov_set(&be->sg_iovs[j++], &entry->gid, sizeof(gid_t));
+		d_iov_set(&be->sg_iovs[j++], &entry->value_len, sizeof(daos_size_t));
+		d_iov_set(&be->sg_iovs[j++], &entry->obj_hlc, sizeof(uint64_t));
+		be->sgl.sg_nr     = j;
+		be->sgl.sg_nr_out = 0;
+		be->sgl.sg_iovs   = be->sg_iovs;
+	}
+
+	*_batch = batch;
+	return 0;
+}
+
+static int
+batch_launch(struct dfs_batch *batch, daos_event_t *ev)
+{
+	struct dfs_batch_args *args;
+	tse_task_t            *task;
+	int                    rc;
+
+	rc = dc_task_create(batch_task, NULL, ev, &task);
+	if (rc) {
+		batch_free(batch);
+		return daos_der2errno(rc);
+	}
+	if (ev)
+		daos_event_errno_rc(ev);
+
+	args        = dc_task_get_args(task);
+	args->batch = batch;
+
+	/** rcs are set and the batch is freed there, whatever the result */
+	rc = tse_task_register_comp_cb(task, batch_comp_cb, &batch, sizeof(batch));
+	if (rc) {
+		batch_free(batch);
+		tse_task_complete(task, rc);
+		return daos_der2errno(rc);
+	}
+
+	rc = dc_task_schedule(task, true);
+	return daos_der2errno(rc);
+}
+
+int
+dfs_create_batch(dfs_t *dfs, dfs_obj_t *parent, uint32_t nr, const char **names, mode_t mode,
+		 daos_oclass_id_t cid, daos_size_t chunk_size, int *rcs, daos_event_t *ev)
+{
+	struct dfs_batch *batch;
+	struct timespec   now;
+	uint32_t          i;
+	int               rc;
+
+	if ((mode & S_IFMT) != 0 && !S_ISREG(mode))
+		return EINVAL;
+
+	rc = batch_alloc(dfs, parent, BATCH_CREATE, nr, names, rcs, &batch);
+	if (rc)
+		return rc;
+	parent = batch->parent;
+
+	/** same defaults as dfs_open() */
+	if (cid == 0)
+		cid = parent->d.oclass ? parent->d.oclass : dfs->attr.da_file_oclass_id;
+	if (chunk_size == 0)
+		chunk_size = parent->d.chunk_size ? parent->d.chunk_size : dfs->attr.da_chunk_size;
+
+	rc = clock_gettime(CLOCK_REALTIME, &now);
+	if (rc) {
+		batch_free(batch);
+		return errno;
+	}
+
+	for (i = 0; i < nr; i++) {
+		struct batch_entry *be = &batch->entries[i];
+
+		if (be->rc)
+			continue;
+
+		be->rc = oid_gen(dfs, cid, true, &be->entry.oid);
+		if (be->rc)
+			continue;
+
+		be->entry.mode       = S_IFREG | mode;
+		be->entry.chunk_size = chunk_size;
+		be->entry.uid        = geteuid();
+		be->entry.gid        = getegid();
+		be->entry.mtime = be->entry.ctime = now.tv_sec;
+		be->entry.mtime_nano = be->entry.ctime_nano = now.tv_nsec;
+	}
+
+	return batch_launch(batch, ev);
+}
+
+int
+dfs_remove_batch(dfs_t *dfs, dfs_obj_t *parent, uint32_t nr, const char **names, int *rcs,
+		 daos_event_t *ev)
+{
+	struct dfs_batch *batch;
+	int               rc;
+
+	rc = batch_alloc(dfs, parent, BATCH_REMOVE, nr, names, rcs, &batch);
+	if (rc)
+		return rc;
+
+	return batch_launch(batch, ev);
+}
+
+int
+dfs_stat_batch(dfs_t *dfs, dfs_obj_t *parent, uint32_t nr, const char **names,
+	       struct stat *stbufs, int *rcs, daos_event_t *ev)
+{
+	struct dfs_batch *batch;
+	int               rc;
+
+	if (stbufs == NULL)
+		return EINVAL;
+
+	rc = batch_alloc(dfs, parent, BATCH_STAT, nr, names, rcs, &batch);
+	if (rc)
+		return rc;
+	batch->stbufs = stbufs;
+
+	return batch_launch(batch, ev);
+}
@@ -698,6 +698,7 @@ open_dir(dfs_t *dfs, dfs_obj_t *parent, int flags, daos_oclass_id_t cid, struct
 		/** since it's a single conditional op, we don't need a DTX */
 		rc = insert_entry(dfs->layout_v, parent->oh, DAOS_TX_NONE, dir->name, len,
 				  DAOS_COND_DKEY_INSERT, entry);
+		dfs_ncache_del(dfs, parent->oid, dir->name, len);
 		if (rc == EEXIST && !oexcl) {
 			/** just try fetching entry to open the file */
 			daos_obj_close(dir->oh, NULL);
@@ -929,6 +929,7 @@ dfs_cont_check(daos_handle_t poh, const char *cont, uint64_t flags, const char *
 				D_ERROR("Failed to insert leaked entry in l+f (%d)\n", rc);
 				D_GOTO(out_lf2, rc);
 			}
+			dfs_ncache_del(dfs, now_dir->oid, oid_name, len);
 			unmarked_entries++;
 		}
 	}
@@ -185,6 +185,8 @@ struct dfs {
 	struct dfs_mnt_hdls *cont_hdl;
 	/** the root dir stat buf */
 	struct stat          root_stbuf;
+	/** negative entry cache, NULL if disabled */
+	struct dfs_ncache   *ncache;
 };
 
 struct dfs_entry {
@@ -416,4 +418,16 @@ update_stbuf_times(struct dfs_entry entry, daos_epoch_t max_epoch, struct stat *
 int
 lookup_rel_path(dfs_t *dfs, dfs_obj_t *root, const char *path, int flags, dfs_obj_t **_obj,
 		mode_t *mode, struct stat *stbuf, size_t depth);
+int
+dfs_ncache_init(dfs_t *dfs);
+void
+dfs_ncache_fini(dfs_t *dfs);
+uint64_t
+dfs_ncache_gen(dfs_t *dfs);
+bool
+dfs_ncache_lookup(dfs_t *dfs, daos_obj_id_t parent, const char *name, size_t len);
+void
+dfs_ncache_add(dfs_t *dfs, daos_obj_id_t parent, const char *name, size_t len, uint64_t gen);
+void
+dfs_ncache_del(dfs_t *dfs, daos_obj_id_t parent, const char *name, size_t len);
 #endif /* __DFS_INTERNAL_H__ */
@@ -56,6 +56,7 @@ dfs_mkdir(dfs_t *dfs, dfs_obj_t *parent, const char *name, mode_t mode, daos_ocl
 	entry.gid                           = getegid();
 
 	rc = insert_entry(dfs->layout_v, parent->oh, th, name, len, DAOS_COND_DKEY_INSERT, &entry);
+	dfs_ncache_del(dfs, parent->oid, name, len);
 	if (rc != 0) {
 		daos_obj_close(new_dir.oh, NULL);
 		return rc;
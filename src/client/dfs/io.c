@@ -282,3 +282,227 @@ dfs_writex(dfs_t *dfs, dfs_obj_t *obj, dfs_iod_t *iod, d_sg_list_t *sgl, daos_ev
 
 	return daos_der2errno(rc);
 }
+
+/** Number of chunk copies in flight in dfs_copy_range() */
+#define DFS_COPY_DEPTH    8
+/** Buffer size of a copy in flight, larger chunks are copied in several pieces */
+#define DFS_COPY_SLOT_MAX (16ULL << 20)
+
+enum {
+	COPY_IDLE = 0,
+	COPY_READ,
+	COPY_WRITE,
+	COPY_DONE,
+};
+
+struct copy_slot {
+	daos_event_t cs_ev;
+	d_iov_t      cs_iov;
+	d_sg_list_t  cs_sgl;
+	/** offset of the chunk from the start of the range */
+	daos_off_t   cs_off;
+	/** bytes requested, then bytes read */
+	daos_size_t  cs_len;
+	int          cs_state;
+};
+
+struct copy_args {
+	dfs_t      *src_dfs;
+	dfs_obj_t  *src;
+	daos_off_t  src_off;
+	dfs_t      *dst_dfs;
+	dfs_obj_t  *dst;
+	daos_off_t  dst_off;
+	/** end of the range, lowered if the source turns out to be shorter */
+	daos_size_t len;
+};
+
+/* Move a slot whose event completed to its next state, the write of a chunk follows its read */
+static int
+copy_slot_next(struct copy_args *ca, struct copy_slot *slot)
+{
+	int rc = slot->cs_ev.ev_error;
+
+	if (rc != 0)
+		return daos_der2errno(rc);
+
+	if (slot->cs_state == COPY_WRITE) {
+		slot->cs_state = COPY_DONE;
+		return 0;
+	}
+
+	/** a short read means the source shrank, nothing to copy after it */
+	if (slot->cs_len < slot->cs_iov.iov_len)
+		ca->len = min(ca->len, slot->cs_off + slot->cs_len);
+	if (slot->cs_len == 0) {
+		slot->cs_state = COPY_DONE;
+		return 0;
+	}
+
+	slot->cs_iov.iov_len = slot->cs_len;
+	slot->cs_state       = COPY_WRITE;
+	return dfs_write(ca->dst_dfs, ca->dst, &slot->cs_sgl, ca->dst_off + slot->cs_off,
+			 &slot->cs_ev);
+}
+
+int
+dfs_copy_range(dfs_t *src_dfs, dfs_obj_t *src, daos_off_t src_off, dfs_t *dst_dfs,
+	       dfs_obj_t *dst, daos_off_t dst_off, daos_size_t len, daos_size_t *copied)
+{
+	struct copy_args  ca;
+	struct copy_slot *slots;
+	struct copy_slot *slot;
+	daos_size_t       chunk_size;
+	daos_size_t       slot_size;
+	daos_size_t       cell_size;
+	daos_size_t       src_size;
+	daos_size_t       pos = 0;
+	daos_size_t       done = 0;
+	uint32_t          head = 0;
+	uint32_t          inflight = 0;
+	uint32_t          i;
+	bool              flag;
+	int               rc, rc2;
+
+	if (src_dfs == NULL || !src_dfs->mounted || dst_dfs == NULL || !dst_dfs->mounted)
+		return EINVAL;
+	if (dst_dfs->amode != O_RDWR)
+		return EPERM;
+	if (src == NULL || !S_ISREG(src->mode) || dst == NULL || !S_ISREG(dst->mode))
+		return EINVAL;
+	if ((src->flags & O_ACCMODE) == O_WRONLY || (dst->flags & O_ACCMODE) == O_RDONLY)
+		return EPERM;
+	if (copied == NULL)
+		return EINVAL;
+	/** overlapping copy within a file would read data it already overwrote */
+	if (src_dfs == dst_dfs && daos_oid_cmp(src->oid, dst->oid) == 0 &&
+	    src_off < dst_off + len && dst_off < src_off + len)
+		return EINVAL;
+
+	*copied = 0;
+
+	rc = dfs_get_size(src_dfs, src, &src_size);
+	if (rc)
+		return rc;
+	if (src_off >= src_size)
+		return 0;
+	len = min(len, src_size - src_off);
+
+	rc = daos_array_get_attr(src->oh, &chunk_size, &cell_size);
+	if (rc)
+		return daos_der2errno(rc);
+
+	/** at most DFS_COPY_DEPTH * DFS_COPY_SLOT_MAX of buffers, whatever the chunk size */
+	slot_size = min(min(chunk_size, DFS_COPY_SLOT_MAX), len);
+
+	D_ALLOC_ARRAY(slots, DFS_COPY_DEPTH);
+	if (slots == NULL)
+		return ENOMEM;
+
+	for (i = 0; i < DFS_COPY_DEPTH; i++) {
+		slot = &slots[i];
+		D_ALLOC(slot->cs_iov.iov_buf, slot_size);
+		if (slot->cs_iov.iov_buf == NULL)
+			D_GOTO(out, rc = ENOMEM);
+		slot->cs_iov.iov_buf_len = slot_size;
+		slot->cs_sgl.sg_nr       = 1;
+		slot->cs_sgl.sg_iovs     = &slot->cs_iov;
+
+		rc = daos_event_init(&slot->cs_ev, DAOS_HDL_INVAL, NULL);
+		if (rc) {
+			D_FREE(slot->cs_iov.iov_buf);
+			D_GOTO(out, rc = daos_der2errno(rc));
+		}
+	}
+
+	ca.src_dfs = src_dfs;
+	ca.src     = src;
+	ca.src_off = src_off;
+	ca.dst_dfs = dst_dfs;
+	ca.dst     = dst;
+	ca.dst_off = dst_off;
+	ca.len     = len;
+
+	/*
+	 * Keep DFS_COPY_DEPTH pieces in flight, each read of a source piece stays within a chunk
+	 * so it hits a single dkey, and is written as soon as it lands. Pieces are retired in
+	 * order so that on error, \a copied is the length copied from the start of the range.
+	 */
+	while (rc == 0) {
+		bool progress = false;
+
+		while (inflight < DFS_COPY_DEPTH && pos < ca.len) {
+			slot                 = &slots[(head + inflight) % DFS_COPY_DEPTH];
+			slot->cs_off         = pos;
+			slot->cs_iov.iov_len = min(min(chunk_size - (src_off + pos) % chunk_size,
+						       ca.len - pos), slot_size);
+			slot->cs_state       = COPY_READ;
+			rc = dfs_read(src_dfs, src, &slot->cs_sgl, src_off + pos, &slot->cs_len,
+				      &slot->cs_ev);
+			if (rc) {
+				slot->cs_state = COPY_IDLE;
+				break;
+			}
+			pos += slot->cs_iov.iov_len;
+			inflight++;
+		}
+		if (rc || inflight == 0)
+			break;
+
+		/** move along every chunk whose I/O completed */
+		for (i = 0; i < inflight && rc == 0; i++) {
+			slot = &slots[(head + i) % DFS_COPY_DEPTH];
+			if (slot->cs_state == COPY_DONE)
+				continue;
+			rc = daos_event_test(&slot->cs_ev, DAOS_EQ_NOWAIT, &flag);
+			if (rc) {
+				rc = daos_der2errno(rc);
+				break;
+			}
+			if (flag) {
+				progress = true;
+				rc       = copy_slot_next(&ca, slot);
+			}
+		}
+
+		/** nothing completed, wait for the oldest chunk */
+		slot = &slots[head];
+		if (rc == 0 && !progress && slot->cs_state != COPY_DONE) {
+			rc = daos_event_test(&slot->cs_ev, DAOS_EQ_WAIT, &flag);
+			if (rc == 0)
+				rc = copy_slot_next(&ca, slot);
+			else
+				rc = daos_der2errno(rc);
+		}
+
+		while (inflight > 0 && slots[head].cs_state == COPY_DONE) {
+			slot = &slots[head];
+			if (slot->cs_off < ca.len)
+				done += min(slot->cs_len, ca.len - slot->cs_off);
+			slot->cs_state = COPY_IDLE;
+			head           = (head + 1) % DFS_COPY_DEPTH;
+			inflight--;
+		}
+	}
+
+	/** on error, wait for the chunks still in flight before releasing their buffers */
+	for (i = 0; i < DFS_COPY_DEPTH; i++) {
+		slot = &slots[i];
+		if (slot->cs_state == COPY_READ || slot->cs_state == COPY_WRITE)
+			daos_event_test(&slot->cs_ev, DAOS_EQ_WAIT, &flag);
+	}
+	*copied = done;
+
+out:
+	for (i = 0; i < DFS_COPY_DEPTH; i++) {
+		slot = &slots[i];
+		if (slot->cs_iov.iov_buf == NULL)
+			break;
+		rc2 = daos_event_fini(&slot->cs_ev);
+		if (rc == 0 && rc2)
+			rc = daos_der2errno(rc2);
+		D_FREE(slot->cs_iov.iov_buf);
+	}
+	D_FREE(slots);
+	return rc;
+}
@@ -26,6 +26,7 @@ lookup_rel_path(dfs_t *dfs, dfs_obj_t *root, const char *path, int flags, dfs_ob
 	int              daos_mode;
 	struct dfs_entry entry = {0};
 	size_t           len;
+	uint64_t         gen;
 	int              rc;
 	bool             parent_fully_valid;
 
@@ -113,6 +114,12 @@ lookup_rel_path_loop:
 
 		len = strlen(token);
 
+		if (dfs_ncache_lookup(dfs, parent.oid, token, len)) {
+			daos_obj_close(obj->oh, NULL);
+			D_GOTO(err_obj, rc = ENOENT);
+		}
+
+		gen              = dfs_ncache_gen(dfs);
 		entry.chunk_size = 0;
 		rc = fetch_entry(dfs->layout_v, parent.oh, DAOS_TX_NONE, token, len, true, &exists,
 				 &entry, 0, NULL, NULL, NULL);
@@ -125,8 +132,10 @@ lookup_rel_path_loop:
 			D_GOTO(err_obj, rc = daos_der2errno(rc));
 		}
 
-		if (!exists)
+		if (!exists) {
+			dfs_ncache_add(dfs, parent.oid, token, len, gen);
 			D_GOTO(err_obj, rc = ENOENT);
+		}
 
 		oid_cp(&obj->oid, entry.oid);
 		oid_cp(&obj->parent_oid, parent.oid);
@@ -399,6 +408,7 @@ lookup_rel_int(dfs_t *dfs, dfs_obj_t *parent, const char *name, int flags, dfs_o
 	bool             exists;
 	int              daos_mode;
 	size_t           len;
+	uint64_t         gen;
 	int              rc = 0;
 
 	if (dfs == NULL || !dfs->mounted)
@@ -420,13 +430,19 @@ lookup_rel_int(dfs_t *dfs, dfs_obj_t *parent, const char *name, int flags, dfs_o
 	if (daos_mode == -1)
 		return EINVAL;
 
-	rc = fetch_entry(dfs->layout_v, parent->oh, DAOS_TX_NONE, name, len, true, &exists, &entry,
-			 xnr, xnames, xvals, xsizes);
+	if (dfs_ncache_lookup(dfs, parent->oid, name, len))
+		return ENOENT;
+
+	gen = dfs_ncache_gen(dfs);
+	rc  = fetch_entry(dfs->layout_v, parent->oh, DAOS_TX_NONE, name, len, true, &exists,
+			  &entry, xnr, xnames, xvals, xsizes);
 	if (rc)
 		return rc;
 
-	if (!exists)
+	if (!exists) {
+		dfs_ncache_add(dfs, parent->oid, name, len, gen);
 		return ENOENT;
+	}
 
 	if (stbuf)
 		memset(stbuf, 0, sizeof(struct stat));
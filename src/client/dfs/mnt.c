@@ -699,6 +699,10 @@ dfs_mount(daos_handle_t poh, daos_handle_t coh, int flags, dfs_t **_dfs)
 			dfs->oid.hi = 0;
 	}
 
+	rc = dfs_ncache_init(dfs);
+	if (rc)
+		D_GOTO(err_root, rc);
+
 	dfs->mounted = DFS_MOUNT;
 	*_dfs        = dfs;
 	daos_prop_free(prop);
@@ -741,6 +745,7 @@ dfs_umount(dfs_t *dfs)
 	daos_obj_close(dfs->root.oh, NULL);
 	daos_obj_close(dfs->super_oh, NULL);
 
+	dfs_ncache_fini(dfs);
 	D_FREE(dfs->prefix);
 	D_MUTEX_DESTROY(&dfs->lock);
 	D_FREE(dfs);
@@ -1043,6 +1048,13 @@ dfs_global2local(daos_handle_t poh, daos_handle_t coh, int flags, d_iov_t glob,
 		D_GOTO(err_dfs, rc = daos_der2errno(rc));
 	}
 
+	rc = dfs_ncache_init(dfs);
+	if (rc) {
+		daos_obj_close(dfs->root.oh, NULL);
+		daos_obj_close(dfs->super_oh, NULL);
+		D_GOTO(err_dfs, rc);
+	}
+
 	dfs->mounted = DFS_MOUNT;
 	*_dfs        = dfs;
 
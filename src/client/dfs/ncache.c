@@ -0,0 +1,222 @@
+/**
+ * (C) Copyright 2024 Intel Corporation.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause-Patent
+ */
+
+/** DFS negative entry cache */
+
+#define D_LOGFAC DD_FAC(dfs)
+
+#include <daos/common.h>
+
+#include "dfs_internal.h"
+
+/*
+ * Names recently looked up and not found, so that repeated failed lookups (PATH searches,
+ * compiler include paths, interpreter imports) are answered without a fetch RPC. An entry is
+ * valid for DFS_NEG_CACHE_TIMEOUT seconds, and dropped as soon as this mount inserts the name.
+ * Names created by other clients are only seen once the entry expires, hence the cache is off
+ * unless the timeout is set.
+ */
+
+#define NCACHE_BUCKETS	1024
+#define NCACHE_MAX	16384
+
+struct dfs_ncache_entry {
+	/** link in the hash bucket */
+	d_list_t      ne_link;
+	/** link in the LRU list */
+	d_list_t      ne_lru;
+	daos_obj_id_t ne_parent;
+	/** expiry time (us) */
+	uint64_t      ne_expire;
+	uint64_t      ne_hash;
+	size_t        ne_len;
+	char          ne_name[];
+};
+
+struct dfs_ncache {
+	pthread_mutex_t nc_lock;
+	/** validity of an entry (sec) */
+	unsigned int    nc_timeout;
+	/** bumped on every insertion by this mount */
+	uint64_t        nc_gen;
+	uint32_t        nc_nr;
+	/** most recently added first */
+	d_list_t        nc_lru;
+	d_list_t        nc_buckets[NCACHE_BUCKETS];
+};
+
+static uint64_t
+ncache_hash(daos_obj_id_t parent, const char *name, size_t len)
+{
+	return d_hash_murmur64((const unsigned char *)name, len,
+			       d_hash_mix64(parent.lo ^ d_hash_mix64(parent.hi)));
+}
+
+static struct dfs_ncache_entry *
+ncache_find(struct dfs_ncache *nc, uint64_t hash, daos_obj_id_t parent, const char *name,
+	    size_t len)
+{
+	struct dfs_ncache_entry *ne;
+
+	d_list_for_each_entry(ne, &nc->nc_buckets[hash % NCACHE_BUCKETS], ne_link) {
+		if (ne->ne_hash == hash && ne->ne_len == len &&
+		    daos_oid_cmp(ne->ne_parent, parent) == 0 && memcmp(ne->ne_name, name, len) == 0)
+			return ne;
+	}
+	return NULL;
+}
+
+static void
+ncache_free(struct dfs_ncache *nc, struct dfs_ncache_entry *ne)
+{
+	d_list_del(&ne->ne_link);
+	d_list_del(&ne->ne_lru);
+	nc->nc_nr--;
+	D_FREE(ne);
+}
+
+int
+dfs_ncache_init(dfs_t *dfs)
+{
+	struct dfs_ncache *nc;
+	unsigned int       timeout = 0;
+	int                i;
+	int                rc;
+
+	d_getenv_uint("DFS_NEG_CACHE_TIMEOUT", &timeout);
+	if (timeout == 0)
+		return 0;
+
+	D_ALLOC_PTR(nc);
+	if (nc == NULL)
+		return ENOMEM;
+
+	rc = D_MUTEX_INIT(&nc->nc_lock, NULL);
+	if (rc) {
+		D_FREE(nc);
+		return daos_der2errno(rc);
+	}
+
+	nc->nc_timeout = timeout;
+	D_INIT_LIST_HEAD(&nc->nc_lru);
+	for (i = 0; i < NCACHE_BUCKETS; i++)
+		D_INIT_LIST_HEAD(&nc->nc_buckets[i]);
+
+	D_DEBUG(DB_ALL, "DFS negative entry cache, timeout %u sec\n", timeout);
+	dfs->ncache = nc;
+	return 0;
+}
+
+void
+dfs_ncache_fini(dfs_t *dfs)
+{
+	struct dfs_ncache       *nc = dfs->ncache;
+	struct dfs_ncache_entry *ne, *tmp;
+
+	if (nc == NULL)
+		return;
+
+	d_list_for_each_entry_safe(ne, tmp, &nc->nc_lru, ne_lru)
+		ncache_free(nc, ne);
+	D_MUTEX_DESTROY(&nc->nc_lock);
+	D_FREE(nc);
+	dfs->ncache = NULL;
+}
+
+uint64_t
+dfs_ncache_gen(dfs_t *dfs)
+{
+	struct dfs_ncache *nc = dfs->ncache;
+	uint64_t           gen;
+
+	if (nc == NULL)
+		return 0;
+
+	D_MUTEX_LOCK(&nc->nc_lock);
+	gen = nc->nc_gen;
+	D_MUTEX_UNLOCK(&nc->nc_lock);
+	return gen;
+}
+
+bool
+dfs_ncache_lookup(dfs_t *dfs, daos_obj_id_t parent, const char *name, size_t len)
+{
+	struct dfs_ncache       *nc = dfs->ncache;
+	struct dfs_ncache_entry *ne;
+	uint64_t                 hash;
+	bool                     found = false;
+
+	if (nc == NULL)
+		return false;
+
+	hash = ncache_hash(parent, name, len);
+	D_MUTEX_LOCK(&nc->nc_lock);
+	ne = ncache_find(nc, hash, parent, name, len);
+	if (ne != NULL) {
+		if (ne->ne_expire > d_timeus_secdiff(0))
+			found = true;
+		else
+			ncache_free(nc, ne);
+	}
+	D_MUTEX_UNLOCK(&nc->nc_lock);
+	return found;
+}
+
+void
+dfs_ncache_add(dfs_t *dfs, daos_obj_id_t parent, const char *name, size_t len, uint64_t gen)
+{
+	struct dfs_ncache       *nc = dfs->ncache;
+	struct dfs_ncache_entry *ne;
+	uint64_t                 hash;
+
+	if (nc == NULL)
+		return;
+
+	hash = ncache_hash(parent, name, len);
+	D_ALLOC(ne, sizeof(*ne) + len);
+	if (ne == NULL)
+		return;
+
+	ne->ne_parent = parent;
+	ne->ne_hash   = hash;
+	ne->ne_len    = len;
+	ne->ne_expire = d_timeus_secdiff(nc->nc_timeout);
+	memcpy(ne->ne_name, name, len);
+
+	D_MUTEX_LOCK(&nc->nc_lock);
+	/** the name was inserted by this mount since the lookup started, it may exist now */
+	if (gen != nc->nc_gen || ncache_find(nc, hash, parent, name, len) != NULL) {
+		D_MUTEX_UNLOCK(&nc->nc_lock);
+		D_FREE(ne);
+		return;
+	}
+
+	if (nc->nc_nr >= NCACHE_MAX)
+		ncache_free(nc, d_list_entry(nc->nc_lru.prev, struct dfs_ncache_entry, ne_lru));
+	d_list_add(&ne->ne_link, &nc->nc_buckets[hash % NCACHE_BUCKETS]);
+	d_list_add(&ne->ne_lru, &nc->nc_lru);
+	nc->nc_nr++;
+	D_MUTEX_UNLOCK(&nc->nc_lock);
+}
+
+void
+dfs_ncache_del(dfs_t *dfs, daos_obj_id_t parent, const char *name, size_t len)
+{
+	struct dfs_ncache       *nc = dfs->ncache;
+	struct dfs_ncache_entry *ne;
+	uint64_t                 hash;
+
+	if (nc == NULL)
+		return;
+
+	hash = ncache_hash(parent, name, len);
+	D_MUTEX_LOCK(&nc->nc_lock);
+	nc->nc_gen++;
+	ne = ncache_find(nc, hash, parent, name, len);
+	if (ne != NULL)
+		ncache_free(nc, ne);
+	D_MUTEX_UNLOCK(&nc->nc_lock);
+}
@@ -188,6 +188,7 @@ open_file(dfs_t *dfs, dfs_obj_t *parent, int flags, daos_oclass_id_t cid, daos_s
 
 		rc = insert_entry(dfs->layout_v, parent->oh, DAOS_TX_NONE, file->name, len,
 				  DAOS_COND_DKEY_INSERT, entry);
+		dfs_ncache_del(dfs, parent->oid, file->name, len);
 		if (rc == EEXIST && !oexcl) {
 			int rc2;
 
@@ -313,6 +314,7 @@ open_symlink(dfs_t *dfs, dfs_obj_t *parent, int flags, daos_oclass_id_t cid, con
 
 		rc = insert_entry(dfs->layout_v, parent->oh, DAOS_TX_NONE, sym->name, len,
 				  DAOS_COND_DKEY_INSERT, entry);
+		dfs_ncache_del(dfs, parent->oid, sym->name, len);
 		if (rc == EEXIST) {
 			D_FREE(sym->value);
 		} else if (rc != 0) {
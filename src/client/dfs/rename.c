@@ -300,6 +300,11 @@ out:
 	if (rc == ERESTART)
 		goto restart;
 
+	/** symlinks are renamed within the source parent */
+	if (rc == 0)
+		dfs_ncache_del(dfs, S_ISLNK(entry.mode) ? parent->oid : new_parent->oid, new_name,
+			       new_len);
+
 	if (entry.value) {
 		D_ASSERT(S_ISLNK(entry.mode));
 		D_FREE(entry.value);
@@ -436,6 +441,12 @@ out:
 	if (rc == ERESTART)
 		goto restart;
 
+	/** each name may be new to the other parent */
+	if (rc == 0) {
+		dfs_ncache_del(dfs, parent2->oid, name1, len1);
+		dfs_ncache_del(dfs, parent1->oid, name2, len2);
+	}
+
 	if (entry1.value) {
 		D_ASSERT(S_ISLNK(entry1.mode));
 		D_FREE(entry1.value);
@@ -142,6 +142,7 @@ ds3_bucket_destroy(const char *name, bool force, ds3_t *ds3, daos_event_t *ev)
 	struct dirent *dirents = NULL;
 	dfs_obj_t     *dir_obj = NULL;
 	daos_anchor_t  anchor;
+	uint32_t       i;
 
 	if (ds3 == NULL || name == NULL)
 		return -EINVAL;
@@ -167,10 +168,12 @@ ds3_bucket_destroy(const char *name, bool force, ds3_t *ds3, daos_event_t *ev)
 		if (rc != 0)
 			goto err_dirents;
 
-		/* The bucket is not empty */
-		if (nd != 0) {
-			rc = ENOTEMPTY;
-			goto err_dirents;
+		/* The bucket is not empty, the data of pending uploads goes with them */
+		for (i = 0; i < nd; i++) {
+			if (strcmp(dirents[i].d_name, MULTIPART_DATA_DIR) != 0) {
+				rc = ENOTEMPTY;
+				goto err_dirents;
+			}
 		}
 	}
 
@@ -285,27 +288,96 @@ ds3_bucket_set_info(struct ds3_bucket_info *info, ds3_bucket_t *ds3b, daos_event
 	return -rc;
 }
 
+/*
+ * Build the engine side filter of the entries starting with \a prefix, so only the matching
+ * entries are returned by the enumeration. Returns NULL if the prefix can't be expressed as
+ * a LIKE pattern, the entries are then filtered on the client.
+ */
+static dfs_pipeline_t *
+ds3_prefix_pipeline(ds3_bucket_t *ds3b, const char *prefix)
+{
+	dfs_predicate_t  pred = {0};
+	dfs_pipeline_t  *dpipe;
+	size_t           len = 0;
+	const char      *p;
+	int              rc;
+
+	for (p = prefix; *p != '\0'; p++) {
+		/* room for the escape, the character, the trailing % and the NUL */
+		if (len + 4 > DFS_MAX_NAME)
+			return NULL;
+		if (*p == '%' || *p == '_' || *p == '\\')
+			pred.dp_name[len++] = '\\';
+		pred.dp_name[len++] = *p;
+	}
+	pred.dp_name[len] = '%';
+
+	rc = dfs_pipeline_create(ds3b->dfs, pred, DFS_FILTER_NAME | DFS_FILTER_INCLUDE_DIRS,
+				 &dpipe);
+	if (rc != 0) {
+		D_DEBUG(DB_ALL, "No pipeline for prefix %s, rc = %d\n", prefix, rc);
+		return NULL;
+	}
+	return dpipe;
+}
+
+/*
+ * Entry of \a path that the listing resumes after, i.e. the first component of \a marker
+ * below \a path. Returns false if the marker is not under \a path.
+ */
+static bool
+ds3_marker_entry(const char *marker, const char *path, const char *delim, char *name)
+{
+	size_t      path_len = strlen(path);
+	const char *start    = marker;
+	const char *end;
+
+	if (path_len != 0) {
+		if (strncmp(marker, path, path_len) != 0 || marker[path_len] != delim[0])
+			return false;
+		start = marker + path_len + 1;
+	}
+
+	end = strchr(start, delim[0]);
+	if (end == NULL)
+		end = start + strlen(start);
+	if (end == start || end - start > DFS_MAX_NAME)
+		return false;
+
+	memcpy(name, start, end - start);
+	name[end - start] = '\0';
+	return true;
+}
+
 int
 ds3_bucket_list_obj(uint32_t *nobj, struct ds3_object_info *objs, uint32_t *ncp,
 		    struct ds3_common_prefix_info *cps, const char *prefix, const char *delim,
 		    char *marker, bool list_versions, bool *is_truncated, ds3_bucket_t *ds3b)
 {
-	int            rc = 0;
-	char          *file_start = NULL;
-	const char    *path = "";
-	char          *prefix_copy = NULL;
-	const char    *prefix_rest = NULL;
-	dfs_obj_t     *dir_obj;
-	char          *lookup_path;
-	struct dirent *dirents;
-	daos_anchor_t  anchor;
-	uint32_t       cpi;
-	uint32_t       obji;
-	uint32_t       i;
-	const char    *name;
-	dfs_obj_t     *entry_obj;
-	mode_t         mode;
-	char          *cpp;
+	int             rc = 0;
+	char           *file_start = NULL;
+	const char     *path = "";
+	char           *prefix_copy = NULL;
+	const char     *prefix_rest = NULL;
+	dfs_obj_t      *dir_obj;
+	char           *lookup_path;
+	struct dirent  *dirents;
+	dfs_pipeline_t *dpipe = NULL;
+	daos_anchor_t   anchor;
+	char            marker_name[DFS_MAX_NAME + 1];
+	bool            skip_marker = false;
+	bool            truncated   = false;
+	bool            filtered    = false;
+	const char     *last        = NULL;
+	bool            last_is_dir = false;
+	uint32_t        cpi;
+	uint32_t        obji;
+	uint32_t        nr;
+	uint32_t        i;
+	const char     *name;
+	dfs_obj_t      *entry_obj;
+	mode_t          mode;
+	char           *cpp;
 
 	if (ds3b == NULL || nobj == NULL)
 		return -EINVAL;
@@ -331,11 +403,13 @@ ds3_bucket_list_obj(uint32_t *nobj, struct ds3_object_info *objs, uint32_t *ncp,
 			path        = prefix_copy;
 			prefix_rest = file_start + 1;
 		}
+		if (prefix_rest[0] == '\0')
+			prefix_rest = NULL;
 	}
 
 	D_ALLOC_ARRAY(lookup_path, DS3_MAX_KEY_BUFF);
 	if (lookup_path == NULL) {
-		rc = -ENOMEM;
+		rc = ENOMEM;
 		goto err_prefix;
 	}
 
@@ -352,96 +426,167 @@ ds3_bucket_list_obj(uint32_t *nobj, struct ds3_object_info *objs, uint32_t *ncp,
 	}
 
 	/**
-	 * TODO handle bigger directories
+	 * Entries come in hash order, so the marker is where the previous page stopped: seek
+	 * the anchor to that entry instead of enumerating the directory from the start.
 	 * TODO handle ordering
-	 * TODO handle marker
 	 */
 	daos_anchor_init(&anchor, 0);
+	if (marker != NULL && marker[0] != '\0' &&
+	    ds3_marker_entry(marker, path, delim, marker_name)) {
+		rc = dfs_dir_anchor_set(dir_obj, marker_name, &anchor);
+		if (rc == 0) {
+			skip_marker = true;
+		} else {
+			/* the marker entry was removed, start over */
+			D_DEBUG(DB_ALL, "Marker %s not found, rc = %d\n", marker, rc);
+			daos_anchor_init(&anchor, 0);
+		}
+	}
 
-	rc = dfs_readdir(ds3b->dfs, dir_obj, &anchor, nobj, dirents);
-	if (rc != 0)
-		goto err_dirents;
-
-	if (is_truncated != NULL)
-		*is_truncated = !daos_anchor_is_eof(&anchor);
+	if (prefix_rest != NULL)
+		dpipe = ds3_prefix_pipeline(ds3b, prefix_rest);
 
 	/**
 	 * Go through the returned objects, if it is a regular file, add to objs. If it's a
-	 * directory add to cps. Otherwise ignore.
+	 * directory add to cps. Otherwise ignore. Stop once an entry doesn't fit, the page
+	 * then ends with the last returned entry.
 	 */
 	cpi  = 0;
 	obji = 0;
-	for (i = 0; i < *nobj; i++) {
-		name = dirents[i].d_name;
-
-		/**
-		 * Skip entries that do not start with prefix_rest
-		 * TODO handle how this affects max
-		 */
-		if (prefix_rest) {
-			if (strncmp(name, prefix_rest, strlen(prefix_rest)) != 0)
+	while (!truncated && !daos_anchor_is_eof(&anchor)) {
+		nr = *nobj;
+		if (dpipe != NULL) {
+			daos_anchor_t saved = anchor;
+			uint64_t      scanned;
+
+			memset(dirents, 0, sizeof(*dirents) * nr);
+			rc = dfs_readdir_with_filter(ds3b->dfs, dir_obj, dpipe, &anchor, &nr,
+						     dirents, NULL, NULL, &scanned);
+			if (rc != 0 && !filtered) {
+				/* engine without pipeline support, filter on the client */
+				D_DEBUG(DB_ALL, "Filtered readdir failed, rc = %d\n", rc);
+				dfs_pipeline_destroy(dpipe);
+				dpipe  = NULL;
+				anchor = saved;
 				continue;
+			}
+			filtered = true;
+		} else {
+			rc = dfs_readdir(ds3b->dfs, dir_obj, &anchor, &nr, dirents);
 		}
-
-		/* Open the file and check mode */
-		rc = dfs_lookup_rel(ds3b->dfs, dir_obj, name, O_RDWR | O_NOFOLLOW, &entry_obj,
-				    &mode, NULL);
 		if (rc != 0)
 			goto err_dirents;
 
-		if (S_ISDIR(mode)) {
-			/* The entry is a directory */
+		for (i = 0; i < nr; i++) {
+			name = dirents[i].d_name;
 
-			/* Out of bounds */
-			if (cpi >= *ncp) {
-				rc = EINVAL;
-				goto err_dirents;
+			if (skip_marker) {
+				skip_marker = false;
+				if (strcmp(name, marker_name) == 0)
+					continue;
 			}
 
-			/* Add to cps */
-			cpp = cps[cpi].prefix;
-			if (strlen(path) != 0) {
-				strcpy(cpp, path);
-				strcat(cpp, delim);
+			/* Data of the uploads in progress */
+			if (path[0] == '\0' && strcmp(name, MULTIPART_DATA_DIR) == 0)
+				continue;
+
+			/* Skip entries that do not start with prefix_rest */
+			if (dpipe == NULL && prefix_rest != NULL &&
+			    strncmp(name, prefix_rest, strlen(prefix_rest)) != 0)
+				continue;
+
+			/* Directories are known from the filtered readdir, no need to open them */
+			entry_obj = NULL;
+			if (dirents[i].d_type == DT_DIR) {
+				mode = S_IFDIR;
 			} else {
-				strcpy(cpp, "");
+				/* Open the file and check mode */
+				rc = dfs_lookup_rel(ds3b->dfs, dir_obj, name, O_RDWR | O_NOFOLLOW,
+						    &entry_obj, &mode, NULL);
+				if (rc != 0)
+					goto err_dirents;
 			}
-			strcat(cpp, name);
-			strcat(cpp, delim);
-
-			cpi++;
-		} else if (S_ISREG(mode)) {
-			/* The entry is a regular file */
-			/* Read the xattr and add to objs */
-			/* TODO make more efficient */
-			rc = dfs_getxattr(ds3b->dfs, entry_obj, RGW_DIR_ENTRY_XATTR,
-					  objs[obji].encoded, &objs[obji].encoded_length);
-			/* Skip if file has no dirent */
-			if (rc != 0) {
-				D_DEBUG(DB_ALL, "No dirent, skipping entry= %s\n", name);
+
+			if (S_ISDIR(mode)) {
+				/* The entry is a directory */
+
+				/* Page is full */
+				if (cpi >= *ncp) {
+					truncated = true;
+				} else {
+					/* Add to cps */
+					cpp = cps[cpi].prefix;
+					if (strlen(path) != 0) {
+						strcpy(cpp, path);
+						strcat(cpp, delim);
+					} else {
+						strcpy(cpp, "");
+					}
+					strcat(cpp, name);
+					strcat(cpp, delim);
+
+					cpi++;
+					last        = name;
+					last_is_dir = true;
+				}
+			} else if (S_ISREG(mode)) {
+				/* The entry is a regular file */
+				if (obji >= *nobj) {
+					truncated = true;
+				} else {
+					/* Read the xattr and add to objs */
+					/* TODO make more efficient */
+					rc = dfs_getxattr(ds3b->dfs, entry_obj, RGW_DIR_ENTRY_XATTR,
+							  objs[obji].encoded,
+							  &objs[obji].encoded_length);
+					if (rc == 0) {
+						obji++;
+						last        = name;
+						last_is_dir = false;
+					} else {
+						/* Skip if file has no dirent */
+						D_DEBUG(DB_ALL, "No dirent, skipping entry= %s\n",
+							name);
+					}
+				}
+			} else {
+				/* Skip other types */
+				D_DEBUG(DB_ALL, "Skipping entry = %s\n", name);
+			}
+
+			/* Close handles */
+			if (entry_obj != NULL) {
 				rc = dfs_release(entry_obj);
 				if (rc != 0)
 					goto err_dirents;
-				continue;
 			}
 
-			obji++;
-		} else {
-			/* Skip other types */
-			D_DEBUG(DB_ALL, "Skipping entry = %s\n", name);
+			if (truncated)
+				break;
+
+			/* The next marker is the last entry returned */
+			if (last == name && marker != NULL) {
+				if (strlen(path) != 0)
+					snprintf(marker, DS3_MAX_KEY_BUFF, "%s%s%s%s", path, delim,
+						 name, last_is_dir ? delim : "");
+				else
+					snprintf(marker, DS3_MAX_KEY_BUFF, "%s%s", name,
+						 last_is_dir ? delim : "");
+			}
 		}
-
-		/* Close handles */
-		rc = dfs_release(entry_obj);
-		if (rc != 0)
-			goto err_dirents;
 	}
+	rc = 0;
+
+	if (is_truncated != NULL)
+		*is_truncated = truncated;
 
 	/* Set the number of read objects */
 	*nobj = obji;
 	*ncp  = cpi;
 
 err_dirents:
+	if (dpipe != NULL)
+		dfs_pipeline_destroy(dpipe);
 	D_FREE(dirents);
 err_dir_obj:
 	dfs_release(dir_obj);
@@ -22,6 +22,15 @@
 #define RGW_DIR_ENTRY_XATTR    "rgw_entry"
 #define RGW_KEY_XATTR          "rgw_key"
 #define RGW_PART_XATTR         "rgw_part"
+#define RGW_LAYOUT_XATTR       "rgw_layout"
+
+/**
+ * Bucket directory holding the data of the uploads written in place.  0xff never occurs in UTF-8,
+ * so the name can't collide with an S3 key.
+ */
+#define MULTIPART_DATA_DIR     "\xff" "multipart"
+/** Each part is written at (part_num - 1) * stride of the upload data file, S3 max part size */
+#define MULTIPART_PART_STRIDE  (5ULL << 30)
 
 #define METADATA_DIR_LIST                                                                          \
 	X(USERS_DIR, "users")                                                                      \
@@ -54,20 +63,44 @@ struct ds3_bucket {
 	dfs_t *dfs;
 };
 
+/** Run of parts of the same size in consecutive slots of a completed upload */
+struct ds3_part_extent {
+	/** First slot of the run */
+	uint32_t pe_slot;
+	/** Number of parts in the run */
+	uint32_t pe_nr;
+	/** Size of each part */
+	uint64_t pe_size;
+};
+
 /** DAOS S3 Object handle */
 struct ds3_obj {
 	/** DFS object handle */
-	dfs_obj_t *dfs_obj;
+	dfs_obj_t              *dfs_obj;
+	/** Part layout of an object completed in place, NULL otherwise */
+	struct ds3_part_extent *layout;
+	/** Number of entries in layout */
+	uint32_t                layout_nr;
 };
 
 /** DAOS S3 Upload Part handle */
 struct ds3_part {
 	/** DFS object handle */
 	dfs_obj_t *dfs_obj;
+	/** Bucket DFS handle of a part written in place */
+	dfs_t     *data_dfs;
+	/** Upload data file of a part written in place, NULL otherwise */
+	dfs_obj_t *data_obj;
+	/** Offset of the part slot in data_obj */
+	daos_off_t data_off;
 };
 
 /** Helper function, returns the meta dir name from the enum value */
 const char *
 meta_dir_name(enum meta_dir dir);
 
+/** Helper function, creates and opens the directories of \a parent_path, which is modified */
+int
+ds3_obj_mkdir_parent(ds3_bucket_t *ds3b, char *parent_path, dfs_obj_t **parent);
+
 #endif
@@ -462,15 +462,81 @@ err_ds3p:
 	return -rc;
 }
 
+/* Open the bucket directory holding the data of the uploads written in place */
+static int
+ds3_upload_data_dir(ds3_bucket_t *ds3b, bool create, dfs_obj_t **data_dir)
+{
+	int rc;
+
+	if (create) {
+		rc = dfs_mkdir(ds3b->dfs, NULL, MULTIPART_DATA_DIR, DEFFILEMODE, 0);
+		if (rc != 0 && rc != EEXIST)
+			return rc;
+	}
+
+	return dfs_lookup_rel(ds3b->dfs, NULL, MULTIPART_DATA_DIR, O_RDWR, data_dir, NULL, NULL);
+}
+
+int
+ds3_upload_part_open(const char *bucket_name, const char *upload_id, uint64_t part_num,
+		     bool truncate, ds3_part_t **ds3p, ds3_bucket_t *ds3b, ds3_t *ds3)
+{
+	int         rc  = 0;
+	int         rc2 = 0;
+	ds3_part_t *ds3p_tmp;
+	dfs_obj_t  *data_dir;
+
+	if (ds3p == NULL || ds3b == NULL)
+		return -EINVAL;
+	if (part_num == 0 || part_num > MULTIPART_MAX_PARTS)
+		return -EINVAL;
+
+	/* The part entry still holds the part info and is what the parts listing reads */
+	rc = ds3_part_open(bucket_name, upload_id, part_num, truncate, &ds3p_tmp, ds3);
+	if (rc != 0)
+		return rc;
+
+	rc = ds3_upload_data_dir(ds3b, true, &data_dir);
+	if (rc != 0)
+		goto err_part;
+
+	rc = dfs_open(ds3b->dfs, data_dir, upload_id, DEFFILEMODE | S_IFREG, O_RDWR | O_CREAT, 0,
+		      0, NULL, &ds3p_tmp->data_obj);
+	if (rc != 0)
+		goto err_data_dir;
+
+	ds3p_tmp->data_dfs = ds3b->dfs;
+	ds3p_tmp->data_off = (part_num - 1) * MULTIPART_PART_STRIDE;
+
+	/* Drop what a previous upload of the same part wrote to the slot */
+	if (truncate)
+		rc = dfs_punch(ds3b->dfs, ds3p_tmp->data_obj, ds3p_tmp->data_off,
+			       MULTIPART_PART_STRIDE);
+
+err_data_dir:
+	rc2 = dfs_release(data_dir);
+	rc  = rc == 0 ? rc2 : rc;
+err_part:
+	if (rc == 0)
+		*ds3p = ds3p_tmp;
+	else
+		ds3_part_close(ds3p_tmp);
+	return -rc;
+}
+
 int
 ds3_part_close(ds3_part_t *ds3p)
 {
-	int rc = 0;
+	int rc  = 0;
+	int rc2 = 0;
 
 	if (ds3p == NULL)
 		return -EINVAL;
 
 	rc = dfs_release(ds3p->dfs_obj);
+	if (ds3p->data_obj != NULL)
+		rc2 = dfs_release(ds3p->data_obj);
+	rc = rc == 0 ? rc2 : rc;
 	D_FREE(ds3p);
 	return -rc;
 }
@@ -488,6 +554,14 @@ ds3_part_write(void *buf, daos_off_t off, daos_size_t *size, ds3_part_t *ds3p, d
 	d_iov_set(&iov, buf, *size);
 	wsgl.sg_nr   = 1;
 	wsgl.sg_iovs = &iov;
+
+	if (ds3p->data_obj != NULL) {
+		/* Don't overflow into the slot of the next part */
+		if (off + *size > MULTIPART_PART_STRIDE)
+			return -EFBIG;
+		return -dfs_write(ds3p->data_dfs, ds3p->data_obj, &wsgl, ds3p->data_off + off,
+				  ev);
+	}
 	return -dfs_write(ds3->meta_dfs, ds3p->dfs_obj, &wsgl, off, ev);
 }
 
@@ -501,10 +575,22 @@ ds3_part_read(void *buf, daos_off_t off, daos_size_t *size, ds3_part_t *ds3p, ds
 	if (ds3p == NULL || buf == NULL || ds3 == NULL)
 		return -EINVAL;
 
+	if (ds3p->data_obj != NULL) {
+		if (off >= MULTIPART_PART_STRIDE) {
+			*size = 0;
+			return 0;
+		}
+		*size = min(*size, MULTIPART_PART_STRIDE - off);
+	}
+
 	d_iov_set(&iov, buf, *size);
 	rsgl.sg_nr     = 1;
 	rsgl.sg_iovs   = &iov;
 	rsgl.sg_nr_out = 1;
+
+	if (ds3p->data_obj != NULL)
+		return -dfs_read(ds3p->data_dfs, ds3p->data_obj, &rsgl, ds3p->data_off + off,
+				 size, ev);
 	return -dfs_read(ds3->meta_dfs, ds3p->dfs_obj, &rsgl, off, size, ev);
 }
 
@@ -518,3 +604,170 @@ ds3_part_set_info(struct ds3_multipart_part_info *info, ds3_part_t *ds3p, ds3_t
 	return -dfs_setxattr(ds3->meta_dfs, ds3p->dfs_obj, RGW_PART_XATTR, info->encoded,
 			     info->encoded_length, 0);
 }
+
+/* Build the part layout of the completed object, consecutive same sized parts share an entry */
+static int
+ds3_upload_layout(uint32_t nparts, const uint64_t *part_nums, const daos_size_t *part_sizes,
+		  struct ds3_part_extent *layout, uint32_t *layout_nr)
+{
+	struct ds3_part_extent *pe = NULL;
+	uint64_t                prev = 0;
+	uint32_t                nr   = 0;
+	uint32_t                i;
+
+	for (i = 0; i < nparts; i++) {
+		if (part_nums[i] <= prev || part_nums[i] > MULTIPART_MAX_PARTS ||
+		    part_sizes[i] > MULTIPART_PART_STRIDE)
+			return EINVAL;
+		prev = part_nums[i];
+
+		/* Empty parts add nothing to the object */
+		if (part_sizes[i] == 0)
+			continue;
+
+		if (pe != NULL && pe->pe_slot + pe->pe_nr == part_nums[i] - 1 &&
+		    pe->pe_size == part_sizes[i]) {
+			pe->pe_nr++;
+			continue;
+		}
+
+		pe          = &layout[nr++];
+		pe->pe_slot = part_nums[i] - 1;
+		pe->pe_nr   = 1;
+		pe->pe_size = part_sizes[i];
+	}
+
+	*layout_nr = nr;
+	return 0;
+}
+
+int
+ds3_upload_complete(const char *upload_id, const char *key, uint32_t nparts,
+		    const uint64_t *part_nums, const daos_size_t *part_sizes,
+		    struct ds3_object_info *info, ds3_bucket_t *ds3b)
+{
+	int                     rc  = 0;
+	int                     rc2 = 0;
+	struct ds3_part_extent *layout;
+	uint32_t                layout_nr;
+	uint32_t                i;
+	daos_off_t              end;
+	dfs_obj_t              *data_dir;
+	dfs_obj_t              *data_obj;
+	dfs_obj_t              *parent = NULL;
+	char                   *path;
+	char                   *file_start;
+	char                   *file_name;
+
+	if (upload_id == NULL || ds3b == NULL || part_nums == NULL || part_sizes == NULL)
+		return -EINVAL;
+	if (key == NULL || strnlen(key, DS3_MAX_KEY) > DS3_MAX_KEY - 1)
+		return -EINVAL;
+	if (nparts == 0 || nparts > MULTIPART_MAX_PARTS)
+		return -EINVAL;
+
+	D_ALLOC_ARRAY(layout, nparts);
+	if (layout == NULL)
+		return -ENOMEM;
+
+	rc = ds3_upload_layout(nparts, part_nums, part_sizes, layout, &layout_nr);
+	if (rc != 0)
+		goto err_layout;
+	if (layout_nr * sizeof(*layout) > DFS_MAX_XATTR_LEN) {
+		D_DEBUG(DB_ALL, "Layout of upload %s does not fit, %u entries\n", upload_id,
+			layout_nr);
+		D_GOTO(err_layout, rc = E2BIG);
+	}
+
+	D_STRNDUP(path, key, DS3_MAX_KEY_BUFF - 1);
+	if (path == NULL)
+		D_GOTO(err_layout, rc = ENOMEM);
+
+	rc = ds3_upload_data_dir(ds3b, false, &data_dir);
+	if (rc != 0)
+		goto err_path;
+
+	rc = dfs_lookup_rel(ds3b->dfs, data_dir, upload_id, O_RDWR, &data_obj, NULL, NULL);
+	if (rc != 0)
+		goto err_data_dir;
+
+	/* Drop the slots of the parts left out of the object, up to the last one kept */
+	end = 0;
+	for (i = 0; i < layout_nr && rc == 0; i++) {
+		if (layout[i].pe_slot * MULTIPART_PART_STRIDE > end)
+			rc = dfs_punch(ds3b->dfs, data_obj, end,
+				       layout[i].pe_slot * MULTIPART_PART_STRIDE - end);
+		end = (layout[i].pe_slot + layout[i].pe_nr) * MULTIPART_PART_STRIDE;
+	}
+	if (rc == 0)
+		rc = dfs_punch(ds3b->dfs, data_obj, end, DFS_MAX_FSIZE);
+	if (rc != 0)
+		goto err_data_obj;
+
+	/* An object of empty parts has no layout and reads as the empty file it is */
+	if (layout_nr != 0) {
+		rc = dfs_setxattr(ds3b->dfs, data_obj, RGW_LAYOUT_XATTR, layout,
+				  layout_nr * sizeof(*layout), 0);
+		if (rc != 0)
+			goto err_data_obj;
+	}
+
+	if (info != NULL) {
+		rc = dfs_setxattr(ds3b->dfs, data_obj, RGW_DIR_ENTRY_XATTR, info->encoded,
+				  info->encoded_length, 0);
+		if (rc != 0)
+			goto err_data_obj;
+	}
+
+	file_start = strrchr(path, '/');
+	file_name  = path;
+	if (file_start != NULL) {
+		*file_start = '\0';
+		file_name   = file_start + 1;
+		rc          = ds3_obj_mkdir_parent(ds3b, path, &parent);
+		if (rc != 0)
+			goto err_data_obj;
+	}
+
+	/* Link the upload data under the key, replacing any previous object */
+	rc = dfs_move(ds3b->dfs, data_dir, upload_id, parent, file_name, NULL);
+
+	if (parent)
+		rc2 = dfs_release(parent);
+	rc = rc == 0 ? rc2 : rc;
+err_data_obj:
+	rc2 = dfs_release(data_obj);
+	rc  = rc == 0 ? rc2 : rc;
+err_data_dir:
+	rc2 = dfs_release(data_dir);
+	rc  = rc == 0 ? rc2 : rc;
+err_path:
+	D_FREE(path);
+err_layout:
+	D_FREE(layout);
+	return -rc;
+}
+
+int
+ds3_upload_remove_data(const char *upload_id, ds3_bucket_t *ds3b)
+{
+	int        rc  = 0;
+	int        rc2 = 0;
+	dfs_obj_t *data_dir;
+
+	if (upload_id == NULL || ds3b == NULL)
+		return -EINVAL;
+
+	rc = ds3_upload_data_dir(ds3b, false, &data_dir);
+	if (rc == ENOENT)
+		return 0;
+	if (rc != 0)
+		return -rc;
+
+	rc = dfs_remove(ds3b->dfs, data_dir, upload_id, false, NULL);
+	if (rc == ENOENT)
+		rc = 0;
+	rc2 = dfs_release(data_dir);
+	rc  = rc == 0 ? rc2 : rc;
+	return -rc;
+}
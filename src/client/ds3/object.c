@@ -9,6 +9,7 @@
 typedef struct ds3_obj_args {
 	d_iov_t	iov;
 	d_sg_list_t sg;
+	dfs_iod_t iod;
 } ds3_obj_args_t;
 
 /* helper */
@@ -29,6 +30,61 @@ ends_with(const char *str, const char *suffix)
 	return strncmp(str + lenstr - lensuffix, suffix, lensuffix) == 0;
 }
 
+/* helper, whether the key lands in the data directory of the uploads in progress */
+static bool
+is_multipart_data(const char *key)
+{
+	size_t len = strlen(MULTIPART_DATA_DIR);
+
+	while (*key == '/')
+		key++;
+
+	return strncmp(key, MULTIPART_DATA_DIR, len) == 0 && (key[len] == '\0' || key[len] == '/');
+}
+
+int
+ds3_obj_mkdir_parent(ds3_bucket_t *ds3b, char *parent_path, dfs_obj_t **parent)
+{
+	int        rc = 0;
+	mode_t     mode = DEFFILEMODE;
+	dfs_obj_t *dir_obj;
+	char      *sptr = NULL;
+	char      *dir;
+
+	*parent = NULL;
+
+	/* Recursively open parent directories */
+	for (dir = strtok_r(parent_path, "/", &sptr); dir != NULL;
+	     dir = strtok_r(NULL, "/", &sptr)) {
+		/* Create directory */
+		rc = dfs_mkdir(ds3b->dfs, *parent, dir, mode, 0);
+
+		if (rc != 0 && rc != EEXIST)
+			break;
+
+		/* Open directory */
+		rc = dfs_lookup_rel(ds3b->dfs, *parent, dir, O_RDWR, &dir_obj, NULL, NULL);
+		if (rc != 0)
+			break;
+
+		/* Next parent */
+		if (*parent) {
+			rc = dfs_release(*parent);
+			if (rc != 0) {
+				dfs_release(dir_obj);
+				break;
+			}
+		}
+		*parent = dir_obj;
+	}
+
+	if (rc != 0 && *parent != NULL) {
+		dfs_release(*parent);
+		*parent = NULL;
+	}
+	return rc;
+}
+
 int
 ds3_obj_create(const char *key, ds3_obj_t **ds3o, ds3_bucket_t *ds3b)
 {
@@ -41,9 +97,6 @@ ds3_obj_create(const char *key, ds3_obj_t **ds3o, ds3_bucket_t *ds3b)
 	char      *file_name;
 	char      *parent_path = NULL;
 	mode_t     mode        = DEFFILEMODE;
-	dfs_obj_t *dir_obj;
-	char      *sptr = NULL;
-	char      *dir;
 
 	if (ds3b == NULL || ds3o == NULL)
 		return -EINVAL;
@@ -56,6 +109,10 @@ ds3_obj_create(const char *key, ds3_obj_t **ds3o, ds3_bucket_t *ds3b)
 		return -EINVAL;
 	}
 
+	/* Reserved name, which no S3 key can produce since it isn't valid UTF-8 */
+	if (is_multipart_data(key))
+		return -EINVAL;
+
 	/* TODO: cache open file handles */
 	D_ALLOC_PTR(ds3o_tmp);
 	if (ds3o_tmp == NULL)
@@ -76,34 +133,25 @@ ds3_obj_create(const char *key, ds3_obj_t **ds3o, ds3_bucket_t *ds3b)
 	}
 
 	if (parent_path != NULL) {
-		/* Recursively open parent directories */
-
-		for (dir = strtok_r(parent_path, "/", &sptr); dir != NULL;
-		     dir = strtok_r(NULL, "/", &sptr)) {
-			/* Create directory */
-			rc = dfs_mkdir(ds3b->dfs, parent, dir, mode, 0);
-
-			if (rc != 0 && rc != EEXIST)
-				goto err_parent;
-
-			/* Open directory */
-			rc = dfs_lookup_rel(ds3b->dfs, parent, dir, O_RDWR, &dir_obj, NULL, NULL);
-			if (rc != 0)
-				goto err_parent;
-
-			/* Next parent */
-			if (parent) {
-				rc = dfs_release(parent);
-				if (rc != 0)
-					goto err_parent;
-			}
-			parent = dir_obj;
-		}
+		rc = ds3_obj_mkdir_parent(ds3b, parent_path, &parent);
+		if (rc != 0)
+			goto err_parent;
 	}
 
 	/* Finally create the file */
 	rc = dfs_open(ds3b->dfs, parent, file_name, mode | S_IFREG, O_RDWR | O_CREAT | O_TRUNC, 0,
 		      0, NULL, &ds3o_tmp->dfs_obj);
+	if (rc == 0) {
+		/*
+		 * The truncate keeps the xattrs, drop the part layout of an object completed in
+		 * place so the new data isn't read through it.
+		 */
+		rc = dfs_removexattr(ds3b->dfs, ds3o_tmp->dfs_obj, RGW_LAYOUT_XATTR);
+		if (rc == ENOENT)
+			rc = 0;
+		if (rc != 0)
+			dfs_release(ds3o_tmp->dfs_obj);
+	}
 	if (rc == 0)
 		*ds3o = ds3o_tmp;
 
@@ -118,6 +166,89 @@ err_ds3o:
 	return -rc;
 }
 
+/*
+ * Load the part layout of an object completed in place by ds3_upload_complete(), a plain object
+ * has no layout xattr.
+ */
+static int
+ds3_obj_layout_load(ds3_bucket_t *ds3b, ds3_obj_t *ds3o)
+{
+	daos_size_t size = 0;
+	int         rc;
+
+	rc = dfs_getxattr(ds3b->dfs, ds3o->dfs_obj, RGW_LAYOUT_XATTR, NULL, &size);
+	if (rc == ENODATA)
+		return 0;
+	if (rc != 0)
+		return rc;
+	if (size == 0 || size % sizeof(*ds3o->layout) != 0)
+		return EIO;
+
+	D_ALLOC(ds3o->layout, size);
+	if (ds3o->layout == NULL)
+		return ENOMEM;
+
+	rc = dfs_getxattr(ds3b->dfs, ds3o->dfs_obj, RGW_LAYOUT_XATTR, ds3o->layout, &size);
+	if (rc != 0) {
+		D_FREE(ds3o->layout);
+		return rc;
+	}
+	ds3o->layout_nr = size / sizeof(*ds3o->layout);
+	return 0;
+}
+
+/*
+ * Map [off, off + size) of an object completed in place to the ranges of its part slots.
+ * Returns the number of ranges, \a rgs is only filled if not NULL.
+ */
+static uint32_t
+ds3_obj_layout_map(ds3_obj_t *ds3o, daos_off_t off, daos_size_t size, daos_range_t *rgs)
+{
+	struct ds3_part_extent *pe;
+	daos_off_t              lo = 0;
+	daos_off_t              part_off;
+	daos_size_t             run_len;
+	daos_size_t             len;
+	uint32_t                nr = 0;
+	uint32_t                i;
+	uint32_t                j;
+
+	for (i = 0; i < ds3o->layout_nr && size > 0; i++) {
+		pe      = &ds3o->layout[i];
+		run_len = pe->pe_size * pe->pe_nr;
+		if (off >= lo + run_len) {
+			lo += run_len;
+			continue;
+		}
+
+		for (j = (off - lo) / pe->pe_size; j < pe->pe_nr && size > 0; j++) {
+			part_off = off - (lo + j * pe->pe_size);
+			len      = min(pe->pe_size - part_off, size);
+			if (rgs != NULL) {
+				rgs[nr].rg_idx = (pe->pe_slot + j) * MULTIPART_PART_STRIDE + part_off;
+				rgs[nr].rg_len = len;
+			}
+			nr++;
+			off += len;
+			size -= len;
+		}
+		lo += run_len;
+	}
+	return nr;
+}
+
+/* Logical size of an object completed in place */
+static daos_size_t
+ds3_obj_layout_size(ds3_obj_t *ds3o)
+{
+	daos_size_t size = 0;
+	uint32_t    i;
+
+	for (i = 0; i < ds3o->layout_nr; i++)
+		size += ds3o->layout[i].pe_size * ds3o->layout[i].pe_nr;
+	return size;
+}
+
 int
 ds3_obj_open(const char *key, ds3_obj_t **ds3o, ds3_bucket_t *ds3b)
 {
@@ -125,6 +256,7 @@ ds3_obj_open(const char *key, ds3_obj_t **ds3o, ds3_bucket_t *ds3b)
 	ds3_obj_t *ds3o_tmp;
 	char      *path;
 	size_t     suffix_location;
+	mode_t     mode;
 
 	if (ds3b == NULL || ds3o == NULL)
 		return -EINVAL;
@@ -148,7 +280,7 @@ ds3_obj_open(const char *key, ds3_obj_t **ds3o, ds3_bucket_t *ds3b)
 		strcpy(path, "/");
 	strcat(path, key);
 
-	rc = dfs_lookup(ds3b->dfs, path, O_RDWR, &ds3o_tmp->dfs_obj, NULL, NULL);
+	rc = dfs_lookup(ds3b->dfs, path, O_RDWR, &ds3o_tmp->dfs_obj, &mode, NULL);
 	if (rc == ENOENT) {
 		if (ends_with(path, LATEST_INSTANCE_SUFFIX)) {
 			/**
@@ -158,9 +290,14 @@ ds3_obj_open(const char *key, ds3_obj_t **ds3o, ds3_bucket_t *ds3b)
 			 */
 			suffix_location       = strlen(path) - strlen(LATEST_INSTANCE_SUFFIX);
 			path[suffix_location] = '\0';
-			rc = dfs_lookup(ds3b->dfs, path, O_RDWR, &ds3o_tmp->dfs_obj, NULL, NULL);
+			rc = dfs_lookup(ds3b->dfs, path, O_RDWR, &ds3o_tmp->dfs_obj, &mode, NULL);
 		}
 	}
+	if (rc == 0 && S_ISREG(mode)) {
+		rc = ds3_obj_layout_load(ds3b, ds3o_tmp);
+		if (rc != 0)
+			dfs_release(ds3o_tmp->dfs_obj);
+	}
 	if (rc == 0)
 		*ds3o = ds3o_tmp;
 
@@ -180,6 +317,7 @@ ds3_obj_close(ds3_obj_t *ds3o)
 		return -EINVAL;
 
 	rc = dfs_release(ds3o->dfs_obj);
+	D_FREE(ds3o->layout);
 	D_FREE(ds3o);
 	return -rc;
 }
@@ -207,7 +345,67 @@ ds3_obj_set_info(struct ds3_object_info *info, ds3_bucket_t *ds3b, ds3_obj_t *ds
 static int
 ds3_obj_int_cb(void *args, daos_event_t *ev, int ret)
 {
-	D_FREE(args);
+	ds3_obj_args_t *obj_args = args;
+
+	D_FREE(obj_args->iod.iod_rgs);
+	D_FREE(obj_args);
+	return 0;
+}
+
+/* Read an object completed in place, the ranges of the touched part slots in one list I/O */
+static int
+ds3_obj_read_layout(void *buf, daos_off_t off, daos_size_t *size, ds3_bucket_t *ds3b,
+		    ds3_obj_t *ds3o, daos_event_t *ev)
+{
+	ds3_obj_args_t *args;
+	daos_size_t     obj_size = ds3_obj_layout_size(ds3o);
+	daos_size_t     len;
+	int             rc;
+
+	if (off >= obj_size) {
+		*size = 0;
+		if (ev != NULL) {
+			daos_event_launch(ev);
+			daos_event_complete(ev, 0);
+		}
+		return 0;
+	}
+	len = min(*size, obj_size - off);
+
+	D_ALLOC_PTR(args);
+	if (args == NULL)
+		return -ENOMEM;
+
+	args->iod.iod_nr = ds3_obj_layout_map(ds3o, off, len, NULL);
+	D_ALLOC_ARRAY(args->iod.iod_rgs, args->iod.iod_nr);
+	if (args->iod.iod_rgs == NULL) {
+		D_FREE(args);
+		return -ENOMEM;
+	}
+	ds3_obj_layout_map(ds3o, off, len, args->iod.iod_rgs);
+
+	d_iov_set(&args->iov, buf, len);
+	args->sg.sg_nr     = 1;
+	args->sg.sg_iovs   = &args->iov;
+	args->sg.sg_nr_out = 1;
+
+	if (ev == NULL) {
+		rc = dfs_readx(ds3b->dfs, ds3o->dfs_obj, &args->iod, &args->sg, size, NULL);
+		ds3_obj_int_cb(args, NULL, rc);
+		return -rc;
+	}
+
+	daos_event_register_comp_cb(ev, ds3_obj_int_cb, args);
+	rc = dfs_readx(ds3b->dfs, ds3o->dfs_obj, &args->iod, &args->sg, size, ev);
+	if (rc != 0) {
+		/*
+		 * Failed before the event was launched. The callback can't be unregistered, so
+		 * complete the event with the error, which frees the args.
+		 */
+		daos_event_errno_rc(ev);
+		daos_event_launch(ev);
+		daos_event_complete(ev, daos_errno2der(rc));
+	}
 	return 0;
 }
 
@@ -237,6 +435,9 @@ ds3_obj_read(void *buf, daos_off_t off, daos_size_t *size, ds3_bucket_t *ds3b, d
 	if (ds3b == NULL || buf == NULL || ds3o == NULL)
 		return -EINVAL;
 
+	if (ds3o->layout != NULL)
+		return ds3_obj_read_layout(buf, off, size, ds3b, ds3o, ev);
+
 	if (ev == NULL) {
 		d_iov_t     iov;
 		d_sg_list_t rsgl;
@@ -267,6 +468,8 @@ ds3_obj_destroy(const char *key, ds3_bucket_t *ds3b)
 		return -EINVAL;
 	if (key == NULL || strnlen(key, DS3_MAX_KEY) > DS3_MAX_KEY - 1)
 		return -EINVAL;
+	if (is_multipart_data(key))
+		return -EINVAL;
 
 	D_STRNDUP(path, key, DS3_MAX_KEY_BUFF - 1);
 	if (path == NULL)
@@ -333,6 +536,10 @@ ds3_obj_write(void *buf, daos_off_t off, daos_size_t *size, ds3_bucket_t *ds3b,
 	if (ds3b == NULL || buf == NULL || ds3o == NULL)
 		return -EINVAL;
 
+	/* Objects completed in place are immutable, data lives in the part slots */
+	if (ds3o->layout != NULL)
+		return -ENOTSUP;
+
 	if (ev == NULL) {
 		d_iov_t     iov;
 		d_sg_list_t wsgl;
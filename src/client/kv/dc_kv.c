@@ -650,3 +650,171 @@ err_task:
 		kv_decref(kv);
 	return rc;
 }
+
+static int
+multi_get_comp_cb(tse_task_t *task, void *data)
+{
+	daos_kv_req_t		*req = *((daos_kv_req_t **)data);
+	daos_obj_fetch_t	*args = daos_task_get_args(task);
+
+	req->kvr_rc = task->dt_result;
+	if (task->dt_result == 0 || task->dt_result == -DER_REC2BIG)
+		req->kvr_size = args->iods[0].iod_size;
+	return 0;
+}
+
+static int
+multi_put_comp_cb(tse_task_t *task, void *data)
+{
+	daos_kv_req_t	*req = *((daos_kv_req_t **)data);
+
+	req->kvr_rc = task->dt_result;
+	return 0;
+}
+
+static int
+kv_multi_io_task(tse_task_t *task, struct dc_kv *kv, daos_kv_multi_t *args, bool is_put,
+		 daos_kv_req_t *req, struct io_params *params, tse_task_t **io_task)
+{
+	tse_sched_t	*sched = tse_task2sched(task);
+	int		 rc;
+
+	/** init dkey */
+	d_iov_set(&params->dkey, (void *)req->kvr_key, strlen(req->kvr_key));
+
+	/** init iod. */
+	params->akey_val = '0';
+	d_iov_set(&params->iod.iod_name, &params->akey_val, 1);
+	params->iod.iod_nr	= 1;
+	params->iod.iod_recxs	= NULL;
+	params->iod.iod_size	= req->kvr_size;
+	params->iod.iod_type	= DAOS_IOD_SINGLE;
+
+	/** init sgl, same as dc_kv_put()/dc_kv_get() */
+	if (is_put || (req->kvr_buf && req->kvr_size)) {
+		d_iov_set(&params->iov, req->kvr_buf, req->kvr_size);
+		params->sgl.sg_iovs = &params->iov;
+		params->sgl.sg_nr = 1;
+	}
+
+	if (is_put) {
+		daos_obj_update_t	*update_args;
+
+		rc = daos_task_create(DAOS_OPC_OBJ_UPDATE, sched, 0, NULL, io_task);
+		if (rc != 0)
+			return rc;
+
+		update_args = daos_task_get_args(*io_task);
+		update_args->oh		= kv->daos_oh;
+		update_args->th		= args->th;
+		update_args->flags	= args->flags;
+		update_args->dkey	= &params->dkey;
+		update_args->nr		= 1;
+		update_args->iods	= &params->iod;
+		update_args->sgls	= &params->sgl;
+	} else {
+		daos_obj_fetch_t	*fetch_args;
+
+		rc = daos_task_create(DAOS_OPC_OBJ_FETCH, sched, 0, NULL, io_task);
+		if (rc != 0)
+			return rc;
+
+		fetch_args = daos_task_get_args(*io_task);
+		fetch_args->oh		= kv->daos_oh;
+		fetch_args->th		= args->th;
+		fetch_args->flags	= args->flags;
+		fetch_args->dkey	= &params->dkey;
+		fetch_args->nr		= 1;
+		fetch_args->iods	= &params->iod;
+		if (req->kvr_buf && req->kvr_size)
+			fetch_args->sgls = &params->sgl;
+	}
+
+	rc = tse_task_register_comp_cb(*io_task, is_put ? multi_put_comp_cb : multi_get_comp_cb,
+				       &req, sizeof(req));
+	if (rc != 0) {
+		tse_task_complete(*io_task, rc);
+		*io_task = NULL;
+	}
+	return rc;
+}
+
+/*
+ * Object I/O carries a single dkey, so each key still has its own RPC and nothing is
+ * batched per target. This only saves the caller one event per key: the I/O tasks
+ * are all created here and the caller waits for a single completion.
+ */
+static int
+kv_multi(tse_task_t *task, bool is_put)
+{
+	daos_kv_multi_t		*args = daos_task_get_args(task);
+	struct dc_kv		*kv = NULL;
+	struct io_params	*params = NULL;
+	tse_task_t		*io_task;
+	d_list_t		 io_task_list;
+	bool			 free_params = true;
+	unsigned int		 i;
+	int			 rc;
+
+	D_INIT_LIST_HEAD(&io_task_list);
+
+	if (args->nr == 0 || args->reqs == NULL)
+		D_GOTO(err_task, rc = -DER_INVAL);
+
+	for (i = 0; i < args->nr; i++) {
+		if (args->reqs[i].kvr_key == NULL)
+			D_GOTO(err_task, rc = -DER_INVAL);
+	}
+
+	kv = kv_hdl2ptr(args->oh);
+	if (kv == NULL)
+		D_GOTO(err_task, rc = -DER_NO_HDL);
+
+	D_ALLOC_ARRAY(params, args->nr);
+	if (params == NULL)
+		D_GOTO(err_task, rc = -DER_NOMEM);
+
+	for (i = 0; i < args->nr; i++) {
+		args->reqs[i].kvr_rc = 0;
+		rc = kv_multi_io_task(task, kv, args, is_put, &args->reqs[i], &params[i],
+				      &io_task);
+		if (rc != 0)
+			D_GOTO(err_iotask, rc);
+		tse_task_list_add(io_task, &io_task_list);
+	}
+
+	rc = tse_task_register_comp_cb(task, free_io_params_cb, &params, sizeof(params));
+	if (rc != 0)
+		D_GOTO(err_iotask, rc);
+	free_params = false;
+
+	rc = tse_task_depend_list(task, &io_task_list);
+	if (rc != 0)
+		D_GOTO(err_iotask, rc);
+
+	tse_task_list_sched(&io_task_list, true);
+	kv_decref(kv);
+	return 0;
+
+err_iotask:
+	tse_task_list_abort(&io_task_list, rc);
+err_task:
+	tse_task_complete(task, rc);
+	if (free_params)
+		D_FREE(params);
+	if (kv)
+		kv_decref(kv);
+	return rc;
+}
+
+int
+dc_kv_multi_put(tse_task_t *task)
+{
+	return kv_multi(task, true);
+}
+
+int
+dc_kv_multi_get(tse_task_t *task)
+{
+	return kv_multi(task, false);
+}
@@ -233,14 +233,37 @@ class DDictIter():
         raise StopIteration()
 
 
+class DKVRead():
+    # pylint: disable=too-few-public-methods
+    """
+    Bulk read in flight, see DDict.bget_into(). The target buffer must not be
+    used until wait() returns.
+    """
+    def __init__(self, hdl):
+        self._hdl = hdl
+        self._sizes = None
+
+    def wait(self):
+        """Wait for the reads to complete, return the size of each value."""
+        if self._sizes is None:
+            (ret, sizes) = pydaos_shim.kv_wait(DAOS_MAGIC, self._hdl)
+            if ret != pydaos_shim.DER_SUCCESS:
+                raise PyDError("failed to retrieve KV values", ret)
+            self._sizes = sizes
+        return self._sizes
+
+
 class DDict(_DObj):
     """
     Class representing of DAOS dictionary (i.e. key-value store object).
-    Only strings are supported for both the key and value for now.
+    Keys are strings. Values are stored from strings or any object supporting
+    the buffer protocol (bytes, bytearray, memoryview, numpy arrays ...) without
+    being copied, and are returned as bytes.
     Key-value pair can be inserted/looked up once at a time (see put/get) or
     in bulk (see bput/bget) taking a python dict as an input. The bulk
     operations are issued in parallel (up to 16 operations in flight) to
-    maximize the operation rate.
+    maximize the operation rate. The GIL is released while waiting for DAOS
+    unless the global event queue is used (PYDAOS_GLOB_EQ, the default).
     Key-value pair are deleted via the put/bput operations by setting the value
     to either None or the empty string. Once deleted, the key won't be reported
     during iteration.
@@ -277,6 +300,13 @@ class DDict(_DObj):
         Put operations are issued in parallel over the network.
         If the value is set to None or an empty string, the key is deleted from
         the DAOS dictionary.
+    bget_into(keys, buf, slot_size, wait=True)
+        Bulk get the values of a list of keys directly into buf, a writable
+        buffer (bytearray, memoryview, numpy array ...), the value of keys[i]
+        being stored at offset i * slot_size. Returns the list of value sizes,
+        0 for a missing key. A value larger than slot_size isn't read. With
+        wait=False, a DKVRead is returned as soon as the reads are issued and
+        its wait() method returns the sizes.
     dump()
         Fetch all the key-value pairs and return them in a python dictionary.
     """
@@ -342,6 +372,17 @@ class DDict(_DObj):
         if ret != pydaos_shim.DER_SUCCESS:
             raise PyDError("failed to store KV value", ret)
 
+    def bget_into(self, keys, buf, slot_size, wait=True):
+        """Bulk get the values of keys into a preallocated buffer."""
+        (ret, hdl) = pydaos_shim.kv_get_into(DAOS_MAGIC, self.oh, list(keys),
+                                             buf, slot_size)
+        if ret != pydaos_shim.DER_SUCCESS:
+            raise PyDError("failed to retrieve KV values", ret)
+        req = DKVRead(hdl)
+        if not wait:
+            return req
+        return req.wait()
+
     def dump(self):
         """Fetch all the key-value pairs, return them in a python dictionary."""
         # leverage python iterator, see __iter__/__next__ below
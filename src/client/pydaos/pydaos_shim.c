@@ -902,13 +902,53 @@ __shim_handle__kv_close(PyObject *self, PyObject *args)
 
 struct kv_op {
 	daos_event_t	 ev;
+	/** referenced until the request completes */
 	PyObject	*key_obj;
-	char		*key;
+	const char	*key;
 	char		*buf;
 	daos_size_t	 size;
 	daos_size_t	buf_size;
+	/** value of a put, held until the request completes */
+	Py_buffer	 view;
+	bool		 has_view;
 };
 
+static inline const char *
+kv_key_str(PyObject *key)
+{
+	if (PyUnicode_Check(key))
+		return PyUnicode_AsUTF8(key);
+	return PyString_AsString(key);
+}
+
+static void
+kv_op_release(struct kv_op *op)
+{
+	if (op->has_view) {
+		PyBuffer_Release(&op->view);
+		op->has_view = false;
+	}
+	Py_CLEAR(op->key_obj);
+}
+
+/**
+ * Wait for one in-flight request. glob_eq is shared by all the python threads, which would reap
+ * each other's events, so the GIL is only released while polling a private EQ.
+ */
+static int
+kv_eq_poll(daos_handle_t eq, daos_event_t **evp)
+{
+	int rc;
+
+	if (use_glob_eq)
+		return daos_eq_poll(eq, 1, DAOS_EQ_WAIT, 1, evp);
+
+	Py_BEGIN_ALLOW_THREADS
+	rc = daos_eq_poll(eq, 1, DAOS_EQ_WAIT, 1, evp);
+	Py_END_ALLOW_THREADS
+	return rc;
+}
+
 static inline int
 kv_get_comp(struct kv_op *op, PyObject *daos_dict)
 {
@@ -937,6 +977,27 @@ kv_get_comp(struct kv_op *op, PyObject *daos_dict)
 	return rc;
 }
 
+/** fetch again a value which didn't fit in the buffer of \a op */
+static int
+kv_get_refetch(daos_handle_t oh, daos_handle_t eq, struct kv_op *op)
+{
+	char	*new_buff;
+	int	 rc;
+
+	D_REALLOC_NZ(new_buff, op->buf, op->size);
+	if (new_buff == NULL)
+		return -DER_NOMEM;
+	op->buf_size = op->size;
+	op->buf = new_buff;
+
+	daos_event_fini(&op->ev);
+	rc = daos_event_init(&op->ev, eq, NULL);
+	if (rc != -DER_SUCCESS)
+		return rc;
+
+	return daos_kv_get(oh, DAOS_TX_NONE, 0, op->key, &op->size, op->buf, &op->ev);
+}
+
 static PyObject *
 __shim_handle__kv_get(PyObject *self, PyObject *args)
 {
@@ -948,6 +1009,7 @@ __shim_handle__kv_get(PyObject *self, PyObject *args)
 	struct kv_op	*kv_array = NULL;
 	struct kv_op	*op;
 	daos_event_t	*evp;
+	bool		 py_err = false;
 	int		 i = 0;
 	int		 rc = 0;
 	int		 ret;
@@ -994,7 +1056,7 @@ __shim_handle__kv_get(PyObject *self, PyObject *args)
 			 * for one i/o to complete to reuse the slot
 			 */
 rewait:
-			rc = daos_eq_poll(eq, 1, DAOS_EQ_WAIT, 1, &evp);
+			rc = kv_eq_poll(eq, &evp);
 			if (rc < 0)
 				break;
 			if (rc == 0) {
@@ -1005,96 +1067,72 @@ rewait:
 			op = container_of(evp, struct kv_op, ev);
 
 			/** check result of completed operation */
-			if (evp->ev_error == DER_SUCCESS) {
-				rc = kv_get_comp(op, daos_dict);
-				if (rc != DER_SUCCESS)
-					D_GOTO(err, rc);
-				/* Reset the size of the request */
-				op->size = op->buf_size;
-				evp->ev_error = 0;
-			} else if (evp->ev_error == -DER_REC2BIG) {
-				char *new_buff;
-
-				D_REALLOC_NZ(new_buff, op->buf, op->size);
-				if (new_buff == NULL) {
-					rc = -DER_NOMEM;
+			if (evp->ev_error == -DER_REC2BIG) {
+				rc = kv_get_refetch(oh, eq, op);
+				if (rc != -DER_SUCCESS) {
+					kv_op_release(op);
 					break;
 				}
-				op->buf_size = op->size;
-				op->buf = new_buff;
-
-				daos_event_fini(evp);
-				rc = daos_event_init(evp, eq, NULL);
-				if (rc != -DER_SUCCESS)
-					break;
+				goto rewait;
+			}
 
-				rc = daos_kv_get(oh, DAOS_TX_NONE, 0, op->key,
-						&op->size, op->buf, evp);
-				if (rc != -DER_SUCCESS)
-					break;
-				D_GOTO(rewait, rc);
+			if (evp->ev_error == DER_SUCCESS) {
+				rc = kv_get_comp(op, daos_dict);
+				if (rc != DER_SUCCESS)
+					py_err = true;
 			} else {
 				rc = evp->ev_error;
-				break;
 			}
+			kv_op_release(op);
+			if (rc != DER_SUCCESS)
+				break;
+
+			/* Reset the size of the request */
+			op->size = op->buf_size;
+			evp->ev_error = 0;
 		}
 
 		/** submit get request */
+		op->key = kv_key_str(key);
+		if (!op->key) {
+			py_err = true;
+			break;
+		}
+		Py_INCREF(key);
 		op->key_obj = key;
 
-		if (PyUnicode_Check(key)) {
-			op->key = (char *)PyUnicode_AsUTF8(key);
-		} else {
-			op->key = PyString_AsString(key);
-		}
-		if (!op->key)
-			D_GOTO(err, rc = 0);
 		rc = daos_kv_get(oh, DAOS_TX_NONE, 0, op->key, &op->size,
 				 op->buf, evp);
 		if (rc) {
+			kv_op_release(op);
 			break;
 		}
 	}
 
 	/** wait for completion of all in-flight requests */
 	do {
-		ret = daos_eq_poll(eq, 1, DAOS_EQ_WAIT, 1, &evp);
-		if (ret == 1) {
-			int rc2;
+		ret = kv_eq_poll(eq, &evp);
+		if (ret != 1)
+			break;
 
-			op = container_of(evp, struct kv_op, ev);
+		op = container_of(evp, struct kv_op, ev);
 
-			/** check result of completed operation */
-			if (evp->ev_error == DER_SUCCESS) {
-				rc2 = kv_get_comp(op, daos_dict);
-				if (rc == DER_SUCCESS && rc2 != DER_SUCCESS)
-					D_GOTO(err, rc = rc2);
+		/** check result of completed operation */
+		if (evp->ev_error == -DER_REC2BIG && rc == DER_SUCCESS) {
+			rc = kv_get_refetch(oh, eq, op);
+			if (rc == -DER_SUCCESS)
 				continue;
-			} else if (evp->ev_error == -DER_REC2BIG) {
-				char *new_buff;
-
-				daos_event_fini(evp);
-				rc2 = daos_event_init(evp, eq, NULL);
-
-				D_REALLOC_NZ(new_buff, op->buf, op->size);
-				if (new_buff == NULL)
-					D_GOTO(out, rc = -DER_NOMEM);
-
-				op->buf_size = op->size;
-				op->buf = new_buff;
-
-				rc2 = daos_kv_get(oh, DAOS_TX_NONE, 0, op->key,
-						&op->size, op->buf, evp);
-				if (rc2 != -DER_SUCCESS)
-					D_GOTO(out, rc = rc2);
-			} else {
-				if (rc == DER_SUCCESS)
-					rc = evp->ev_error;
+		} else if (evp->ev_error == DER_SUCCESS) {
+			if (rc == DER_SUCCESS && !py_err) {
+				rc = kv_get_comp(op, daos_dict);
+				if (rc != DER_SUCCESS)
+					py_err = true;
 			}
-		}
-		if (rc == DER_SUCCESS && ret == 1)
+		} else if (rc == DER_SUCCESS) {
 			rc = evp->ev_error;
-	} while (ret == 1);
+		}
+		kv_op_release(op);
+	} while (1);
 
 	if (rc == DER_SUCCESS && ret < 0)
 		rc = ret;
@@ -1115,17 +1153,197 @@ out:
 			rc = ret;
 	}
 
+	if (py_err)
+		return NULL;
+
 	/* Populate return list */
 	return PyInt_FromLong(rc);
+}
 
-err:
-	if (!use_glob_eq)
-		daos_eq_destroy(eq, DAOS_EQ_DESTROY_FORCE);
-	D_FREE(kv_array);
+/** batched read into a caller buffer, in flight until kv_wait() */
+struct kv_get_into {
+	daos_event_t	 gi_ev;
+	bool		 gi_launched;
+	bool		 gi_waited;
+	int		 gi_rc;
+	int		 gi_nr;
+	/** caller buffer, value i is read at offset i * slot size */
+	Py_buffer	 gi_view;
+	/** tuple of the keys, referenced until the read is over */
+	PyObject	*gi_keys;
+	daos_kv_req_t	 gi_reqs[0];
+};
+
+static void
+kv_get_into_wait(struct kv_get_into *gi)
+{
+	bool	flag = false;
+	int	rc;
+
+	if (!gi->gi_launched || gi->gi_waited)
+		return;
+
+	Py_BEGIN_ALLOW_THREADS
+	rc = daos_event_test(&gi->gi_ev, DAOS_EQ_WAIT, &flag);
+	Py_END_ALLOW_THREADS
+	gi->gi_rc = rc ?: gi->gi_ev.ev_error;
+	gi->gi_waited = true;
+}
+
+static void
+kv_get_into_free(struct kv_get_into *gi)
+{
+	/** the buffer can't be released while DAOS writes into it */
+	kv_get_into_wait(gi);
+	if (gi->gi_launched)
+		daos_event_fini(&gi->gi_ev);
+	PyBuffer_Release(&gi->gi_view);
+	Py_XDECREF(gi->gi_keys);
+	D_FREE(gi);
+}
+
+static void
+kv_get_into_destructor(PyObject *capsule)
+{
+	kv_get_into_free(PyCapsule_GetPointer(capsule, "kv_get_into"));
+}
+
+/**
+ * Read the values of a list of keys into a writable buffer (bytearray, memoryview, numpy array
+ * ...) without going through python objects, value i landing at offset i * slot_size. The
+ * fetches are issued as a single multi get and the GIL is released, the read is completed and
+ * the value sizes are returned by kv_wait().
+ */
+static PyObject *
+__shim_handle__kv_get_into(PyObject *self, PyObject *args)
+{
+	struct kv_get_into	*gi;
+	PyObject		*return_list;
+	PyObject		*keys;
+	PyObject		*buf;
+	PyObject		*capsule;
+	daos_handle_t		 oh;
+	Py_ssize_t		 slot_size;
+	Py_ssize_t		 nr;
+	Py_ssize_t		 i;
+	int			 rc;
 
+	/* Parse arguments */
+	RETURN_NULL_IF_FAILED_TO_PARSE(args, "LO!On", &oh.cookie, &PyList_Type, &keys, &buf,
+				       &slot_size);
+
+	nr = PyList_Size(keys);
+	D_ALLOC(gi, sizeof(*gi) + nr * sizeof(gi->gi_reqs[0]));
+	if (gi == NULL)
+		return PyErr_NoMemory();
+
+	if (PyObject_GetBuffer(buf, &gi->gi_view, PyBUF_WRITABLE) < 0) {
+		D_FREE(gi);
+		return NULL;
+	}
+
+	capsule = PyCapsule_New(gi, "kv_get_into", kv_get_into_destructor);
+	if (capsule == NULL) {
+		kv_get_into_free(gi);
+		return NULL;
+	}
+
+	if (slot_size <= 0 || slot_size * nr > gi->gi_view.len) {
+		PyErr_SetString(PyExc_ValueError, "buffer too small for the values");
+		D_GOTO(err, rc = 0);
+	}
+
+	/** the caller may modify its list while the read is in flight */
+	gi->gi_keys = PyList_AsTuple(keys);
+	if (gi->gi_keys == NULL)
+		D_GOTO(err, rc = 0);
+
+	for (i = 0; i < nr; i++) {
+		daos_kv_req_t *req = &gi->gi_reqs[i];
+
+		req->kvr_key = kv_key_str(PyTuple_GET_ITEM(gi->gi_keys, i));
+		if (req->kvr_key == NULL)
+			D_GOTO(err, rc = 0);
+		req->kvr_buf  = (char *)gi->gi_view.buf + i * slot_size;
+		req->kvr_size = slot_size;
+	}
+	gi->gi_nr = nr;
+
+	if (nr == 0)
+		D_GOTO(out, rc = 0);
+
+	/** not on glob_eq, kv_get() and kv_put() would reap it when polling */
+	rc = daos_event_init(&gi->gi_ev, DAOS_HDL_INVAL, NULL);
+	if (rc)
+		D_GOTO(out, rc);
+
+	Py_BEGIN_ALLOW_THREADS
+	rc = daos_kv_multi_get(oh, DAOS_TX_NONE, 0, nr, gi->gi_reqs, &gi->gi_ev);
+	Py_END_ALLOW_THREADS
+	gi->gi_launched = true;
+
+out:
+	if (rc != 0 && rc != -DER_REC2BIG) {
+		Py_DECREF(capsule);
+		capsule = Py_None;
+		Py_INCREF(capsule);
+	}
+
+	/* Populate return list */
+	return_list = PyList_New(2);
+	PyList_SetItem(return_list, 0, PyInt_FromLong(rc == -DER_REC2BIG ? 0 : rc));
+	PyList_SetItem(return_list, 1, capsule);
+
+	return return_list;
+err:
+	Py_DECREF(capsule);
 	return NULL;
 }
 
+/**
+ * Complete a read started by kv_get_into() and return the size of each value, 0 for keys which
+ * don't exist. A value larger than the slot isn't read, its size is reported nevertheless.
+ */
+static PyObject *
+__shim_handle__kv_wait(PyObject *self, PyObject *args)
+{
+	struct kv_get_into	*gi;
+	PyObject		*return_list;
+	PyObject		*capsule;
+	PyObject		*sizes;
+	int			 i;
+	int			 rc;
+
+	/* Parse arguments */
+	RETURN_NULL_IF_FAILED_TO_PARSE(args, "O", &capsule);
+
+	gi = PyCapsule_GetPointer(capsule, "kv_get_into");
+	if (gi == NULL)
+		return NULL;
+
+	kv_get_into_wait(gi);
+	rc = gi->gi_rc == -DER_REC2BIG ? 0 : gi->gi_rc;
+
+	sizes = PyList_New(gi->gi_nr);
+	if (sizes == NULL)
+		return NULL;
+
+	for (i = 0; i < gi->gi_nr; i++) {
+		daos_kv_req_t *req = &gi->gi_reqs[i];
+
+		if (rc == 0 && req->kvr_rc != 0 && req->kvr_rc != -DER_REC2BIG)
+			rc = req->kvr_rc;
+		PyList_SetItem(sizes, i, PyLong_FromSize_t(req->kvr_size));
+	}
+
+	/* Populate return list */
+	return_list = PyList_New(2);
+	PyList_SetItem(return_list, 0, PyInt_FromLong(rc));
+	PyList_SetItem(return_list, 1, sizes);
+
+	return return_list;
+}
+
 static PyObject *
 __shim_handle__kv_put(PyObject *self, PyObject *args)
 {
@@ -1135,8 +1353,10 @@ __shim_handle__kv_put(PyObject *self, PyObject *args)
 	PyObject	*value;
 	Py_ssize_t	 pos = 0;
 	daos_handle_t	 eq;
-	daos_event_t	 ev_array[MAX_INFLIGHT];
+	struct kv_op	*kv_array = NULL;
+	struct kv_op	*op;
 	daos_event_t	*evp;
+	bool		 py_err = false;
 	int		 i = 0;
 	int		 rc = 0;
 	int		 ret;
@@ -1153,14 +1373,20 @@ __shim_handle__kv_put(PyObject *self, PyObject *args)
 		eq = glob_eq;
 	}
 
+	D_ALLOC_ARRAY(kv_array, MAX_INFLIGHT);
+	if (kv_array == NULL) {
+		rc = -DER_NOMEM;
+		goto out;
+	}
+
 	while (PyDict_Next(daos_dict, &pos, &key, &value)) {
-		char		*buf;
-		daos_size_t	 size;
-		char		*key_str;
+		daos_size_t	 size = 0;
+		const char	*key_str;
 
 		if (i < MAX_INFLIGHT) {
 			/** haven't reached max request in flight yet */
-			evp = &ev_array[i];
+			op = &kv_array[i];
+			evp = &op->ev;
 			rc = daos_event_init(evp, eq, NULL);
 			if (rc)
 				break;
@@ -1170,7 +1396,7 @@ __shim_handle__kv_put(PyObject *self, PyObject *args)
 			 * max request request in flight reached, wait
 			 * for one i/o to complete to reuse the slot
 			 */
-			rc = daos_eq_poll(eq, 1, DAOS_EQ_WAIT, 1, &evp);
+			rc = kv_eq_poll(eq, &evp);
 			if (rc < 0)
 				break;
 			if (rc == 0) {
@@ -1178,6 +1404,9 @@ __shim_handle__kv_put(PyObject *self, PyObject *args)
 				break;
 			}
 
+			op = container_of(evp, struct kv_op, ev);
+			kv_op_release(op);
+
 			/** check if completed operation failed */
 			if (evp->ev_error != DER_SUCCESS) {
 				rc = evp->ev_error;
@@ -1186,52 +1415,69 @@ __shim_handle__kv_put(PyObject *self, PyObject *args)
 			evp->ev_error = 0;
 		}
 
-		/** XXX: Interpret all values as strings for now */
-		if (value == Py_None) {
-			size = 0;
-		} else if (PyUnicode_Check(value)) {
-			Py_ssize_t pysize = 0;
-
-			buf = (char *)PyUnicode_AsUTF8AndSize(value, &pysize);
-			size = pysize;
-		} else {
-			Py_ssize_t pysize = 0;
+		key_str = kv_key_str(key);
+		if (!key_str) {
+			py_err = true;
+			break;
+		}
 
-			rc = PyBytes_AsStringAndSize(value, &buf, &pysize);
-			if (buf == NULL || rc != 0)
-				D_GOTO(err, rc);
+		if (value != Py_None) {
+			if (PyUnicode_Check(value)) {
+				Py_ssize_t	 pysize = 0;
+				const char	*buf;
 
-			size = pysize;
+				buf = PyUnicode_AsUTF8AndSize(value, &pysize);
+				if (buf == NULL) {
+					py_err = true;
+					break;
+				}
+				/** str has no buffer interface, expose its UTF-8 form */
+				rc = PyBuffer_FillInfo(&op->view, value, (void *)buf, pysize, 1,
+						       PyBUF_SIMPLE);
+			} else {
+				/** bytes, bytearray, memoryview, numpy arrays ... are sent as is */
+				rc = PyObject_GetBuffer(value, &op->view, PyBUF_SIMPLE);
+			}
+			if (rc < 0) {
+				py_err = true;
+				break;
+			}
+			op->has_view = true;
+			size = op->view.len;
 		}
 
-		if (PyUnicode_Check(key)) {
-			key_str = (char *)PyUnicode_AsUTF8(key);
-		} else {
-			key_str = PyString_AsString(key);
-		}
-		if (!key_str)
-			D_GOTO(err, rc = 0);
+		/** the key and the value are held until the request completes */
+		Py_INCREF(key);
+		op->key_obj = key;
 
 		/** insert or delete kv pair */
 		if (size == 0)
 			rc = daos_kv_remove(oh, DAOS_TX_NONE, 0, key_str, evp);
 		else
 			rc = daos_kv_put(oh, DAOS_TX_NONE, 0, key_str, size,
-					 buf, evp);
-		if (rc)
+					 op->view.buf, evp);
+		if (rc) {
+			kv_op_release(op);
 			break;
+		}
 	}
 
 	/** wait for completion of all in-flight requests */
 	do {
-		ret = daos_eq_poll(eq, 1, DAOS_EQ_WAIT, 1, &evp);
-		if (rc == DER_SUCCESS && ret == 1)
-			rc = evp->ev_error;
+		ret = kv_eq_poll(eq, &evp);
+		if (ret == 1) {
+			kv_op_release(container_of(evp, struct kv_op, ev));
+			if (rc == DER_SUCCESS)
+				rc = evp->ev_error;
+		}
 	} while (ret == 1);
 
 	if (rc == DER_SUCCESS && ret < 0)
 		rc = ret;
 
+out:
+	D_FREE(kv_array);
+
 	/** destroy event queue */
 	if (!use_glob_eq) {
 		ret = daos_eq_destroy(eq, 0);
@@ -1239,11 +1485,10 @@ __shim_handle__kv_put(PyObject *self, PyObject *args)
 			rc = ret;
 	}
 
+	if (py_err)
+		return NULL;
+
 	return PyInt_FromLong(rc);
-err:
-	if (!use_glob_eq)
-		daos_eq_destroy(eq, 0);
-	return NULL;
 }
 
 static PyObject *
@@ -1440,6 +1685,8 @@ static PyMethodDef daosMethods[] = {
 	EXPORT_PYTHON_METHOD(kv_close),
 	EXPORT_PYTHON_METHOD(kv_get),
 	EXPORT_PYTHON_METHOD(kv_put),
+	EXPORT_PYTHON_METHOD(kv_get_into),
+	EXPORT_PYTHON_METHOD(kv_wait),
 	EXPORT_PYTHON_METHOD(kv_iter),
 
 	/** Array operations */
@@ -80,6 +80,10 @@ daos_props_2cont_props(daos_prop_t *props, struct cont_props *cont_prop)
 	/** object version */
 	if (daos_prop_entry_get(props, DAOS_PROP_CO_OBJ_VERSION) != NULL)
 		cont_prop->dcp_obj_version = daos_cont_prop2obj_version(props);
+
+	/** EC degraded read reconstruction */
+	if (daos_prop_entry_get(props, DAOS_PROP_CO_EC_RECOV) != NULL)
+		cont_prop->dcp_ec_srv_recov = daos_cont_prop2ec_srv_recov(props);
 }
 
 uint16_t
@@ -276,6 +280,15 @@ daos_cont_prop2perf_domain(daos_prop_t *props)
 			      (uint32_t)prop->dpe_val;
 }
 
+bool
+daos_cont_prop2ec_srv_recov(daos_prop_t *props)
+{
+	struct daos_prop_entry *prop =
+		daos_prop_entry_get(props, DAOS_PROP_CO_EC_RECOV);
+
+	return prop == NULL ? false : prop->dpe_val == DAOS_PROP_CO_EC_RECOV_SERVER;
+}
+
 uint32_t
 daos_cont_prop2global_version(daos_prop_t *props)
 {
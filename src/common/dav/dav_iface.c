@@ -94,6 +94,10 @@ dav_obj_open_internal(int fd, int flags, size_t sz, const char *path, struct ume
 	if (hdl->do_store->stor_priv == NULL) {
 		D_ERROR("meta context not defined. WAL commit disabled for %s\n", path);
 	} else {
+		/*
+		 * The whole heap is mapped: DAV dereferences heap memory directly
+		 * instead of loading and pinning the pages it accesses.
+		 */
 		rc = umem_cache_alloc(store, 0);
 		if (rc != 0) {
 			D_ERROR("Could not allocate page cache: rc=" DF_RC "\n", DP_RC(rc));
@@ -12,6 +12,7 @@
  */
 #define D_LOGFAC	DD_FAC(common)
 
+#include <sys/mman.h>
 #include <daos/common.h>
 #include <daos/mem.h>
 #ifdef DAOS_PMEM_BUILD
@@ -1685,7 +1686,9 @@ struct umem_page_info {
 	struct umem_page *pi_page;
 	/** Page flags */
 	uint64_t          pi_waiting : 1, /** Page is copied, but waiting for commit */
-	    pi_copying               : 1; /** Page is being copied. Blocks writes. */
+	    pi_copying               : 1, /** Page is being copied. Blocks writes. */
+	    pi_loading               : 1, /** Page is being read from the store */
+	    pi_lru                   : 1; /** Page is clean, on the LRU list */
 	/** Highest transaction ID checkpointed.  This is set before the page is copied. The
 	 *  checkpoint will not be executed until the last committed ID is greater than or
 	 *  equal to this value.  If that's not the case immediately, the waiting flag is set
@@ -1694,6 +1697,10 @@ struct umem_page_info {
 	uint64_t pi_last_checkpoint;
 	/** Highest transaction ID of writes to the page */
 	uint64_t pi_last_inflight;
+	/** Lowest transaction ID of the writes not copied by a checkpoint yet, -1 if none */
+	uint64_t pi_first_dirty;
+	/** pi_first_dirty when the page was copied, restored if the flush fails */
+	uint64_t pi_flush_first;
 	/** link chain on global dirty list, LRU list, or free info list */
 	d_list_t pi_link;
 	/** page memory address */
@@ -1717,12 +1724,8 @@ umem_cache_alloc(struct umem_store *store, uint64_t max_mapped)
 
 	num_pages = (store->stor_size + UMEM_CACHE_PAGE_SZ - 1) >> UMEM_CACHE_PAGE_SZ_SHIFT;
 
-	if (max_mapped != 0) {
-		D_ERROR("Setting max_mapped is unsupported at present\n");
-		return -DER_NOTSUPPORTED;
-	}
-
-	max_mapped = num_pages;
+	if (max_mapped == 0 || max_mapped > num_pages)
+		max_mapped = num_pages;
 
 	D_ALLOC(cache, sizeof(*cache) + sizeof(cache->ca_pages[0]) * num_pages +
 			   sizeof(cache->ca_pages[0].pg_info[0]) * max_mapped);
@@ -1730,12 +1733,12 @@ umem_cache_alloc(struct umem_store *store, uint64_t max_mapped)
 		D_GOTO(error, rc = -DER_NOMEM);
 
 	D_DEBUG(DB_IO,
-		"Allocated page cache for stor->stor_size=" DF_U64 ", " DF_U64 " pages at %p\n",
-		store->stor_size, num_pages, cache);
+		"Allocated page cache for stor->stor_size=" DF_U64 ", " DF_U64 "/" DF_U64
+		" pages at %p\n", store->stor_size, max_mapped, num_pages, cache);
 
 	cache->ca_store      = store;
 	cache->ca_num_pages  = num_pages;
-	cache->ca_max_mapped = num_pages;
+	cache->ca_max_mapped = max_mapped;
 
 	D_INIT_LIST_HEAD(&cache->ca_pgs_dirty);
 	D_INIT_LIST_HEAD(&cache->ca_pgs_copying);
@@ -1782,11 +1785,74 @@ umem_cache_check(struct umem_store *store, uint64_t num_pages)
 	return 0;
 }
 
+/** Length of the page in the store, the last one can be partial */
+static inline uint64_t
+cache_page_len(struct umem_cache *cache, struct umem_page *page)
+{
+	uint64_t off = (uint64_t)page->pg_id << UMEM_CACHE_PAGE_SZ_SHIFT;
+
+	return min(cache->ca_store->stor_size - off, UMEM_CACHE_PAGE_SZ);
+}
+
+static void
+cache_map_page(struct umem_cache *cache, struct umem_page *page, struct umem_page_info *pinfo,
+	       void *addr)
+{
+	memset(pinfo->pi_bmap, 0, sizeof(pinfo->pi_bmap));
+	pinfo->pi_last_checkpoint = 0;
+	pinfo->pi_last_inflight   = 0;
+	pinfo->pi_first_dirty     = -1ULL;
+	pinfo->pi_chkpt_data      = NULL;
+	pinfo->pi_page            = page;
+	pinfo->pi_addr            = addr;
+	page->pg_info             = pinfo;
+	cache->ca_mapped++;
+}
+
+static void
+cache_unmap_page(struct umem_cache *cache, struct umem_page_info *pinfo)
+{
+	struct umem_page *page = pinfo->pi_page;
+
+	page->pg_info  = NULL;
+	pinfo->pi_page = NULL;
+	pinfo->pi_addr = NULL;
+	pinfo->pi_lru  = 0;
+	d_list_add(&pinfo->pi_link, &cache->ca_pi_free);
+	cache->ca_mapped--;
+}
+
 int
 umem_cache_evict(struct umem_store *store, uint64_t num_pages)
 {
-	/** XXX: Not yet implemented */
-	return 0;
+	struct umem_cache     *cache = store->cache;
+	struct umem_page_info *pinfo;
+	struct umem_page_info *tmp;
+	uint64_t               len;
+	uint64_t               evicted = 0;
+
+	/** Only the clean pages are on the LRU list, their content is in the store */
+	d_list_for_each_entry_safe(pinfo, tmp, &cache->ca_pgs_lru, pi_link) {
+		if (evicted == num_pages)
+			break;
+		if (pinfo->pi_page->pg_ref > 0)
+			continue;
+
+		/** Give the memory back, the mapping itself stays reserved for a later load */
+		len = cache_page_len(cache, pinfo->pi_page);
+		if (madvise(pinfo->pi_addr, len, MADV_REMOVE) != 0 &&
+		    madvise(pinfo->pi_addr, len, MADV_DONTNEED) != 0)
+			D_DEBUG(DB_IO, "Failed to release page %u: %d\n", pinfo->pi_page->pg_id,
+				errno);
+
+		D_DEBUG(DB_IO, "Evicted page %u\n", pinfo->pi_page->pg_id);
+		d_list_del(&pinfo->pi_link);
+		cache_unmap_page(cache, pinfo);
+		cache->ca_stats.ucs_evictions++;
+		evicted++;
+	}
+
+	return evicted == num_pages ? 0 : -DER_BUSY;
 }
 
 int
@@ -1798,6 +1864,7 @@ umem_cache_map_range(struct umem_store *store, umem_off_t offset, void *start_ad
 	struct umem_page_info *pinfo;
 	struct umem_page *end_page;
 	uint64_t          current_addr = (uint64_t)start_addr;
+	int               rc;
 
 	if (store->cache == NULL)
 		return 0; /* TODO: When SMD is supported outside VOS, this will be an error */
@@ -1809,38 +1876,131 @@ umem_cache_map_range(struct umem_store *store, umem_off_t offset, void *start_ad
 		  "pg_id=%d, num_pages=" DF_U64 ", cache pages=" DF_U64 "\n", page->pg_id,
 		  num_pages, cache->ca_num_pages);
 
+	/** The whole store is mapped contiguously, unloaded pages are read there on demand */
+	D_ASSERT(cache->ca_base == NULL || cache->ca_base == (uint8_t *)start_addr - offset);
+	cache->ca_base = (uint8_t *)start_addr - offset;
+
+	rc = umem_cache_check(store, num_pages);
+	if (rc > 0) {
+		rc = umem_cache_evict(store, rc);
+		if (rc != 0)
+			return rc;
+	}
+
 	while (page != end_page) {
 		D_ASSERT(page->pg_info == NULL);
 
 		pinfo = d_list_pop_entry(&cache->ca_pi_free, struct umem_page_info, pi_link);
 		D_ASSERT(pinfo != NULL);
-		page->pg_info  = pinfo;
-		pinfo->pi_page = page;
-		pinfo->pi_addr = (void *)current_addr;
+		cache_map_page(cache, page, pinfo, (void *)current_addr);
 		current_addr += UMEM_CACHE_PAGE_SZ;
 
+		pinfo->pi_lru = 1;
 		d_list_add_tail(&pinfo->pi_link, &cache->ca_pgs_lru);
 		page++;
 	}
 
-	cache->ca_mapped += num_pages;
+	return 0;
+}
+
+/** Read a page from the store, evicting the least recently used clean page if the cache is full */
+static int
+cache_load_page(struct umem_store *store, struct umem_page *page)
+{
+	struct umem_cache     *cache = store->cache;
+	struct umem_page_info *pinfo;
+	struct umem_store_iod  iod;
+	d_sg_list_t            sgl;
+	d_iov_t                iov;
+	int                    rc;
+
+	if (d_list_empty(&cache->ca_pi_free)) {
+		rc = umem_cache_evict(store, 1);
+		if (rc != 0)
+			return rc;
+	}
+
+	pinfo = d_list_pop_entry(&cache->ca_pi_free, struct umem_page_info, pi_link);
+	D_ASSERT(pinfo != NULL);
+	cache_map_page(cache, page, pinfo,
+		       cache->ca_base + ((uint64_t)page->pg_id << UMEM_CACHE_PAGE_SZ_SHIFT));
+	D_INIT_LIST_HEAD(&pinfo->pi_link);
+
+	iod.io_nr             = 1;
+	iod.io_regions        = &iod.io_region;
+	iod.io_region.sr_addr = (uint64_t)page->pg_id << UMEM_CACHE_PAGE_SZ_SHIFT;
+	iod.io_region.sr_size = cache_page_len(cache, page);
+	d_iov_set(&iov, pinfo->pi_addr, iod.io_region.sr_size);
+	sgl.sg_iovs   = &iov;
+	sgl.sg_nr     = 1;
+	sgl.sg_nr_out = 0;
+
+	/** The read can yield, concurrent loaders of the page see it loading */
+	pinfo->pi_loading = 1;
+	rc = store->stor_ops->so_read(store, &iod, &sgl);
+	pinfo->pi_loading = 0;
+	if (rc != 0) {
+		D_ERROR("Failed to load page %u: " DF_RC "\n", page->pg_id, DP_RC(rc));
+		cache_unmap_page(cache, pinfo);
+		return rc;
+	}
 
+	pinfo->pi_lru = 1;
+	d_list_add_tail(&pinfo->pi_link, &cache->ca_pgs_lru);
 	return 0;
 }
 
 int
-umem_cache_pin(struct umem_store *store, umem_off_t addr, daos_size_t size)
+umem_cache_load(struct umem_store *store, umem_off_t addr, daos_size_t size, bool pin)
 {
-	struct umem_cache *cache     = store->cache;
-	struct umem_page *page      = umem_cache_off2page(cache, addr);
-	struct umem_page *end_page  = umem_cache_off2page(cache, addr + size - 1) + 1;
+	struct umem_cache     *cache = store->cache;
+	struct umem_page      *start_page;
+	struct umem_page      *page;
+	struct umem_page      *end_page;
+	struct umem_page_info *pinfo;
+	int                    rc = 0;
 
-	while (page != end_page) {
-		page->pg_ref++;
-		page++;
+	if (cache == NULL)
+		return 0; /* TODO: When SMD is supported outside VOS, this will be an error */
+
+	D_ASSERT(cache->ca_base != NULL);
+	start_page = umem_cache_off2page(cache, addr);
+	end_page   = umem_cache_off2page(cache, addr + size - 1) + 1;
+
+	for (page = start_page; page != end_page; page++) {
+		pinfo = page->pg_info;
+		if (pinfo == NULL) {
+			cache->ca_stats.ucs_misses++;
+			rc = cache_load_page(store, page);
+			if (rc != 0)
+				break;
+		} else if (pinfo->pi_loading) {
+			D_GOTO(out, rc = -DER_AGAIN);
+		} else {
+			cache->ca_stats.ucs_hits++;
+			if (pinfo->pi_lru)
+				d_list_move_tail(&pinfo->pi_link, &cache->ca_pgs_lru);
+		}
+
+		if (pin)
+			page->pg_ref++;
 	}
 
-	return 0;
+out:
+	if (rc != 0 && pin) {
+		while (page != start_page) {
+			page--;
+			page->pg_ref--;
+		}
+	}
+
+	return rc;
+}
+
+int
+umem_cache_pin(struct umem_store *store, umem_off_t addr, daos_size_t size)
+{
+	return umem_cache_load(store, addr, size, true);
 }
 
 int
@@ -1886,10 +2046,18 @@ touch_page(struct umem_store *store, struct umem_page_info *pinfo, uint64_t wr_t
 		 */
 		d_list_del(&pinfo->pi_link);
 		d_list_add_tail(&pinfo->pi_link, &cache->ca_pgs_dirty);
+		pinfo->pi_lru = 0;
 	}
 
-	if (store->stor_ops->so_wal_id_cmp(store, wr_tx, pinfo->pi_last_inflight) <= 0 ||
-	    wr_tx == -1ULL)
+	if (wr_tx == -1ULL)
+		return;
+
+	/** Transactions don't touch pages in ID order, keep the lowest one */
+	if (pinfo->pi_first_dirty == -1ULL ||
+	    store->stor_ops->so_wal_id_cmp(store, wr_tx, pinfo->pi_first_dirty) < 0)
+		pinfo->pi_first_dirty = wr_tx;
+
+	if (store->stor_ops->so_wal_id_cmp(store, wr_tx, pinfo->pi_last_inflight) <= 0)
 		return;
 
 	pinfo->pi_last_inflight = wr_tx;
@@ -1900,6 +2068,7 @@ off2pinfo(struct umem_cache *cache, umem_off_t addr)
 {
 	struct umem_page *page = umem_cache_off2page(cache, addr);
 
+	D_ASSERTF(page->pg_info != NULL, "page %u isn't loaded\n", page->pg_id);
 	return page->pg_info;
 }
 
@@ -1974,6 +2143,15 @@ struct umem_checkpoint_data {
 	uint32_t                 cd_nr_dchunks;
 };
 
+static inline bool
+chkpt_can_merge(struct umem_store_region *prev, d_iov_t *prev_iov, uint64_t addr, uint8_t *buf,
+		uint64_t len)
+{
+	return prev->sr_addr + prev->sr_size == addr &&
+	       (uint8_t *)prev_iov->iov_buf + prev_iov->iov_len == buf &&
+	       prev->sr_size + len <= MAX_IO_SIZE;
+}
+
 static void
 page2chkpt(struct umem_store *store, struct umem_page_info *pinfo,
 	   struct umem_checkpoint_data *chkpt_data)
@@ -1991,6 +2169,7 @@ page2chkpt(struct umem_store *store, struct umem_page_info *pinfo,
 	int                    count;
 	uint64_t               mask;
 	uint64_t               bit;
+	uint64_t               len;
 
 	pinfo->pi_chkpt_data                            = chkpt_data;
 	chkpt_data->cd_pages[chkpt_data->cd_nr_pages++] = pinfo;
@@ -2019,15 +2198,27 @@ page2chkpt(struct umem_store *store, struct umem_page_info *pinfo,
 					break;
 			}
 
+			len = count << UMEM_CACHE_CHUNK_SZ_SHIFT;
+			chkpt_data->cd_nr_dchunks += count;
+			bmap &= ~mask;
+
+			/** Extend the previous range when it ends where this one starts, it can be
+			 *  in the previous bitmap word or at the end of the previous page.
+			 */
+			if (nr > 0 &&
+			    chkpt_can_merge(&store_iod->io_regions[nr - 1], &sgl->sg_iovs[nr - 1],
+					    offset + map_offset, page_addr + map_offset, len)) {
+				store_iod->io_regions[nr - 1].sr_size += len;
+				sgl->sg_iovs[nr - 1].iov_len += len;
+				sgl->sg_iovs[nr - 1].iov_buf_len = sgl->sg_iovs[nr - 1].iov_len;
+				continue;
+			}
+
 			store_iod->io_regions[nr].sr_addr = offset + map_offset;
-			store_iod->io_regions[nr].sr_size = count << UMEM_CACHE_CHUNK_SZ_SHIFT;
-			sgl->sg_iovs[nr].iov_len          = sgl->sg_iovs[nr].iov_buf_len =
-			    count << UMEM_CACHE_CHUNK_SZ_SHIFT;
+			store_iod->io_regions[nr].sr_size = len;
+			sgl->sg_iovs[nr].iov_len = sgl->sg_iovs[nr].iov_buf_len = len;
 			sgl->sg_iovs[nr].iov_buf = page_addr + map_offset;
-			chkpt_data->cd_nr_dchunks += count;
 			nr++;
-
-			bmap &= ~mask;
 		} while (bmap != 0);
 
 next_bmap:
@@ -2062,9 +2253,73 @@ chkpt_insert_sorted(struct umem_store *store, struct umem_checkpoint_data *chkpt
 	d_list_add_tail(&chkpt_data->cd_link, list);
 }
 
+/** Move the @max_pages dirty pages with the oldest writes to the copying list */
+static void
+chkpt_pick_oldest(struct umem_store *store, uint64_t max_pages)
+{
+	struct umem_cache     *cache = store->cache;
+	struct umem_page_info *pinfo;
+	struct umem_page_info *oldest;
+
+	while (max_pages-- > 0 && !d_list_empty(&cache->ca_pgs_dirty)) {
+		oldest = NULL;
+		d_list_for_each_entry(pinfo, &cache->ca_pgs_dirty, pi_link) {
+			/** Pages only written without a transaction don't hold the WAL back */
+			if (pinfo->pi_first_dirty == -1ULL)
+				continue;
+			if (oldest == NULL || store->stor_ops->so_wal_id_cmp(
+						  store, pinfo->pi_first_dirty, oldest->pi_first_dirty) < 0)
+				oldest = pinfo;
+		}
+		if (oldest == NULL)
+			oldest = d_list_entry(cache->ca_pgs_dirty.next, struct umem_page_info, pi_link);
+		d_list_move_tail(&oldest->pi_link, &cache->ca_pgs_copying);
+	}
+}
+
+/**
+ * After an incremental checkpoint, the WAL can be purged up to the highest transaction copied
+ * which is older than the oldest write still dirty, all the transactions up to it are in the
+ * store.
+ */
+static uint64_t
+chkpt_incr_id(struct umem_store *store, uint64_t *ids, int nr)
+{
+	struct umem_cache     *cache  = store->cache;
+	struct umem_page_info *pinfo;
+	uint64_t               oldest = -1ULL;
+	uint64_t               id     = -1ULL;
+	int                    i;
+
+	d_list_for_each_entry(pinfo, &cache->ca_pgs_dirty, pi_link) {
+		if (pinfo->pi_first_dirty == -1ULL)
+			continue;
+		if (oldest == -1ULL ||
+		    store->stor_ops->so_wal_id_cmp(store, pinfo->pi_first_dirty, oldest) < 0)
+			oldest = pinfo->pi_first_dirty;
+	}
+
+	for (i = 0; i < nr; i++) {
+		if (oldest != -1ULL && store->stor_ops->so_wal_id_cmp(store, ids[i], oldest) >= 0)
+			continue;
+		if (id == -1ULL || store->stor_ops->so_wal_id_cmp(store, ids[i], id) > 0)
+			id = ids[i];
+	}
+
+	return id;
+}
+
 int
 umem_cache_checkpoint(struct umem_store *store, umem_cache_wait_cb_t wait_cb, void *arg,
 		      uint64_t *out_id, struct umem_cache_chkpt_stats *stats)
+{
+	return umem_cache_checkpoint_incr(store, wait_cb, arg, 0, out_id, stats);
+}
+
+int
+umem_cache_checkpoint_incr(struct umem_store *store, umem_cache_wait_cb_t wait_cb, void *arg,
+			   uint64_t max_pages, uint64_t *out_id,
+			   struct umem_cache_chkpt_stats *stats)
 {
 	struct umem_cache           *cache    = store->cache;
 	struct umem_page_info       *pinfo    = NULL;
@@ -2081,6 +2336,9 @@ umem_cache_checkpoint(struct umem_store *store, umem_cache_wait_cb_t wait_cb, vo
 	int                          dchunks_copied = 0;
 	int                          iovs_used = 0;
 	int			     nr_copying_pgs = 0;
+	uint64_t                    *copied_ids = NULL;
+	int                          nr_copied  = 0;
+	uint64_t                     nr_dirty   = 0;
 
 	if (cache == NULL)
 		return 0; /* TODO: When SMD is supported outside VOS, this will be an error */
@@ -2104,7 +2362,24 @@ umem_cache_checkpoint(struct umem_store *store, umem_cache_wait_cb_t wait_cb, vo
 		chkpt_data->cd_sg_list.sg_iovs      = &chkpt_data->cd_iovs[0];
 	}
 
-	d_list_splice_init(&cache->ca_pgs_dirty, &cache->ca_pgs_copying);
+	if (max_pages != 0) {
+		d_list_for_each_entry(pinfo, &cache->ca_pgs_dirty, pi_link) {
+			if (++nr_dirty > max_pages)
+				break;
+		}
+	}
+
+	if (nr_dirty > max_pages) {
+		/** Incremental checkpoint, the WAL is purged as far as the copied pages allow */
+		D_ALLOC_ARRAY(copied_ids, max_pages);
+		if (copied_ids == NULL) {
+			D_FREE(chkpt_data_all);
+			return -DER_NOMEM;
+		}
+		chkpt_pick_oldest(store, max_pages);
+	} else {
+		d_list_splice_init(&cache->ca_pgs_dirty, &cache->ca_pgs_copying);
+	}
 
 	/** First mark all pages in the new list so they won't be moved by an I/O thread.  This
 	 *  will enable us to continue the algorithm in relative isolation from I/O threads.
@@ -2186,8 +2461,10 @@ umem_cache_checkpoint(struct umem_store *store, umem_cache_wait_cb_t wait_cb, vo
 			}
 
 			for (i = 0; i < chkpt_data->cd_nr_pages; i++) {
-				pinfo             = chkpt_data->cd_pages[i];
-				pinfo->pi_copying = 0;
+				pinfo                 = chkpt_data->cd_pages[i];
+				pinfo->pi_copying     = 0;
+				pinfo->pi_flush_first = pinfo->pi_first_dirty;
+				pinfo->pi_first_dirty = -1ULL;
 				memset(&pinfo->pi_bmap[0], 0, sizeof(pinfo->pi_bmap));
 			}
 
@@ -2221,10 +2498,23 @@ umem_cache_checkpoint(struct umem_store *store, umem_cache_wait_cb_t wait_cb, vo
 		rc = store->stor_ops->so_flush_post(chkpt_data->cd_fh, rc);
 		for (i = 0; i < chkpt_data->cd_nr_pages; i++) {
 			pinfo = chkpt_data->cd_pages[i];
-			if (pinfo->pi_last_inflight != pinfo->pi_last_checkpoint)
+			if (rc != 0) {
+				/** Not written, the page can't be evicted, copy all of it next time */
+				memset(&pinfo->pi_bmap[0], 0xff, sizeof(pinfo->pi_bmap));
+				if (pinfo->pi_first_dirty == -1ULL ||
+				    (pinfo->pi_flush_first != -1ULL &&
+				     store->stor_ops->so_wal_id_cmp(store, pinfo->pi_flush_first,
+								    pinfo->pi_first_dirty) < 0))
+					pinfo->pi_first_dirty = pinfo->pi_flush_first;
+				d_list_add_tail(&pinfo->pi_link, &cache->ca_pgs_dirty);
+			} else if (pinfo->pi_last_inflight != pinfo->pi_last_checkpoint) {
 				d_list_add_tail(&pinfo->pi_link, &cache->ca_pgs_dirty);
-			else
+			} else {
 				d_list_add_tail(&pinfo->pi_link, &cache->ca_pgs_lru);
+				pinfo->pi_lru = 1;
+			}
+			if (rc == 0 && copied_ids != NULL)
+				copied_ids[nr_copied++] = pinfo->pi_last_checkpoint;
 			pinfo->pi_waiting = 0;
 		}
 		inflight--;
@@ -2244,6 +2534,11 @@ umem_cache_checkpoint(struct umem_store *store, umem_cache_wait_cb_t wait_cb, vo
 
 	D_FREE(chkpt_data_all);
 
+	if (copied_ids != NULL) {
+		chkpt_id = chkpt_incr_id(store, copied_ids, nr_copied);
+		D_FREE(copied_ids);
+	}
+
 	*out_id = chkpt_id;
 	if (stats) {
 		stats->uccs_nr_pages   = pages_scanned;
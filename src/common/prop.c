@@ -334,7 +334,8 @@ daos_prop_valid(daos_prop_t *prop, bool pool, bool input)
 		case DAOS_PROP_PO_REINT_MODE:
 			val = prop->dpp_entries[i].dpe_val;
 			if (val != DAOS_REINT_MODE_DATA_SYNC &&
-			    val != DAOS_REINT_MODE_NO_DATA_SYNC) {
+			    val != DAOS_REINT_MODE_NO_DATA_SYNC &&
+			    val != DAOS_REINT_MODE_INCREMENTAL) {
 				D_ERROR("invalid reintegration mode "DF_U64".\n", val);
 				return false;
 			}
@@ -444,6 +445,14 @@ daos_prop_valid(daos_prop_t *prop, bool pool, bool input)
 		case DAOS_PROP_CO_SCRUBBER_DISABLED:
 			/* Placeholder */
 			break;
+		case DAOS_PROP_CO_EC_RECOV:
+			val = prop->dpp_entries[i].dpe_val;
+			if (val != DAOS_PROP_CO_EC_RECOV_CLIENT &&
+			    val != DAOS_PROP_CO_EC_RECOV_SERVER) {
+				D_ERROR("invalid EC recovery property " DF_U64 ".\n", val);
+				return false;
+			}
+			break;
 		case DAOS_PROP_CO_CSUM_SERVER_VERIFY:
 			val = prop->dpp_entries[i].dpe_val;
 			if (val != DAOS_PROP_CO_CSUM_SV_OFF &&
@@ -1085,6 +1094,14 @@ parse_entry(char *str, struct daos_prop_entry *entry)
 	} else if (strcmp(name, DAOS_PROP_ENTRY_PERF_DOMAIN) == 0) {
 		entry->dpe_type = DAOS_PROP_CO_PERF_DOMAIN;
 		entry->dpe_val = strtoull(val, NULL, 0);
+	} else if (strcmp(name, DAOS_PROP_ENTRY_EC_RECOV) == 0) {
+		entry->dpe_type = DAOS_PROP_CO_EC_RECOV;
+		if (strcmp(val, "client") == 0)
+			entry->dpe_val = DAOS_PROP_CO_EC_RECOV_CLIENT;
+		else if (strcmp(val, "server") == 0)
+			entry->dpe_val = DAOS_PROP_CO_EC_RECOV_SERVER;
+		else
+			rc = -DER_INVAL;
 	} else if (strcmp(name, DAOS_PROP_ENTRY_LAYOUT_TYPE) == 0 ||
 		   strcmp(name, DAOS_PROP_ENTRY_LAYOUT_VER) == 0 ||
 		   strcmp(name, DAOS_PROP_ENTRY_REDUN_LVL) == 0 ||
@@ -1338,6 +1338,97 @@ out:
 	TSE_TEST_EXIT(rc);
 }
 
+static int
+reuse_comp_cb(tse_task_t *task, void *data)
+{
+	uint64_t	*arg = data;
+
+	if (*arg != 0xdeadbeef)
+		task->dt_result = -DER_INVAL;
+	return 0;
+}
+
+static void
+sched_test_11(void **state)
+{
+	tse_sched_t	sched;
+	tse_task_t	*task;
+	tse_task_t	*reused;
+	uint64_t	arg = 0xdeadbeef;
+	char		*buf;
+	int		i;
+	int		rc;
+
+	TSE_TEST_ENTRY("11", "Task and callback reuse");
+
+	rc = tse_sched_init(&sched, NULL, 0);
+	if (rc != 0) {
+		print_error("Failed to init scheduler: %d\n", rc);
+		D_GOTO(out, rc);
+	}
+
+	rc = tse_task_create(NULL, &sched, NULL, &task);
+	if (rc != 0) {
+		print_error("Failed to create task: %d\n", rc);
+		D_GOTO(out_sched, rc);
+	}
+	buf = tse_task_buf_embedded(task, 64);
+	memset(buf, 0xff, 64);
+
+	rc = tse_task_register_comp_cb(task, reuse_comp_cb, &arg, sizeof(arg));
+	if (rc != 0) {
+		print_error("Failed to register comp cb: %d\n", rc);
+		D_GOTO(out_sched, rc);
+	}
+	rc = tse_task_schedule(task, false);
+	if (rc != 0) {
+		print_error("Failed to schedule task: %d\n", rc);
+		D_GOTO(out_sched, rc);
+	}
+	tse_task_complete(task, 0);
+
+	print_message("Freed task is reused by the scheduler, as a clean task\n");
+	rc = tse_task_create(NULL, &sched, NULL, &reused);
+	if (rc != 0) {
+		print_error("Failed to create task: %d\n", rc);
+		D_GOTO(out_sched, rc);
+	}
+	if (reused != task) {
+		print_error("Task %p was not reused (%p)\n", task, reused);
+		D_GOTO(out_sched, rc = -DER_INVAL);
+	}
+	buf = tse_task_buf_embedded(reused, 64);
+	for (i = 0; i < 64; i++) {
+		if (buf[i] != 0) {
+			print_error("Embedded buffer of reused task isn't clean\n");
+			D_GOTO(out_sched, rc = -DER_INVAL);
+		}
+	}
+
+	print_message("Reused callback carries the new argument\n");
+	arg = 0xdeadbeef;
+	rc = tse_task_register_comp_cb(reused, reuse_comp_cb, &arg, sizeof(arg));
+	if (rc != 0) {
+		print_error("Failed to register comp cb: %d\n", rc);
+		D_GOTO(out_sched, rc);
+	}
+	rc = tse_task_schedule(reused, false);
+	if (rc != 0) {
+		print_error("Failed to schedule task: %d\n", rc);
+		D_GOTO(out_sched, rc);
+	}
+	tse_task_addref(reused);
+	tse_task_complete(reused, 0);
+	rc = reused->dt_result;
+	tse_task_decref(reused);
+	if (rc != 0)
+		print_error("Completion callback saw a wrong argument\n");
+
+out_sched:
+	tse_sched_complete(&sched, rc, rc != 0);
+out:
+	TSE_TEST_EXIT(rc);
+}
 
 static int
 sched_ut_setup(void **state)
@@ -1362,7 +1453,8 @@ static const struct CMUnitTest sched_uts[] = {
 	{ "SCHED_Test_7", sched_test_7, NULL, NULL},
 	{ "SCHED_Test_8", sched_test_8, NULL, NULL},
 	{ "SCHED_Test_9", sched_test_9, NULL, NULL},
-	{ "SCHED_Test_10", sched_test_10, NULL, NULL}
+	{ "SCHED_Test_10", sched_test_10, NULL, NULL},
+	{ "SCHED_Test_11", sched_test_11, NULL, NULL}
 };
 
 int main(int argc, char **argv)
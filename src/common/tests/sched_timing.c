@@ -0,0 +1,190 @@
+/*
+ * (C) Copyright 2024 Intel Corporation.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause-Patent
+ */
+/**
+ * Task engine throughput: chains of dependent tasks, each with a completion
+ * callback, are created, scheduled and progressed to completion.
+ *
+ * common/tests/sched_timing.c
+ */
+#define D_LOGFAC	DD_FAC(tests)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <getopt.h>
+
+#include <daos/common.h>
+#include <daos/tse.h>
+
+struct sched_timing_args {
+	uint32_t	chain_len;	/** tasks per dependency chain */
+	uint32_t	iterations;	/** chains to run */
+	uint64_t	cb_calls;	/** completion callbacks executed */
+};
+
+static int
+timing_task_body(tse_task_t *task)
+{
+	tse_task_complete(task, 0);
+	return 0;
+}
+
+static int
+timing_task_comp_cb(tse_task_t *task, void *data)
+{
+	struct sched_timing_args *args = *(struct sched_timing_args **)data;
+
+	args->cb_calls++;
+	return 0;
+}
+
+static int
+run_chain(tse_sched_t *sched, struct sched_timing_args *args, tse_task_t **tasks)
+{
+	uint32_t	i;
+	int		rc;
+
+	for (i = 0; i < args->chain_len; i++) {
+		rc = tse_task_create(timing_task_body, sched, NULL, &tasks[i]);
+		if (rc != 0)
+			return rc;
+
+		rc = tse_task_register_comp_cb(tasks[i], timing_task_comp_cb, &args,
+					       sizeof(args));
+		if (rc != 0)
+			return rc;
+
+		if (i > 0) {
+			rc = tse_task_register_deps(tasks[i], 1, &tasks[i - 1]);
+			if (rc != 0)
+				return rc;
+		}
+	}
+
+	for (i = 0; i < args->chain_len; i++) {
+		rc = tse_task_schedule(tasks[i], false);
+		if (rc != 0)
+			return rc;
+	}
+
+	while (!tse_sched_check_complete(sched))
+		tse_sched_progress(sched);
+
+	return 0;
+}
+
+static int
+run_timing(struct sched_timing_args *args)
+{
+	tse_sched_t	 sched;
+	tse_task_t	**tasks;
+	struct timespec	 start, end;
+	uint64_t	 nsec;
+	uint32_t	 i;
+	int		 rc;
+
+	D_ALLOC_ARRAY(tasks, args->chain_len);
+	if (tasks == NULL)
+		return -DER_NOMEM;
+
+	rc = tse_sched_init(&sched, NULL, NULL);
+	if (rc != 0)
+		goto out;
+
+	/* warm up, so the allocator state is the same as in a long running client */
+	rc = run_chain(&sched, args, tasks);
+	if (rc != 0)
+		goto out_sched;
+
+	args->cb_calls = 0;
+	d_gettime(&start);
+	for (i = 0; i < args->iterations; i++) {
+		rc = run_chain(&sched, args, tasks);
+		if (rc != 0)
+			goto out_sched;
+	}
+	d_gettime(&end);
+	nsec = d_timediff_ns(&start, &end);
+
+	if (args->cb_calls != (uint64_t)args->chain_len * args->iterations) {
+		printf("Error: %"PRIu64" completion callbacks executed, expected %"PRIu64"\n",
+		       args->cb_calls, (uint64_t)args->chain_len * args->iterations);
+		rc = -DER_MISMATCH;
+		goto out_sched;
+	}
+
+	printf("%10u tasks/chain %10u chains %12.0f tasks/sec %8.1f ns/task\n",
+	       args->chain_len, args->iterations, args->cb_calls * 1e9 / nsec,
+	       (double)nsec / args->cb_calls);
+
+out_sched:
+	tse_sched_complete(&sched, rc, rc != 0);
+out:
+	D_FREE(tasks);
+	return rc;
+}
+
+static void
+print_usage(const char *name)
+{
+	printf("usage: %s [OPTIONS] ...\n\n", name);
+	printf("\t-n TASKS, --chain=TASKS\t\t"
+	       "Number of dependent tasks per chain.\n\t\t\t\t\t"
+	       "Default: Chain lengths will double starting with 1 until 4096\n");
+	printf("\t-i ITERS, --iterations=ITERS\t"
+	       "Total number of tasks run per chain length (default 1M)\n");
+	printf("\t-h, --help\t\t\tShow this message\n");
+}
+
+static const char *s_opts = "hn:i:";
+
+static struct option l_opts[] = {
+	{"chain",	required_argument,	NULL, 'n'},
+	{"iterations",	required_argument,	NULL, 'i'},
+	{"help",	no_argument,		NULL, 'h'},
+	{NULL,		0,			NULL, 0}
+};
+
+int
+main(int argc, char *argv[])
+{
+	struct sched_timing_args	args = { 0 };
+	uint32_t			chain_len = 0;
+	uint64_t			total = 1 << 20;
+	int				opt;
+	int				rc;
+
+	while ((opt = getopt_long(argc, argv, s_opts, l_opts, NULL)) != -1) {
+		switch (opt) {
+		case 'n':
+			chain_len = atoi(optarg);
+			break;
+		case 'i':
+			total = strtoull(optarg, NULL, 0);
+			break;
+		case 'h':
+		default:
+			print_usage(argv[0]);
+			return 0;
+		}
+	}
+
+	rc = daos_debug_init(DAOS_LOG_DEFAULT);
+	if (rc != 0)
+		return -rc;
+
+	for (args.chain_len = chain_len ?: 1; args.chain_len <= (chain_len ?: 4096);
+	     args.chain_len *= 2) {
+		args.iterations = max(total / args.chain_len, 1);
+		rc = run_timing(&args);
+		if (rc != 0) {
+			printf("Error: "DF_RC"\n", DP_RC(rc));
+			break;
+		}
+	}
+
+	daos_debug_fini();
+	return -rc;
+}
@@ -559,6 +559,203 @@ test_many_writes(void **state)
 	umem_cache_free(&arg->ta_store);
 }
 
+static int
+load_page(struct umem_store *store, struct umem_store_iod *iod, d_sg_list_t *sgl)
+{
+	assert_int_equal(iod->io_nr, 1);
+	assert_int_equal(sgl->sg_nr, 1);
+	assert_int_equal(iod->io_regions[0].sr_size, sgl->sg_iovs[0].iov_len);
+
+	/** Tag the page with its ID */
+	*(uint64_t *)sgl->sg_iovs[0].iov_buf = iod->io_regions[0].sr_addr >>
+					       UMEM_CACHE_PAGE_SZ_SHIFT;
+	return 0;
+}
+
+static int
+flush_prep_noop(struct umem_store *store, struct umem_store_iod *iod, daos_handle_t *fh)
+{
+	return 0;
+}
+
+static int
+flush_copy_noop(daos_handle_t fh, d_sg_list_t *sgl)
+{
+	return 0;
+}
+
+static struct umem_store_ops lru_stor_ops = {
+    .so_read       = load_page,
+    .so_flush_prep = flush_prep_noop,
+    .so_flush_copy = flush_copy_noop,
+    .so_flush_post = flush_post,
+    .so_wal_id_cmp = wal_id_cmp,
+};
+
+#define LRU_NUM_PAGES 4
+
+static inline uint64_t
+page_tag(uint8_t *base, int pg_id)
+{
+	return *(uint64_t *)(base + (uint64_t)pg_id * UMEM_CACHE_PAGE_SZ);
+}
+
+static void
+test_page_cache_evict(void **state)
+{
+	struct test_arg   *arg = *state;
+	struct umem_cache *cache;
+	uint8_t           *base;
+	uint64_t           id = 0;
+	int                rc;
+
+	arg->ta_store.stor_size  = LRU_NUM_PAGES * UMEM_CACHE_PAGE_SZ;
+	arg->ta_store.stor_ops   = &lru_stor_ops;
+	arg->ta_store.store_type = DAOS_MD_BMEM;
+
+	/** In case prior test failed */
+	umem_cache_free(&arg->ta_store);
+
+	base = mmap(NULL, LRU_NUM_PAGES * UMEM_CACHE_PAGE_SZ, PROT_READ | PROT_WRITE,
+		    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	assert_true(base != MAP_FAILED);
+
+	/** Room for half of the store */
+	rc = umem_cache_alloc(&arg->ta_store, 2);
+	assert_rc_equal(rc, 0);
+
+	cache = arg->ta_store.cache;
+	assert_int_equal(cache->ca_num_pages, LRU_NUM_PAGES);
+	assert_int_equal(cache->ca_max_mapped, 2);
+
+	rc = umem_cache_map_range(&arg->ta_store, 0, base, 1);
+	assert_rc_equal(rc, 0);
+
+	/** Page 1 is read on first access, page 2 evicts page 0 */
+	rc = umem_cache_load(&arg->ta_store, UMEM_CACHE_PAGE_SZ + 10, 100, false);
+	assert_rc_equal(rc, 0);
+	rc = umem_cache_load(&arg->ta_store, 2 * UMEM_CACHE_PAGE_SZ, 100, false);
+	assert_rc_equal(rc, 0);
+	assert_int_equal(cache->ca_mapped, 2);
+	assert_null(cache->ca_pages[0].pg_info);
+	assert_int_equal(page_tag(base, 1), 1);
+	assert_int_equal(page_tag(base, 2), 2);
+	assert_int_equal(cache->ca_stats.ucs_misses, 2);
+	assert_int_equal(cache->ca_stats.ucs_evictions, 1);
+
+	/** Page 1 is pinned and page 2 dirty, nothing can be evicted */
+	rc = umem_cache_pin(&arg->ta_store, UMEM_CACHE_PAGE_SZ, 10);
+	assert_rc_equal(rc, 0);
+	assert_int_equal(cache->ca_stats.ucs_hits, 1);
+	rc = umem_cache_touch(&arg->ta_store, 1, 2 * UMEM_CACHE_PAGE_SZ + 10, 10);
+	assert_rc_equal(rc, 0);
+	rc = umem_cache_load(&arg->ta_store, 3 * UMEM_CACHE_PAGE_SZ, 10, false);
+	assert_rc_equal(rc, -DER_BUSY);
+	assert_null(cache->ca_pages[3].pg_info);
+
+	/** Once checkpointed, page 2 makes room for page 3 */
+	rc = umem_cache_checkpoint(&arg->ta_store, wait_cb, NULL, &id, NULL);
+	assert_rc_equal(rc, 0);
+	assert_int_equal(id, 1);
+	rc = umem_cache_load(&arg->ta_store, 3 * UMEM_CACHE_PAGE_SZ, 10, false);
+	assert_rc_equal(rc, 0);
+	assert_null(cache->ca_pages[2].pg_info);
+	assert_non_null(cache->ca_pages[1].pg_info);
+
+	/** Unpinned, page 1 is the least recently used */
+	rc = umem_cache_unpin(&arg->ta_store, UMEM_CACHE_PAGE_SZ, 10);
+	assert_rc_equal(rc, 0);
+	rc = umem_cache_load(&arg->ta_store, 0, UMEM_CACHE_PAGE_SZ, true);
+	assert_rc_equal(rc, 0);
+	assert_null(cache->ca_pages[1].pg_info);
+	assert_int_equal(page_tag(base, 0), 0);
+	/** The failed load of page 3 counts as a miss */
+	assert_int_equal(cache->ca_stats.ucs_misses, 5);
+	assert_int_equal(cache->ca_stats.ucs_evictions, 3);
+
+	/** A range over two pages which don't fit with the pinned page */
+	rc = umem_cache_load(&arg->ta_store, 2 * UMEM_CACHE_PAGE_SZ, 2 * UMEM_CACHE_PAGE_SZ, true);
+	assert_rc_equal(rc, -DER_BUSY);
+	assert_int_equal(cache->ca_pages[2].pg_ref, 0);
+	assert_int_equal(cache->ca_pages[3].pg_ref, 0);
+
+	rc = umem_cache_unpin(&arg->ta_store, 0, UMEM_CACHE_PAGE_SZ);
+	assert_rc_equal(rc, 0);
+
+	/** The failed pin held nothing, retried once page 0 is released it succeeds */
+	rc = umem_cache_pin(&arg->ta_store, 2 * UMEM_CACHE_PAGE_SZ, 2 * UMEM_CACHE_PAGE_SZ);
+	assert_rc_equal(rc, 0);
+	assert_int_equal(cache->ca_pages[2].pg_ref, 1);
+	assert_int_equal(cache->ca_pages[3].pg_ref, 1);
+	rc = umem_cache_unpin(&arg->ta_store, 2 * UMEM_CACHE_PAGE_SZ, 2 * UMEM_CACHE_PAGE_SZ);
+	assert_rc_equal(rc, 0);
+
+	umem_cache_free(&arg->ta_store);
+	munmap(base, LRU_NUM_PAGES * UMEM_CACHE_PAGE_SZ);
+}
+
+static void
+test_page_cache_incr(void **state)
+{
+	struct test_arg               *arg = *state;
+	struct umem_cache_chkpt_stats  stats;
+	uint8_t                       *base;
+	uint64_t                       id = 0;
+	int                            rc;
+
+	arg->ta_store.stor_size  = LRU_NUM_PAGES * UMEM_CACHE_PAGE_SZ;
+	arg->ta_store.stor_ops   = &lru_stor_ops;
+	arg->ta_store.store_type = DAOS_MD_BMEM;
+
+	/** In case prior test failed */
+	umem_cache_free(&arg->ta_store);
+
+	base = mmap(NULL, LRU_NUM_PAGES * UMEM_CACHE_PAGE_SZ, PROT_READ | PROT_WRITE,
+		    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	assert_true(base != MAP_FAILED);
+
+	rc = umem_cache_alloc(&arg->ta_store, 0);
+	assert_rc_equal(rc, 0);
+	rc = umem_cache_map_range(&arg->ta_store, 0, base, LRU_NUM_PAGES);
+	assert_rc_equal(rc, 0);
+
+	/** The oldest writes are on both sides of the boundary between page 2 and 3 */
+	rc = umem_cache_touch(&arg->ta_store, 1, 3 * UMEM_CACHE_PAGE_SZ - 10, 10);
+	assert_rc_equal(rc, 0);
+	rc = umem_cache_touch(&arg->ta_store, 2, 3 * UMEM_CACHE_PAGE_SZ, 10);
+	assert_rc_equal(rc, 0);
+	rc = umem_cache_touch(&arg->ta_store, 3, 10, 10);
+	assert_rc_equal(rc, 0);
+	rc = umem_cache_touch(&arg->ta_store, 4, UMEM_CACHE_PAGE_SZ + 10, 10);
+	assert_rc_equal(rc, 0);
+	rc = umem_cache_touch(&arg->ta_store, 5, 3 * UMEM_CACHE_PAGE_SZ + 100000, 10);
+	assert_rc_equal(rc, 0);
+
+	/** Page 2 and 3 are written, the adjacent chunks in one I/O */
+	id = 5;
+	rc = umem_cache_checkpoint_incr(&arg->ta_store, wait_cb, NULL, 2, &id, &stats);
+	assert_rc_equal(rc, 0);
+	assert_int_equal(stats.uccs_nr_pages, 2);
+	assert_int_equal(stats.uccs_nr_dchunks, 3);
+	assert_int_equal(stats.uccs_nr_iovs, 2);
+	/**
+	 * Transaction 3 and 4 are still dirty, and page 3 was last written by transaction 5, only
+	 * transaction 1 is known to be in the store.
+	 */
+	assert_int_equal(id, 1);
+
+	/** No more dirty pages than the limit, the remaining ones are all written */
+	id = 5;
+	rc = umem_cache_checkpoint_incr(&arg->ta_store, wait_cb, NULL, 2, &id, &stats);
+	assert_rc_equal(rc, 0);
+	assert_int_equal(stats.uccs_nr_pages, 2);
+	assert_int_equal(id, 5);
+	assert_true(d_list_empty(&arg->ta_store.cache->ca_pgs_dirty));
+
+	umem_cache_free(&arg->ta_store);
+	munmap(base, LRU_NUM_PAGES * UMEM_CACHE_PAGE_SZ);
+}
+
 int
 main(int argc, char **argv)
 {
@@ -570,6 +767,8 @@ main(int argc, char **argv)
 	    {"UMEM005: Test page cache", test_page_cache, NULL, NULL},
 	    {"UMEM006: Test page cache many pages", test_many_pages, NULL, NULL},
 	    {"UMEM007: Test page cache many writes", test_many_writes, NULL, NULL},
+	    {"UMEM008: Test page cache eviction", test_page_cache_evict, NULL, NULL},
+	    {"UMEM009: Test incremental checkpoint", test_page_cache_incr, NULL, NULL},
 	    {NULL, NULL, NULL, NULL}};
 
 	d_register_alt_assert(mock_assert);
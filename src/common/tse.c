@@ -30,6 +30,15 @@ struct tse_task_link {
 	tse_task_t		*tl_task;
 };
 
+/*
+ * Each scheduler caches the tasks and callbacks freed by it, so the hot path of
+ * creating and completing tasks doesn't go through the allocator.
+ */
+#define TSE_TASK_CACHE_MAX	256
+#define TSE_CB_CACHE_MAX	512
+/* callbacks with larger argument are always allocated */
+#define TSE_CB_CACHE_ARG	64
+
 static void tse_sched_priv_decref(struct tse_sched_private *dsp);
 
 int
@@ -48,6 +57,8 @@ tse_sched_init(tse_sched_t *sched, tse_sched_comp_cb_t comp_cb,
 	D_INIT_LIST_HEAD(&dsp->dsp_complete_list);
 	D_INIT_LIST_HEAD(&dsp->dsp_sleeping_list);
 	D_INIT_LIST_HEAD(&dsp->dsp_comp_cb_list);
+	D_INIT_LIST_HEAD(&dsp->dsp_task_cache);
+	D_INIT_LIST_HEAD(&dsp->dsp_cb_cache);
 
 	dsp->dsp_refcount = 1;
 	dsp->dsp_inflight = 0;
@@ -206,6 +217,104 @@ tse_task2sched(tse_task_t *task)
 	return tse_priv2sched(sched_priv);
 }
 
+static void
+tse_task_free_locked(tse_task_t *task)
+{
+	struct tse_task_private  *dtp = tse_task2priv(task);
+	struct tse_sched_private *dsp = dtp->dtp_sched;
+
+	D_ASSERT(d_list_empty(&dtp->dtp_dep_list));
+	D_ASSERT(d_list_empty(&dtp->dtp_comp_cb_list));
+
+	if (dsp->dsp_cache_off || dsp->dsp_task_cache_nr >= TSE_TASK_CACHE_MAX) {
+		D_FREE(task);
+		return;
+	}
+	d_list_add(&dtp->dtp_list, &dsp->dsp_task_cache);
+	dsp->dsp_task_cache_nr++;
+}
+
+static tse_task_t *
+tse_task_alloc(struct tse_sched_private *dsp)
+{
+	struct tse_task_private	*dtp = NULL;
+	tse_task_t		*task;
+
+	/* racy check, just to skip the lock if nothing is cached */
+	if (dsp->dsp_task_cache_nr > 0) {
+		D_MUTEX_LOCK(&dsp->dsp_lock);
+		dtp = d_list_pop_entry(&dsp->dsp_task_cache, struct tse_task_private, dtp_list);
+		if (dtp != NULL)
+			dsp->dsp_task_cache_nr--;
+		D_MUTEX_UNLOCK(&dsp->dsp_lock);
+	}
+
+	if (dtp == NULL) {
+		D_ALLOC_PTR(task);
+		return task;
+	}
+
+	task = tse_priv2task(dtp);
+	memset(task, 0, sizeof(*task));
+	return task;
+}
+
+static struct tse_task_cb *
+tse_task_cb_get_locked(struct tse_sched_private *dsp, daos_size_t arg_size)
+{
+	struct tse_task_cb	*dtc;
+
+	if (arg_size > TSE_CB_CACHE_ARG)
+		return NULL;
+
+	dtc = d_list_pop_entry(&dsp->dsp_cb_cache, struct tse_task_cb, dtc_list);
+	if (dtc != NULL)
+		dsp->dsp_cb_cache_nr--;
+	return dtc;
+}
+
+/* Return executed callbacks to the cache with a single lock acquisition */
+static void
+tse_task_cb_put_list(struct tse_sched_private *dsp, d_list_t *list)
+{
+	struct tse_task_cb	*dtc;
+
+	if (d_list_empty(list))
+		return;
+
+	D_MUTEX_LOCK(&dsp->dsp_lock);
+	while ((dtc = d_list_pop_entry(list, struct tse_task_cb, dtc_list)) != NULL) {
+		if (dsp->dsp_cache_off || dtc->dtc_arg_size > TSE_CB_CACHE_ARG ||
+		    dsp->dsp_cb_cache_nr >= TSE_CB_CACHE_MAX) {
+			D_FREE(dtc);
+			continue;
+		}
+		d_list_add(&dtc->dtc_list, &dsp->dsp_cb_cache);
+		dsp->dsp_cb_cache_nr++;
+	}
+	D_MUTEX_UNLOCK(&dsp->dsp_lock);
+}
+
+static void
+tse_sched_cache_drain(struct tse_sched_private *dsp)
+{
+	struct tse_task_private	*dtp;
+	struct tse_task_cb	*dtc;
+
+	while ((dtp = d_list_pop_entry(&dsp->dsp_task_cache, struct tse_task_private,
+				       dtp_list)) != NULL) {
+		tse_task_t *task = tse_priv2task(dtp);
+
+		D_FREE(task);
+	}
+	while ((dtc = d_list_pop_entry(&dsp->dsp_cb_cache, struct tse_task_cb, dtc_list)) != NULL)
+		D_FREE(dtc);
+
+	dsp->dsp_task_cache_nr = 0;
+	dsp->dsp_cb_cache_nr = 0;
+	dsp->dsp_cache_off = 1;
+}
+
 static void
 tse_task_addref_locked(struct tse_task_private *dtp)
 {
@@ -244,13 +353,9 @@ tse_task_decref(tse_task_t *task)
 	D_ASSERT(dsp != NULL);
 	D_MUTEX_LOCK(&dsp->dsp_lock);
 	zombie = tse_task_decref_locked(dtp);
+	if (zombie)
+		tse_task_free_locked(task);
 	D_MUTEX_UNLOCK(&dsp->dsp_lock);
-	if (!zombie)
-		return;
-
-	D_ASSERT(d_list_empty(&dtp->dtp_dep_list));
-	D_ASSERT(d_list_empty(&dtp->dtp_comp_cb_list));
-	D_FREE(task);
 }
 
 static void
@@ -260,12 +365,8 @@ tse_task_decref_free_locked(tse_task_t *task)
 	bool			zombie;
 
 	zombie = tse_task_decref_locked(dtp);
-	if (!zombie)
-		return;
-
-	D_ASSERT(d_list_empty(&dtp->dtp_dep_list));
-	D_ASSERT(d_list_empty(&dtp->dtp_comp_cb_list));
-	D_FREE(task);
+	if (zombie)
+		tse_task_free_locked(task);
 }
 
 void
@@ -278,6 +379,7 @@ tse_sched_fini(tse_sched_t *sched)
 	D_ASSERT(d_list_empty(&dsp->dsp_running_list));
 	D_ASSERT(d_list_empty(&dsp->dsp_complete_list));
 	D_ASSERT(d_list_empty(&dsp->dsp_sleeping_list));
+	tse_sched_cache_drain(dsp);
 	D_MUTEX_DESTROY(&dsp->dsp_lock);
 }
 
@@ -394,18 +496,26 @@ register_cb(tse_task_t *task, bool is_comp, tse_task_cb_t cb,
 		return -DER_NO_PERM;
 	}
 
-	D_ALLOC(dtc, sizeof(*dtc) + arg_size);
-	if (dtc == NULL)
-		return -DER_NOMEM;
+	D_ASSERT(dtp->dtp_sched != NULL);
+
+	D_MUTEX_LOCK(&dtp->dtp_sched->dsp_lock);
+	dtc = tse_task_cb_get_locked(dtp->dtp_sched, arg_size);
+	if (dtc == NULL) {
+		D_MUTEX_UNLOCK(&dtp->dtp_sched->dsp_lock);
+		/* small callbacks are allocated at the cached size, so they can be reused */
+		D_ALLOC(dtc, sizeof(*dtc) + max(arg_size, TSE_CB_CACHE_ARG));
+		if (dtc == NULL)
+			return -DER_NOMEM;
+		D_MUTEX_LOCK(&dtp->dtp_sched->dsp_lock);
+	}
 
 	dtc->dtc_arg_size = arg_size;
 	dtc->dtc_cb = cb;
 	if (arg)
 		memcpy(dtc->dtc_arg, arg, arg_size);
+	else
+		memset(dtc->dtc_arg, 0, arg_size);
 
-	D_ASSERT(dtp->dtp_sched != NULL);
-
-	D_MUTEX_LOCK(&dtp->dtp_sched->dsp_lock);
 	if (is_comp)
 		d_list_add(&dtc->dtc_list, &dtp->dtp_comp_cb_list);
 	else /** MSC - don't see a need for more than 1 prep cb */
@@ -463,10 +573,12 @@ tse_task_prep_callback(tse_task_t *task)
 	struct tse_task_private	*dtp = tse_task2priv(task);
 	struct tse_task_cb	*dtc;
 	struct tse_task_cb	*tmp;
+	d_list_t		 done;
 	uint32_t		 gen, new_gen;
 	bool			 ret = true;
 	int			 rc;
 
+	D_INIT_LIST_HEAD(&done);
 	d_list_for_each_entry_safe(dtc, tmp, &dtp->dtp_prep_cb_list, dtc_list) {
 		d_list_del(&dtc->dtc_list);
 		/** no need to call if task was completed in one of the cbs */
@@ -476,12 +588,13 @@ tse_task_prep_callback(tse_task_t *task)
 			if (task->dt_result == 0)
 				task->dt_result = rc;
 		}
-		D_FREE(dtc);
+		d_list_add_tail(&dtc->dtc_list, &done);
 		new_gen = dtp_generation_get(dtp);
 		/** Task was re-initialized; */
 		if (!atomic_load(&dtp->dtp_running) && new_gen != gen)
 			ret = false;
 	}
+	tse_task_cb_put_list(dtp->dtp_sched, &done);
 
 	return ret;
 }
@@ -501,12 +614,15 @@ tse_task_complete_callback(tse_task_t *task)
 	uint32_t		 	gen, new_gen;
 	struct tse_task_cb		*dtc;
 	struct tse_task_cb		*tmp;
+	d_list_t			done;
+	bool				completed = true;
 
 	/* Take one extra ref-count here and decref before exit, as in dtc_cb() it possibly
 	 * re-init the task that may be completed immediately.
 	 */
 	tse_task_addref(task);
 
+	D_INIT_LIST_HEAD(&done);
 	d_list_for_each_entry_safe(dtc, tmp, &dtp->dtp_comp_cb_list, dtc_list) {
 		int ret;
 
@@ -515,18 +631,19 @@ tse_task_complete_callback(tse_task_t *task)
 		ret = dtc->dtc_cb(task, dtc->dtc_arg);
 		if (task->dt_result == 0)
 			task->dt_result = ret;
-		D_FREE(dtc);
+		d_list_add_tail(&dtc->dtc_list, &done);
 		/** Task was re-initialized, or new dep-task added */
 		new_gen = dtp_generation_get(dtp);
 		if (new_gen != gen) {
 			D_DEBUG(DB_TRACE, "task %p re-inited or new dep-task added\n", task);
-			tse_task_decref(task);
-			return false;
+			completed = false;
+			break;
 		}
 	}
+	tse_task_cb_put_list(dtp->dtp_sched, &done);
 
 	tse_task_decref(task);
-	return true;
+	return completed;
 }
 
 /*
@@ -948,7 +1065,7 @@ tse_task_create(tse_task_func_t task_func, tse_sched_t *sched, void *priv,
 	struct tse_task_private	 *dtp;
 	tse_task_t		 *task;
 
-	D_ALLOC_PTR(task);
+	task = tse_task_alloc(dsp);
 	if (task == NULL)
 		return -DER_NOMEM;
 
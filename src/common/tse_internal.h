@@ -120,7 +120,15 @@ struct tse_sched_private {
 	int		dsp_inflight;
 
 	uint32_t	dsp_cancelling:1,
-			dsp_completing:1;
+			dsp_completing:1,
+			/* scheduler finalized, tasks freed later bypass the caches */
+			dsp_cache_off:1;
+
+	/* freed tasks and small callbacks kept for reuse, protected by dsp_lock */
+	uint32_t	dsp_task_cache_nr;
+	uint32_t	dsp_cb_cache_nr;
+	d_list_t	dsp_task_cache;
+	d_list_t	dsp_cb_cache;
 };
 
 struct tse_sched_comp {
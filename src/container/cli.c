@@ -922,7 +922,8 @@ dc_cont_open_internal(tse_task_t *task, const char *label, struct dc_pool *pool)
 		    DAOS_CO_QUERY_PROP_REDUN_LVL | DAOS_CO_QUERY_PROP_REDUN_FAC |
 		    DAOS_CO_QUERY_PROP_EC_CELL_SZ | DAOS_CO_QUERY_PROP_EC_PDA |
 		    DAOS_CO_QUERY_PROP_RP_PDA | DAOS_CO_QUERY_PROP_GLOBAL_VERSION |
-		    DAOS_CO_QUERY_PROP_OBJ_VERSION | DAOS_CO_QUERY_PROP_PERF_DOMAIN;
+		    DAOS_CO_QUERY_PROP_OBJ_VERSION | DAOS_CO_QUERY_PROP_PERF_DOMAIN |
+		    DAOS_CO_QUERY_PROP_EC_RECOV;
 	cont_open_in_set_data(rpc, cont_op, dc_cont_proto_version, tpriv->cont->dc_capas, prop_bits,
 			      label);
 
@@ -1390,6 +1391,9 @@ cont_query_bits(daos_prop_t *prop)
 		case DAOS_PROP_CO_OBJ_VERSION:
 			bits |= DAOS_CO_QUERY_PROP_OBJ_VERSION;
 			break;
+		case DAOS_PROP_CO_EC_RECOV:
+			bits |= DAOS_CO_QUERY_PROP_EC_RECOV;
+			break;
 		default:
 			D_ERROR("ignore bad dpt_type %d.\n", entry->dpe_type);
 			break;
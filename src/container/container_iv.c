@@ -392,6 +392,10 @@ cont_iv_prop_l2g(daos_prop_t *prop, struct cont_iv_prop *iv_prop)
 			iv_prop->cip_scrubbing_disabled = prop_entry->dpe_val;
 			bits |= DAOS_CO_QUERY_PROP_SCRUB_DIS;
 			break;
+		case DAOS_PROP_CO_EC_RECOV:
+			iv_prop->cip_ec_recov = prop_entry->dpe_val;
+			bits |= DAOS_CO_QUERY_PROP_EC_RECOV;
+			break;
 		default:
 			D_ASSERTF(0, "bad dpe_type %d\n", prop_entry->dpe_type);
 			break;
@@ -1384,6 +1388,11 @@ cont_iv_prop_g2l(struct cont_iv_prop *iv_prop, daos_prop_t **prop_out)
 		prop_entry->dpe_val = iv_prop->cip_scrubbing_disabled;
 		prop_entry->dpe_type = DAOS_PROP_CO_SCRUBBER_DISABLED;
 	}
+	if (bits & DAOS_CO_QUERY_PROP_EC_RECOV) {
+		prop_entry = &prop->dpp_entries[i++];
+		prop_entry->dpe_val = iv_prop->cip_ec_recov;
+		prop_entry->dpe_type = DAOS_PROP_CO_EC_RECOV;
+	}
 out:
 	if (rc)
 		daos_prop_free(prop);
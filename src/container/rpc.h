@@ -425,8 +425,9 @@ CRT_RPC_DECLARE(cont_close_v8, DAOS_ISEQ_CONT_CLOSE_V8, DAOS_OSEQ_CONT_CLOSE)
 #define DAOS_CO_QUERY_PROP_SCRUB_DIS		(1ULL << 23)
 #define DAOS_CO_QUERY_PROP_OBJ_VERSION		(1ULL << 24)
 #define DAOS_CO_QUERY_PROP_PERF_DOMAIN		(1ULL << 25)
+#define DAOS_CO_QUERY_PROP_EC_RECOV		(1ULL << 26)
 
-#define DAOS_CO_QUERY_PROP_BITS_NR		(26)
+#define DAOS_CO_QUERY_PROP_BITS_NR		(27)
 #define DAOS_CO_QUERY_PROP_ALL					\
 	((1ULL << DAOS_CO_QUERY_PROP_BITS_NR) - 1)
 
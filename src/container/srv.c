@@ -33,6 +33,12 @@ init(void)
 	if (rc)
 		D_GOTO(err_cont_iv, rc);
 
+	d_getenv_uint("DAOS_VOS_AGG_PARTS", &vos_agg_parts);
+	if (vos_agg_parts == 0 || vos_agg_parts > VOS_AGG_PARTS_MAX) {
+		D_WARN("Invalid DAOS_VOS_AGG_PARTS %u, using 1\n", vos_agg_parts);
+		vos_agg_parts = 1;
+	}
+
 	return 0;
 
 err_cont_iv:
@@ -667,6 +667,7 @@ cont_create_prop_prepare(struct ds_pool_hdl *pool_hdl,
 		case DAOS_PROP_CO_RP_PDA:
 		case DAOS_PROP_CO_PERF_DOMAIN:
 		case DAOS_PROP_CO_SCRUBBER_DISABLED:
+		case DAOS_PROP_CO_EC_RECOV:
 			entry_def->dpe_val = entry->dpe_val;
 			break;
 		case DAOS_PROP_CO_REDUN_FAC:
@@ -991,6 +992,10 @@ cont_prop_write(struct rdb_tx *tx, const rdb_path_t *kvs, daos_prop_t *prop,
 			if (rc)
 				return rc;
 			break;
+		case DAOS_PROP_CO_EC_RECOV:
+			d_iov_set(&value, &entry->dpe_val, sizeof(entry->dpe_val));
+			rc = rdb_tx_update(tx, kvs, &ds_cont_prop_ec_recov, &value);
+			break;
 		default:
 			D_ERROR("bad dpe_type %d.\n", entry->dpe_type);
 			return -DER_INVAL;
@@ -1532,6 +1537,7 @@ cont_destroy(struct rdb_tx *tx, struct ds_pool_hdl *pool_hdl, struct cont *cont,
 	struct d_ownership		owner;
 	uint32_t                        force;
 	struct daos_acl		       *acl;
+	daos_epoch_t			destroy_eph;
 	bool				need_destroy_oid_oit_kvs = false;
 
 	cont_destroy_in_get_data(rpc, opc_get(rpc->cr_opc), cont_proto_ver, &force, NULL);
@@ -1638,6 +1644,13 @@ cont_destroy(struct rdb_tx *tx, struct ds_pool_hdl *pool_hdl, struct cont *cont,
 	/* Destroy the container attribute KVS. */
 	d_iov_set(&key, cont->c_uuid, sizeof(uuid_t));
 	rc = rdb_tx_destroy_kvs(tx, &cont->c_svc->cs_conts, &key);
+	if (rc != 0)
+		goto out_prop;
+
+	/* Excluded targets still have the container, see ds_cont_destroy_epoch_get() */
+	destroy_eph = d_hlc_get();
+	d_iov_set(&val, &destroy_eph, sizeof(destroy_eph));
+	rc = rdb_tx_update(tx, &cont->c_svc->cs_root, &ds_cont_prop_destroy_epoch, &val);
 
 out_prop:
 	daos_prop_free(prop);
@@ -3095,6 +3108,23 @@ cont_prop_read(struct rdb_tx *tx, struct cont *cont, uint64_t bits,
 		}
 		idx++;
 	}
+	if (bits & DAOS_CO_QUERY_PROP_EC_RECOV) {
+		d_iov_set(&value, &val, sizeof(val));
+		rc = rdb_tx_lookup(tx, &cont->c_prop, &ds_cont_prop_ec_recov, &value);
+		if (rc == -DER_NONEXIST)
+			val = DAOS_PROP_CO_EC_RECOV_CLIENT;
+		else if (rc != 0)
+			D_GOTO(out, rc);
+		D_ASSERT(idx < nr);
+		prop->dpp_entries[idx].dpe_type = DAOS_PROP_CO_EC_RECOV;
+		prop->dpp_entries[idx].dpe_val = val;
+		if (rc == -DER_NONEXIST) {
+			prop->dpp_entries[idx].dpe_flags |= DAOS_PROP_ENTRY_NOT_SET;
+			negative_nr++;
+			rc = 0;
+		}
+		idx++;
+	}
 	if (bits & DAOS_CO_QUERY_PROP_RP_PDA) {
 		d_iov_set(&value, &val, sizeof(val));
 		rc = rdb_tx_lookup(tx, &cont->c_prop, &ds_cont_prop_rp_pda,
@@ -3443,6 +3473,7 @@ cont_query(struct rdb_tx *tx, struct ds_pool_hdl *pool_hdl, struct cont *cont,
 			case DAOS_PROP_CO_GLOBAL_VERSION:
 			case DAOS_PROP_CO_SCRUBBER_DISABLED:
 			case DAOS_PROP_CO_OBJ_VERSION:
+			case DAOS_PROP_CO_EC_RECOV:
 				if (entry->dpe_val != iv_entry->dpe_val) {
 					D_ERROR("type %d mismatch "DF_U64" - "
 						DF_U64".\n", entry->dpe_type,
@@ -4885,6 +4916,31 @@ out_svc:
 	return rc;
 }
 
+/*
+ * Get the HLC of the last container destroy in the pool into \a epoch, or 0 if
+ * none was recorded. The targets excluded at that time still have the data of
+ * the destroyed container. \a tx is a transaction of the pool service.
+ */
+int
+ds_cont_destroy_epoch_get(uuid_t pool_uuid, struct rdb_tx *tx, daos_epoch_t *epoch)
+{
+	struct cont_svc	*svc;
+	d_iov_t		 value;
+	int		 rc;
+
+	*epoch = 0;
+	rc = cont_svc_lookup_leader(pool_uuid, 0 /* id */, &svc, NULL /* hint **/);
+	if (rc != 0)
+		return rc;
+
+	d_iov_set(&value, epoch, sizeof(*epoch));
+	rc = rdb_tx_lookup(tx, &svc->cs_root, &ds_cont_prop_destroy_epoch, &value);
+	if (rc == -DER_NONEXIST)
+		rc = 0;
+	cont_svc_put_leader(svc);
+	return rc;
+}
+
 int
 ds_cont_rf_check(uuid_t pool_uuid, uuid_t cont_uuid, struct rdb_tx *tx)
 {
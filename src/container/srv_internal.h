@@ -56,6 +56,10 @@ dsm_tls_get()
 }
 
 extern bool ec_agg_disabled;
+extern unsigned int vos_agg_parts;
+
+/* Upper bound of DAOS_VOS_AGG_PARTS */
+#define VOS_AGG_PARTS_MAX	16
 
 struct ec_eph {
 	d_rank_t	rank;
@@ -148,6 +152,7 @@ struct cont_iv_prop {
 	uint32_t	cip_perf_domain;
 	uint32_t	cip_global_version;
 	uint32_t	cip_obj_version;
+	uint32_t	cip_ec_recov;
 	uint64_t	cip_valid_bits;
 	struct daos_prop_co_roots	cip_roots;
 	struct daos_co_status		cip_co_status;
@@ -39,6 +39,9 @@
  *
  * All keys are strings. Value types are specified for each key below.
  *
+ * The ds_cont_prop_destroy_epoch property stores the HLC of the last container
+ * destroy. It is consulted by the incremental reintegration mode of the pool.
+ *
  * IMPORTANT! Please add new keys to this KVS like this:
  *
  *   extern d_iov_t ds_cont_prop_new_key;	comment_on_value_type
@@ -54,6 +57,7 @@
 extern d_iov_t ds_cont_prop_cuuids;		/* container UUIDs KVS */
 extern d_iov_t ds_cont_prop_conts;		/* container KVS */
 extern d_iov_t ds_cont_prop_cont_handles;       /* container handle KVS */
+extern d_iov_t ds_cont_prop_destroy_epoch;	/* daos_epoch_t */
 /* Please read the IMPORTANT notes above before adding new keys. */
 
 /*
@@ -137,6 +141,7 @@ extern d_iov_t ds_cont_prop_co_md_times;	/* co_md_times */
 extern d_iov_t ds_cont_prop_cont_obj_version;	/* uint32_t */
 extern d_iov_t ds_cont_prop_nhandles;		/* uint32_t */
 extern d_iov_t ds_cont_prop_oit_oids;		/* snapshot OIT OID KVS */
+extern d_iov_t ds_cont_prop_ec_recov;		/* uint64_t */
 /* Please read the IMPORTANT notes above before adding new keys. */
 
 struct co_md_times {
@@ -50,6 +50,7 @@ agg_rate_ctl(void *arg)
 	struct ds_cont_child	*cont = param->ap_cont;
 	struct ds_pool		*pool = cont->sc_pool->spc_pool;
 	struct sched_request	*req = cont2req(cont, param->ap_vos_agg);
+	struct sched_request	*self = param->ap_req != NULL ? param->ap_req : req;
 	uint32_t		 msecs;
 
 	/* Abort current round of aggregation */
@@ -65,12 +66,12 @@ agg_rate_ctl(void *arg)
 
 	/* When system is idle or under space pressure, let aggregation run in tight mode */
 	if (!dss_xstream_is_busy() || sched_req_space_check(req) != SCHED_SPACE_PRESS_NONE) {
-		sched_req_yield(req);
+		sched_req_yield(self);
 		return 0;
 	}
 
 	msecs = (pool->sp_reclaim == DAOS_RECLAIM_LAZY) ? 1000 : 50;
-	sched_req_sleep(req, msecs);
+	sched_req_sleep(self, msecs);
 
 	/* System is busy and no space pressure, let aggregation run in slack mode */
 	return 1;
@@ -301,21 +302,37 @@ cont_child_aggregate(struct ds_cont_child *cont, cont_aggregate_cb_t agg_cb,
 	int			snapshots_nr;
 	int			tgt_id = dss_get_module_info()->dmi_tgt_id;
 	uint32_t		flags = 0;
+	bool			keep_punch;
 	int			i, rc = 0;
 
+	/*
+	 * An excluded target reintegrated incrementally only gets the punches that
+	 * the other targets still have, so they must not be aggregated away until
+	 * it is back. The punched entries kept meanwhile are left behind the HAE,
+	 * rescan them from 0 once no target is pending.
+	 */
+	keep_punch = param->ap_vos_agg &&
+		     cont->sc_pool->spc_reint_mode == DAOS_REINT_MODE_INCREMENTAL &&
+		     cont->sc_pool->spc_pool->sp_reint_pending;
+	if (keep_punch)
+		flags |= VOS_AGG_FL_KEEP_PUNCH;
+
 	change_hlc = max(cont->sc_snapshot_delete_hlc,
 			 cont->sc_pool->spc_rebuild_end_hlc);
-	if (param->ap_full_scan_hlc < change_hlc) {
-		/* Snapshot has been deleted or rebuild happens since the last
-		 * aggregation, let's restart from 0.
+	if (param->ap_full_scan_hlc < change_hlc || (param->ap_punch_kept && !keep_punch)) {
+		/* Snapshot has been deleted, rebuild happens or the punches
+		 * don't have to be kept any more since the last aggregation,
+		 * let's restart from 0.
 		 */
 		epoch_min = 0;
 		flags |= VOS_AGG_FL_FORCE_SCAN;
-		D_DEBUG(DB_EPC, "change hlc "DF_X64" > full "DF_X64"\n",
-			change_hlc, param->ap_full_scan_hlc);
+		D_DEBUG(DB_EPC, "change hlc "DF_X64" > full "DF_X64", punch kept %d\n",
+			change_hlc, param->ap_full_scan_hlc, param->ap_punch_kept);
 	} else {
 		epoch_min = get_hae(cont, param->ap_vos_agg);
 	}
+	if (keep_punch)
+		param->ap_punch_kept = true;
 
 	if (unlikely(DAOS_FAIL_CHECK(DAOS_FORCE_EC_AGG) ||
 		     DAOS_FAIL_CHECK(DAOS_FORCE_EC_AGG_FAIL) ||
@@ -430,8 +447,10 @@ cont_child_aggregate(struct ds_cont_child *cont, cont_aggregate_cb_t agg_cb,
 		flags &= ~VOS_AGG_FL_FORCE_MERGE;
 	rc = agg_cb(cont, &epoch_range, flags, param);
 out:
-	if (rc == 0 && epoch_min == 0)
+	if (rc == 0 && epoch_min == 0) {
 		param->ap_full_scan_hlc = hlc;
+		param->ap_punch_kept = keep_punch;
+	}
 
 	D_DEBUG(DB_EPC, DF_CONT "[%d]: Aggregating finished. %d\n",
 		DP_CONT(cont->sc_pool->spc_uuid, cont->sc_uuid), tgt_id, rc);
@@ -492,13 +511,122 @@ out:
 		dmi->dmi_tgt_id);
 }
 
+/* Number of ULTs aggregating a container concurrently, see vos_aggregate_part() */
+unsigned int vos_agg_parts = 1;
+
+struct cont_agg_part_arg {
+	struct agg_param	 apa_param;
+	daos_epoch_range_t	*apa_epr;
+	uint32_t		 apa_flags;
+	uint32_t		 apa_part;
+	bool			 apa_incomplete;
+	int			 apa_rc;
+};
+
+static void
+cont_agg_part_ult(void *data)
+{
+	struct cont_agg_part_arg	*arg = data;
+
+	arg->apa_rc = vos_aggregate_part(arg->apa_param.ap_cont->sc_hdl, arg->apa_epr,
+					 arg->apa_part, vos_agg_parts, agg_rate_ctl,
+					 &arg->apa_param, arg->apa_flags, &arg->apa_incomplete);
+}
+
+/*
+ * The dkeys of the container are partitioned over vos_agg_parts ULTs, so the merge
+ * windows of the partitions are flushed concurrently, overlapping their NVMe I/O.
+ * The aggregation ULT takes partition 0 and, once all partitions are done, the
+ * final pass over the objects. VOS is only accessible from the target xstream, the
+ * helper ULTs run on it as well.
+ */
+static int
+cont_vos_aggregate_parts(struct ds_cont_child *cont, daos_epoch_range_t *epr,
+			 uint32_t flags, struct agg_param *param)
+{
+	struct cont_agg_part_arg	*args;
+	struct sched_req_attr		 attr;
+	bool				 incomplete = false;
+	bool				 csum_err = false;
+	int				 i, rc;
+
+	D_ALLOC_ARRAY(args, vos_agg_parts);
+	if (args == NULL)
+		return -DER_NOMEM;
+
+	rc = vos_aggregate_enter(cont->sc_hdl, epr);
+	if (rc)
+		goto out;
+
+	sched_req_attr_init(&attr, SCHED_REQ_GC, &cont->sc_pool->spc_uuid);
+	for (i = 0; i < vos_agg_parts; i++) {
+		args[i].apa_param = *param;
+		args[i].apa_epr = epr;
+		args[i].apa_flags = flags;
+		args[i].apa_part = i;
+		if (i == 0)
+			continue;
+
+		args[i].apa_param.ap_req = sched_create_ult(&attr, cont_agg_part_ult, &args[i],
+							    DSS_DEEP_STACK_SZ);
+		if (args[i].apa_param.ap_req == NULL)
+			D_DEBUG(DB_EPC, DF_CONT": no helper ULT for partition %d\n",
+				DP_CONT(cont->sc_pool->spc_uuid, cont->sc_uuid), i);
+	}
+
+	cont_agg_part_ult(&args[0]);
+	for (i = 1; i < vos_agg_parts; i++) {
+		if (args[i].apa_param.ap_req == NULL) {
+			cont_agg_part_ult(&args[i]);
+			continue;
+		}
+		sched_req_wait(args[i].apa_param.ap_req, false);
+		sched_req_put(args[i].apa_param.ap_req);
+	}
+
+	for (i = 0; i < vos_agg_parts; i++) {
+		if (args[i].apa_rc == -DER_CSUM)
+			csum_err = true;
+		else if (args[i].apa_rc != 0 && rc == 0)
+			rc = args[i].apa_rc;
+		incomplete |= args[i].apa_incomplete;
+	}
+
+	/*
+	 * Objects are aggregated once the dkeys of all partitions are done. As for
+	 * vos_aggregate(), a csum error only skipped the corrupted values.
+	 */
+	if (rc == 0 && !incomplete) {
+		args[0].apa_part = vos_agg_parts;
+		cont_agg_part_ult(&args[0]);
+		if (args[0].apa_rc == -DER_CSUM)
+			csum_err = true;
+		else
+			rc = args[0].apa_rc;
+		incomplete = args[0].apa_incomplete;
+	}
+
+	if (rc == 0 && !incomplete)
+		vos_aggregate_hae_update(cont->sc_hdl, epr);
+	vos_aggregate_exit(cont->sc_hdl);
+
+	if (rc == 0 && csum_err)
+		rc = -DER_CSUM;
+out:
+	D_FREE(args);
+	return rc;
+}
+
 static int
 cont_vos_aggregate_cb(struct ds_cont_child *cont, daos_epoch_range_t *epr,
 		      uint32_t flags, struct agg_param *param)
 {
 	int rc;
 
-	rc = vos_aggregate(cont->sc_hdl, epr, agg_rate_ctl, param, flags);
+	if (vos_agg_parts > 1)
+		rc = cont_vos_aggregate_parts(cont, epr, flags, param);
+	else
+		rc = vos_aggregate(cont->sc_hdl, epr, agg_rate_ctl, param, flags);
 
 	/* Suppress csum error and continue on other epoch ranges */
 	if (rc == -DER_CSUM)
@@ -798,6 +926,125 @@ cont_child_started(struct ds_cont_child *cont_child)
 
 static int cont_close_hdl(uuid_t cont_hdl_uuid);
 
+struct cont_ec_recov_hdl_arg {
+	struct ds_pool	*pool;
+	uuid_t		 poh_uuid;
+	uuid_t		 coh_uuid;
+	d_rank_list_t	*svc_list;
+};
+
+/* Fetch the server pool/container handle UUIDs and the pool service ranks, runs in
+ * system xstream.
+ */
+static int
+cont_ec_recov_hdl_ult(void *data)
+{
+	struct cont_ec_recov_hdl_arg	*arg = data;
+	int				 rc;
+
+	rc = ds_pool_iv_srv_hdl_fetch(arg->pool, &arg->poh_uuid, &arg->coh_uuid);
+	if (rc != 0)
+		return rc;
+
+	return ds_pool_iv_svc_fetch(arg->pool, &arg->svc_list);
+}
+
+static void
+cont_ec_recov_hdl_close(struct ds_cont_child *cont)
+{
+	if (daos_handle_is_valid(cont->sc_ec_recov_coh)) {
+		dsc_cont_close(cont->sc_ec_recov_poh, cont->sc_ec_recov_coh);
+		cont->sc_ec_recov_coh = DAOS_HDL_INVAL;
+	}
+	if (daos_handle_is_valid(cont->sc_ec_recov_poh)) {
+		dsc_pool_close(cont->sc_ec_recov_poh);
+		cont->sc_ec_recov_poh = DAOS_HDL_INVAL;
+	}
+}
+
+/**
+ * Get the container handle of the engine client stack used to reconstruct EC
+ * degraded reads on this target, with a reference on the container, to be
+ * released by ds_cont_child_ec_recov_hdl_put(). The handle is opened on first
+ * use and stays open until the container is stopped, it is reopened once idle
+ * if the pool map changed, so that the client stack doesn't use a stale map.
+ */
+int
+ds_cont_child_ec_recov_hdl(struct ds_cont_child *cont, daos_handle_t *coh)
+{
+	struct cont_ec_recov_hdl_arg	 arg = { 0 };
+	struct ds_pool			*pool = cont->sc_pool->spc_pool;
+	daos_handle_t			 poh = DAOS_HDL_INVAL;
+	daos_handle_t			 tmp = DAOS_HDL_INVAL;
+	uint32_t			 map_ver;
+	int				 rc;
+
+	if (cont->sc_stopping)
+		return -DER_SHUTDOWN;
+
+	if (daos_handle_is_valid(cont->sc_ec_recov_coh)) {
+		if (cont->sc_ec_recov_map_ver == pool->sp_map_version ||
+		    cont->sc_ec_recov_users != 0)
+			goto out;
+		cont_ec_recov_hdl_close(cont);
+	}
+
+	arg.pool = pool;
+	rc = dss_ult_execute(cont_ec_recov_hdl_ult, &arg, NULL, NULL, DSS_XS_SYS, 0, 0);
+	if (rc != 0)
+		goto failed;
+
+	map_ver = pool->sp_map_version;
+	rc = dsc_pool_open(pool->sp_uuid, arg.poh_uuid, DAOS_PC_RO, NULL, pool->sp_map,
+			   arg.svc_list, &poh);
+	if (rc != 0)
+		goto failed;
+
+	rc = dsc_cont_open(poh, cont->sc_uuid, arg.coh_uuid, DAOS_COO_RO, &tmp);
+	if (rc != 0)
+		goto failed;
+
+	/* The open yields, another ULT may have done the same or the container stopped */
+	if (cont->sc_stopping || daos_handle_is_valid(cont->sc_ec_recov_coh)) {
+		dsc_cont_close(poh, tmp);
+		dsc_pool_close(poh);
+		d_rank_list_free(arg.svc_list);
+		if (cont->sc_stopping)
+			return -DER_SHUTDOWN;
+		goto out;
+	}
+
+	cont->sc_ec_recov_poh = poh;
+	cont->sc_ec_recov_coh = tmp;
+	cont->sc_ec_recov_map_ver = map_ver;
+	d_rank_list_free(arg.svc_list);
+out:
+	ds_cont_child_get(cont);
+	cont->sc_ec_recov_users++;
+	*coh = cont->sc_ec_recov_coh;
+	return 0;
+
+failed:
+	DL_ERROR(rc, DF_CONT ": failed to open EC recovery handle",
+		 DP_CONT(cont->sc_pool_uuid, cont->sc_uuid));
+	if (daos_handle_is_valid(poh))
+		dsc_pool_close(poh);
+	d_rank_list_free(arg.svc_list);
+	return rc;
+}
+
+/* Release the handle got by ds_cont_child_ec_recov_hdl(), the last user of a stopped
+ * container closes it.
+ */
+void
+ds_cont_child_ec_recov_hdl_put(struct ds_cont_child *cont)
+{
+	D_ASSERT(cont->sc_ec_recov_users > 0);
+	if (--cont->sc_ec_recov_users == 0 && cont->sc_stopping)
+		cont_ec_recov_hdl_close(cont);
+	ds_cont_child_put(cont);
+}
+
 static void
 cont_child_stop(struct ds_cont_child *cont_child)
 {
@@ -815,6 +1062,9 @@ cont_child_stop(struct ds_cont_child *cont_child)
 	 * never be started at all
 	 */
 	cont_child->sc_stopping = 1;
+	/* Otherwise closed by the last EC recovery using it */
+	if (cont_child->sc_ec_recov_users == 0)
+		cont_ec_recov_hdl_close(cont_child);
 	if (cont_child_started(cont_child)) {
 		D_DEBUG(DB_MD, DF_CONT"[%d]: Stopping container\n",
 			DP_CONT(cont_child->sc_pool->spc_uuid,
@@ -842,6 +1092,13 @@ ds_cont_child_stop_all(struct ds_pool_child *pool_child)
 		DP_UUID(pool_child->spc_uuid),
 		dss_get_module_info()->dmi_tgt_id);
 
+	/* No container shall be started behind our back */
+	if (pool_child->spc_cont_warmup_req != NULL) {
+		sched_req_wait(pool_child->spc_cont_warmup_req, true);
+		sched_req_put(pool_child->spc_cont_warmup_req);
+		pool_child->spc_cont_warmup_req = NULL;
+	}
+
 	cont_list = &pool_child->spc_cont_list;
 	while (!d_list_empty(cont_list)) {
 		cont_child = d_list_entry(cont_list->next,
@@ -928,26 +1185,79 @@ cont_child_start_cb(daos_handle_t ih, vos_iter_entry_t *entry,
 		    void *data, unsigned *acts)
 {
 	struct ds_pool_child	*pool_child = data;
+	int			 rc;
+
+	if (dss_ult_exiting(pool_child->spc_cont_warmup_req))
+		return 1;
 
-	return cont_child_start(pool_child, entry->ie_couuid, NULL, NULL);
+	rc = cont_child_start(pool_child, entry->ie_couuid, NULL, NULL);
+	/* Only this container is being stopped or destroyed, carry on with the others */
+	if (rc == -DER_SHUTDOWN)
+		D_DEBUG(DB_MD, DF_CONT "[%d]: Skip stopping container\n",
+			DP_CONT(pool_child->spc_uuid, entry->ie_couuid),
+			dss_get_module_info()->dmi_tgt_id);
+	/* The container will be started again on first access */
+	else if (rc != 0 && rc != -DER_NONEXIST)
+		DL_ERROR(rc, DF_CONT "[%d]: Failed to start container",
+			 DP_CONT(pool_child->spc_uuid, entry->ie_couuid),
+			 dss_get_module_info()->dmi_tgt_id);
+
+	/* Let the I/O through between two containers */
+	sched_req_yield(pool_child->spc_cont_warmup_req);
+	*acts |= VOS_ITER_CB_YIELD;
+	return 0;
 }
 
+static void
+cont_child_warmup_ult(void *arg)
+{
+	struct ds_pool_child	*pool_child = arg;
+	vos_iter_param_t	 iter_param = { 0 };
+	struct vos_iter_anchors	 anchors = { 0 };
+	uint64_t		 start = daos_getmtime_coarse();
+	int			 rc;
+
+	iter_param.ip_hdl = pool_child->spc_hdl;
+	rc = vos_iterate(&iter_param, VOS_ITER_COUUID, false, &anchors,
+			 cont_child_start_cb, NULL, (void *)pool_child, NULL);
+	if (rc < 0)
+		DL_ERROR(rc, DF_UUID "[%d]: Failed to start all containers",
+			 DP_UUID(pool_child->spc_uuid), dss_get_module_info()->dmi_tgt_id);
+	else if (rc > 0)
+		D_DEBUG(DB_MD, DF_UUID "[%d]: Container warm-up stopped after " DF_U64 " ms\n",
+			DP_UUID(pool_child->spc_uuid), dss_get_module_info()->dmi_tgt_id,
+			daos_getmtime_coarse() - start);
+	else
+		D_DEBUG(DB_MD, DF_UUID "[%d]: All containers started in " DF_U64 " ms\n",
+			DP_UUID(pool_child->spc_uuid), dss_get_module_info()->dmi_tgt_id,
+			daos_getmtime_coarse() - start);
+}
+
+/*
+ * The containers are started (aggregation ULTs, DTX registration) by a background ULT, so that
+ * a pool with thousands of containers can serve I/O right away.  A container accessed before the
+ * ULT got to it is started by the open (cont_child_create_start()).
+ */
 int
 ds_cont_child_start_all(struct ds_pool_child *pool_child)
 {
-	vos_iter_param_t	iter_param = { 0 };
-	struct vos_iter_anchors	anchors = { 0 };
-	int			rc;
+	struct sched_req_attr	attr;
 
 	D_DEBUG(DB_MD, DF_UUID"[%d]: Starting all containers\n",
 		DP_UUID(pool_child->spc_uuid),
 		dss_get_module_info()->dmi_tgt_id);
 
-	iter_param.ip_hdl = pool_child->spc_hdl;
-	/* The quantity of container is small, no need to yield */
-	rc = vos_iterate(&iter_param, VOS_ITER_COUUID, false, &anchors,
-			 cont_child_start_cb, NULL, (void *)pool_child, NULL);
-	return rc;
+	D_ASSERT(pool_child->spc_cont_warmup_req == NULL);
+	sched_req_attr_init(&attr, SCHED_REQ_GC, &pool_child->spc_uuid);
+	pool_child->spc_cont_warmup_req = sched_create_ult(&attr, cont_child_warmup_ult,
+							   pool_child, DSS_DEEP_STACK_SZ);
+	if (pool_child->spc_cont_warmup_req == NULL) {
+		D_ERROR(DF_UUID"[%d]: Failed to create container warm-up ULT.\n",
+			DP_UUID(pool_child->spc_uuid), dss_get_module_info()->dmi_tgt_id);
+		return -DER_NOMEM;
+	}
+
+	return 0;
 }
 
 /* ds_cont_hdl ****************************************************************/
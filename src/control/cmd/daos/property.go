@@ -596,6 +596,38 @@ var propHdlrs = propHdlrMap{
 		},
 		false,
 	},
+	C.DAOS_PROP_ENTRY_EC_RECOV: {
+		C.DAOS_PROP_CO_EC_RECOV,
+		"EC degraded read reconstruction",
+		func(h *propHdlr, e *C.struct_daos_prop_entry, v string) error {
+			vh, err := h.valHdlrs.get("ec_recov", v)
+			if err != nil {
+				return err
+			}
+
+			return vh(e, v)
+		},
+		valHdlrMap{
+			"client": setDpeVal(C.DAOS_PROP_CO_EC_RECOV_CLIENT),
+			"server": setDpeVal(C.DAOS_PROP_CO_EC_RECOV_SERVER),
+		},
+		func(e *C.struct_daos_prop_entry, name string) string {
+			if e == nil {
+				return propNotFound(name)
+			}
+
+			mode := C.get_dpe_val(e)
+			switch mode {
+			case C.DAOS_PROP_CO_EC_RECOV_CLIENT:
+				return fmt.Sprintf("client (%d)", mode)
+			case C.DAOS_PROP_CO_EC_RECOV_SERVER:
+				return fmt.Sprintf("server (%d)", mode)
+			default:
+				return fmt.Sprintf("(%d)", mode)
+			}
+		},
+		false,
+	},
 	C.DAOS_PROP_ENTRY_SNAPSHOT_MAX: {
 		C.DAOS_PROP_CO_SNAPSHOT_MAX,
 		"Max Snapshot",
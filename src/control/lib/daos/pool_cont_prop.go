@@ -265,6 +265,7 @@ const (
 )
 
 const (
-	PoolReintModeDataSync   = C.DAOS_REINT_MODE_DATA_SYNC
-	PoolReintModeNoDataSync = C.DAOS_REINT_MODE_NO_DATA_SYNC
+	PoolReintModeDataSync    = C.DAOS_REINT_MODE_DATA_SYNC
+	PoolReintModeNoDataSync  = C.DAOS_REINT_MODE_NO_DATA_SYNC
+	PoolReintModeIncremental = C.DAOS_REINT_MODE_INCREMENTAL
 )
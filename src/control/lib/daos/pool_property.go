@@ -483,6 +483,7 @@ func PoolProperties() PoolPropertyMap {
 			values: map[string]uint64{
 				"data_sync":    PoolReintModeDataSync,
 				"no_data_sync": PoolReintModeNoDataSync,
+				"incremental":  PoolReintModeIncremental,
 			},
 		},
 	}
@@ -250,7 +250,7 @@ func TestControl_PoolProperties(t *testing.T) {
 		"reintegration-invalid": {
 			name:   "reintegration",
 			value:  "bad mode",
-			expErr: errors.New(`invalid value "bad mode" for reintegration (valid: data_sync,no_data_sync)`),
+			expErr: errors.New(`invalid value "bad mode" for reintegration (valid: data_sync,incremental,no_data_sync)`),
 		},
 		"svc_ops_enabled-zero-is-valid": {
 			name:    "svc_ops_enabled",
@@ -33,6 +33,7 @@
 #define DAOS_PROP_ENTRY_GLOBAL_VERSION	"global_version"
 #define DAOS_PROP_ENTRY_OBJ_VERSION	"obj_version"
 #define DAOS_PROP_ENTRY_PERF_DOMAIN	"perf_domain"
+#define DAOS_PROP_ENTRY_EC_RECOV	"ec_recov"
 
 /** DAOS deprecated property entry names keeped for backward compatibility */
 #define DAOS_PROP_ENTRY_REDUN_FAC_OLD	"rf"
@@ -62,7 +63,8 @@ struct cont_props {
 			 dcp_dedup_enabled:1,
 			 dcp_dedup_verify:1,
 			 dcp_compress_enabled:1,
-			 dcp_encrypt_enabled:1;
+			 dcp_encrypt_enabled:1,
+			 dcp_ec_srv_recov:1;
 };
 
 void
@@ -133,6 +135,9 @@ daos_cont_rf2allowedfailures(int rf);
 uint32_t
 daos_cont_prop2ec_cell_sz(daos_prop_t *props);
 
+bool
+daos_cont_prop2ec_srv_recov(daos_prop_t *props);
+
 /*
  * alloc'ed oid property
  */
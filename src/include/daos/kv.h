@@ -11,8 +11,23 @@
 #define  __DAOS_KVX_H__
 
 #include <daos_types.h>
+#include <daos_kv.h>
 #include <daos/tse.h>
 
+/** KV multi get/put args */
+typedef struct {
+	/** KV open handle. */
+	daos_handle_t		 oh;
+	/** Transaction open handle. */
+	daos_handle_t		 th;
+	/** Operation flags. */
+	uint64_t		 flags;
+	/** Number of keys. */
+	unsigned int		 nr;
+	/** Keys and values. */
+	daos_kv_req_t		*reqs;
+} daos_kv_multi_t;
+
 /* task function for HL operations */
 int dc_kv_open(tse_task_t *task);
 int dc_kv_close(tse_task_t *task);
@@ -22,6 +37,8 @@ int dc_kv_get(tse_task_t *task);
 int dc_kv_put(tse_task_t *task);
 int dc_kv_remove(tse_task_t *task);
 int dc_kv_list(tse_task_t *task);
+int dc_kv_multi_get(tse_task_t *task);
+int dc_kv_multi_put(tse_task_t *task);
 daos_handle_t daos_kv2objhandle(daos_handle_t oh);
 
 #endif /* __DAOS_KVX_H__ */
@@ -876,9 +876,21 @@ struct umem_page {
 	struct umem_page_info   *pg_info;
 };
 
+/** Page cache counters */
+struct umem_cache_stats {
+	/** Loads of pages already in the cache */
+	uint64_t		 ucs_hits;
+	/** Loads which had to read the page from the store */
+	uint64_t		 ucs_misses;
+	/** Clean pages dropped from the cache */
+	uint64_t		 ucs_evictions;
+};
+
 /** Global cache status for each umem_store */
 struct umem_cache {
 	struct umem_store	*ca_store;
+	/** Address of page 0, all the pages are mapped contiguously */
+	uint8_t			*ca_base;
 	/** Total pages store */
 	uint64_t                 ca_num_pages;
 	/** Total pages in cache */
@@ -891,9 +903,9 @@ struct umem_cache {
 	d_list_t                 ca_pgs_dirty;
 	/** Pages waiting for copy to DMA buffer */
 	d_list_t                 ca_pgs_copying;
-	/** LRU list all pages not in one of the other states for future eviction support */
+	/** Clean pages, least recently used first, these can be evicted */
 	d_list_t                 ca_pgs_lru;
-	/** TODO: some other global status */
+	struct umem_cache_stats  ca_stats;
 	/** All pages, sorted by umem_page::pg_id */
 	struct umem_page         ca_pages[0];
 };
@@ -952,7 +964,11 @@ umem_page2store(struct umem_page *page)
 /** Allocate global cache for umem store.  All 16MB pages are initially unmapped
  *
  * \param[in]	store		The umem store
- * \param[in]	max_mapped	0 or Maximum number of mapped 16MB pages (must be 0 for now)
+ * \param[in]	max_mapped	0 or Maximum number of mapped 16MB pages, the memory budget of
+ *				the cache. 0 means all the pages of the store.
+ *
+ * NB: the DAV allocator always passes 0 and accesses the heap without umem_cache_load() or
+ * umem_cache_pin(), a smaller budget can't be used until it does.
  *
  * \return 0 on success
  */
@@ -978,7 +994,8 @@ umem_cache_free(struct umem_store *store);
 int
 umem_cache_check(struct umem_store *store, uint64_t num_pages);
 
-/** Evict the pages.   This invokes the unmap callback. (XXX: not yet implemented)
+/** Evict the least recently used clean and unpinned pages, their memory is released and they
+ *  are read from the store again on their next load.
  *
  * \param[in]	store		The store
  * \param[in]	num_pages	Number of pages to evict
@@ -988,7 +1005,9 @@ umem_cache_check(struct umem_store *store, uint64_t num_pages);
 int
 umem_cache_evict(struct umem_store *store, uint64_t num_pages);
 
-/** Adds a mapped range of pages to the page cache.
+/** Adds a mapped range of pages to the page cache.  The range is already loaded, pages are
+ *  evicted if needed to stay within the budget.  The store must be mapped contiguously, the
+ *  pages which aren't in the cache are loaded at the same place.
  *
  * \param[in]	store		The store
  * \param[in]	offset		The offset in the umem cache
@@ -1001,19 +1020,39 @@ int
 umem_cache_map_range(struct umem_store *store, umem_off_t offset, void *start_addr,
 		     uint64_t num_pages);
 
+/** Make the pages of a range resident, reading them from the store on first access.  Can yield
+ *  while reading.  Unpinned pages may be evicted at the next load which doesn't find room in the
+ *  cache, hence callers accessing the range across a yield should pin it.  Loading without
+ *  pinning prefetches the range, e.g. the nodes an iterator is about to visit.
+ *
+ *  \param[in]	store	The umem store
+ *  \param[in]	addr	The start address
+ *  \param[in]	size	The size of the range
+ *  \param[in]	pin	Take a reference on the pages, see umem_cache_pin()
+ *
+ *  \return 0 on success, -DER_BUSY if every page is dirty or pinned and a checkpoint is needed,
+ *	   -DER_AGAIN if another caller is loading one of the pages.
+ */
+int
+umem_cache_load(struct umem_store *store, umem_off_t addr, daos_size_t size, bool pin);
+
 /** Take a reference on the pages in the range.   Only needed for cases where we need the page to
- *  stay loaded across a yield, such as the VOS object cache.  Pages in the range must be mapped.
+ *  stay loaded across a yield, such as the VOS object cache or a transaction.  Pages which aren't
+ *  in the cache are loaded first, see umem_cache_load().  On failure no reference is held on any
+ *  page of the range.  Neither error is fatal: on -DER_AGAIN the caller should yield and retry, on
+ *  -DER_BUSY it should retry once a checkpoint has cleaned some pages.
  *
  *  \param[in]	store	The umem store
  *  \param[in]	addr	The address of the hold
  *  \param[in]	size	The size of the hold
  *
- *  \return 0 on success
+ *  \return 0 on success, -DER_BUSY if every page is dirty or pinned and a checkpoint is needed,
+ *	   -DER_AGAIN if another caller is loading one of the pages, or the error from so_read.
  */
 int
 umem_cache_pin(struct umem_store *store, umem_off_t addr, daos_size_t size);
 
-/** Release a reference on pages in the range.  Pages in the range must be mapped and held.
+/** Release a reference on pages in the range.  Pages in the range must be loaded and held.
  *
  *  \param[in]	store	The umem store
  *  \param[in]	addr	The address of the hold
@@ -1068,6 +1107,26 @@ int
 umem_cache_checkpoint(struct umem_store *store, umem_cache_wait_cb_t wait_cb, void *arg,
 		      uint64_t *chkpt_id, struct umem_cache_chkpt_stats *chkpt_stats);
 
+/**
+ * Write the dirty pages holding the oldest writes to MD blob, at most @max_pages of them, so
+ * that checkpointing can run continuously in small steps.  When dirty pages are left, the
+ * returned ID is the highest transaction whose writes are all in the MD blob, the WAL can be
+ * purged up to it.  -1 is returned if there is none.
+ *
+ * \param[in]		store		The umem store
+ * \param[in]		wait_cb		Callback for to wait for wal commit completion
+ * \param[in]		arg		argument for wait_cb
+ * \param[in]		max_pages	Maximum number of pages to write, 0 for all of them
+ * \param[in,out]	chkpt_id	Input is last committed id, output is checkpointed id
+ * \param[out]		chkpt_stats	check point stats
+ *
+ * \return 0 on success
+ */
+int
+umem_cache_checkpoint_incr(struct umem_store *store, umem_cache_wait_cb_t wait_cb, void *arg,
+			   uint64_t max_pages, uint64_t *chkpt_id,
+			   struct umem_cache_chkpt_stats *chkpt_stats);
+
 #endif /** DAOS_PMEM_BUILD */
 
 #endif /* __DAOS_MEM_H__ */
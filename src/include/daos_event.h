@@ -47,6 +47,67 @@ extern "C" {
 int
 daos_eq_create(daos_handle_t *eqh);
 
+/** The EQ owns an eventfd which is readable while completed events wait to be reaped */
+#define DAOS_EQ_FL_FD		(1U << 0)
+
+/**
+ * Create an Event Queue with extra behaviors, see daos_eq_create().
+ *
+ * \param[out] eqh	Returned EQ handle
+ * \param[in] flags	Bitmask of DAOS_EQ_FL_*
+ *
+ * \return		Zero on success, negative value if error
+ */
+int
+daos_eq_create_ext(daos_handle_t *eqh, unsigned int flags);
+
+/**
+ * Get the eventfd of an EQ created with DAOS_EQ_FL_FD, so it can be added to the
+ * epoll/poll set of the application. The fd becomes readable when an event completes
+ * and stays readable until all completed events are reaped, the caller must not read
+ * or close it.
+ *
+ * Events only complete while the EQ is progressed, by daos_eq_poll() or by
+ * daos_eq_progress() from a progress thread.
+ *
+ * \param[in] eqh	EQ handle
+ * \param[out] fd	Returned eventfd
+ *
+ * \return		Zero on success, -DER_NOSYS if the EQ has no fd
+ */
+int
+daos_eq_get_fd(daos_handle_t eqh, int *fd);
+
+/**
+ * Progress the network and scheduler of an EQ without retrieving completed events,
+ * for an application which dedicates a thread to progress and reaps the events from
+ * other threads with daos_eq_reap().
+ *
+ * \param[in] eqh	EQ handle
+ * \param[in] timeout	How long to progress (micro-second) if no event completes during
+ *			the call, the events completed before and not reaped yet don't
+ *			stop it. It can also be DAOS_EQ_NOWAIT, DAOS_EQ_WAIT
+ *
+ * \return		>= 0	Number of completed events waiting to be reaped
+ *			< 0	negative value if error
+ */
+int
+daos_eq_progress(daos_handle_t eqh, int64_t timeout);
+
+/**
+ * Retrieve up to \a nevents completed events from an EQ in one batch, without
+ * progressing or waiting.
+ *
+ * \param[in] eqh	EQ handle
+ * \param[in] nevents	Size of \a events array
+ * \param[out] events	Pointer to returned events array
+ *
+ * \return		>= 0	Returned number of events
+ *			< 0	negative value if error
+ */
+int
+daos_eq_reap(daos_handle_t eqh, unsigned int nevents, daos_event_t **events);
+
 #define DAOS_EQ_DESTROY_FORCE	1
 /**
  * Destroy an Event Queue, it returns -DER_BUSY if EQ is not empty.
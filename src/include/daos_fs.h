@@ -637,6 +637,30 @@ dfs_get_size(dfs_t *dfs, dfs_obj_t *obj, daos_size_t *size);
 int
 dfs_punch(dfs_t *dfs, dfs_obj_t *obj, daos_off_t offset, daos_size_t len);
 
+/**
+ * Copy \a len bytes of file \a src at \a src_off to file \a dst at \a dst_off. This is a
+ * client-side copy: the data is read into client buffers and written back from them, so it still
+ * crosses the client network link twice. The copy is pipelined: several source chunks are read at
+ * once and each is written as soon as it is read, so the copy is not serialized on the round trips
+ * of each chunk. Chunks larger than 16MiB are copied in 16MiB pieces, which bounds the memory used
+ * by the copy. The two files can be in different containers, but the ranges must not overlap if
+ * they are the same file.
+ *
+ * \param[in]	src_dfs	Pointer to the mounted file system of the source.
+ * \param[in]	src	Opened source file object.
+ * \param[in]	src_off	Offset in the source file.
+ * \param[in]	dst_dfs	Pointer to the mounted file system of the destination.
+ * \param[in]	dst	Opened destination file object.
+ * \param[in]	dst_off	Offset in the destination file.
+ * \param[in]	len	Number of bytes to copy, the copy stops at the end of the source.
+ * \param[out]	copied	Number of bytes copied from the start of the range, also on failure.
+ *
+ * \return		0 on success, errno code on failure.
+ */
+int
+dfs_copy_range(dfs_t *src_dfs, dfs_obj_t *src, daos_off_t src_off, dfs_t *dst_dfs,
+	       dfs_obj_t *dst, daos_off_t dst_off, daos_size_t len, daos_size_t *copied);
+
 /**
  * directory readdir.
  *
@@ -795,6 +819,70 @@ int
 dfs_remove(dfs_t *dfs, dfs_obj_t *parent, const char *name, bool force,
 	   daos_obj_id_t *oid);
 
+/**
+ * Create many regular files in the same directory, with the same mode. The entry of each file is
+ * inserted with its own conditional update, and all of them are in flight together. Files are
+ * not opened; use dfs_lookup_rel() or dfs_open() to access one.
+ *
+ * \param[in]	dfs	Pointer to the mounted file system.
+ * \param[in]	parent	Opened parent directory object. If NULL, use root obj.
+ * \param[in]	nr	Number of files to create.
+ * \param[in]	names	Array of \a nr link names of the new files. The names must stay valid
+ *			until the operation completes.
+ * \param[in]	mode	Permission bits of the files (S_IFREG is implied).
+ * \param[in]	cid	DAOS object class id (pass 0 for default, as dfs_open()).
+ * \param[in]	chunk_size
+ *			Chunk size of the files (pass 0 for default).
+ * \param[out]	rcs	Array of \a nr errno codes, the result for each file: 0, EEXIST if
+ *			the name is already used, etc.
+ * \param[in]	ev	Completion event, it is optional and can be NULL.
+ *			Function will run in blocking mode if \a ev is NULL.
+ *
+ * \return		0 if the batch ran (check \a rcs), errno code on failure.
+ */
+int
+dfs_create_batch(dfs_t *dfs, dfs_obj_t *parent, uint32_t nr, const char **names, mode_t mode,
+		 daos_oclass_id_t cid, daos_size_t chunk_size, int *rcs, daos_event_t *ev);
+
+/**
+ * Remove many files or symlinks from the same directory. Directories are not removed by a batch
+ * (EISDIR), use dfs_remove() for them. Entries are removed one by one, not in a transaction, even
+ * if the container was created in balanced mode.
+ *
+ * \param[in]	dfs	Pointer to the mounted file system.
+ * \param[in]	parent	Opened parent directory object. If NULL, use root obj.
+ * \param[in]	nr	Number of entries to remove.
+ * \param[in]	names	Array of \a nr names of entries to remove. The names must stay valid
+ *			until the operation completes.
+ * \param[out]	rcs	Array of \a nr errno codes, the result for each entry.
+ * \param[in]	ev	Completion event, it is optional and can be NULL.
+ *			Function will run in blocking mode if \a ev is NULL.
+ *
+ * \return		0 if the batch ran (check \a rcs), errno code on failure.
+ */
+int
+dfs_remove_batch(dfs_t *dfs, dfs_obj_t *parent, uint32_t nr, const char **names, int *rcs,
+		 daos_event_t *ev);
+
+/**
+ * Stat many entries of the same directory, as dfs_stat() does for one entry.
+ *
+ * \param[in]	dfs	Pointer to the mounted file system.
+ * \param[in]	parent	Opened parent directory object. If NULL, use root obj.
+ * \param[in]	nr	Number of entries.
+ * \param[in]	names	Array of \a nr names of entries to stat. The names must stay valid
+ *			until the operation completes.
+ * \param[out]	stbufs	Array of \a nr stat structs, valid where \a rcs is 0.
+ * \param[out]	rcs	Array of \a nr errno codes, the result for each entry.
+ * \param[in]	ev	Completion event, it is optional and can be NULL.
+ *			Function will run in blocking mode if \a ev is NULL.
+ *
+ * \return		0 if the batch ran (check \a rcs), errno code on failure.
+ */
+int
+dfs_stat_batch(dfs_t *dfs, dfs_obj_t *parent, uint32_t nr, const char **names,
+	       struct stat *stbufs, int *rcs, daos_event_t *ev);
+
 /**
  * Move/rename an object.
  *
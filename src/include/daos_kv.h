@@ -200,6 +200,75 @@ daos_kv_list(daos_handle_t oh, daos_handle_t th, uint32_t *nr,
 	     daos_key_desc_t *kds, d_sg_list_t *sgl, daos_anchor_t *anchor,
 	     daos_event_t *ev);
 
+/** One key of a daos_kv_multi_get() or daos_kv_multi_put() request */
+typedef struct {
+	/** Key, NULL terminated string. */
+	const char		*kvr_key;
+	/**
+	 * Put: size of the value.
+	 * Get: [in]: size of \a kvr_buf (can be DAOS_REC_ANY). [out]: the actual size of the
+	 * value, zero if the key doesn't exist.
+	 */
+	daos_size_t		 kvr_size;
+	/** Value buffer, for get it can be NULL to only return the size. */
+	void			*kvr_buf;
+	/** [out]: result of this key, e.g. -DER_REC2BIG if \a kvr_buf is too small. */
+	int			 kvr_rc;
+} daos_kv_req_t;
+
+/**
+ * Insert or update the values of a batch of keys. This is a convenience wrapper completing
+ * as a single operation: each key is still sent with its own update RPC, as with
+ * daos_kv_put(), and keys going to the same target aren't grouped.
+ *
+ * \param[in]	oh	Object open handle.
+ * \param[in]	th	Transaction handle.
+ * \param[in]	flags	Update flags, applied to all keys.
+ * \param[in]	nr	Number of keys in \a reqs.
+ * \param[in,out]
+ *		reqs	Array of \a nr keys with their value, the result of each key is
+ *			returned in kvr_rc.
+ * \param[in]	ev	Completion event, it is optional and can be NULL.
+ *			Function will run in blocking mode if \a ev is NULL.
+ *
+ * \return		These values will be returned by \a ev::ev_error in
+ *			non-blocking mode:
+ *			0		Success
+ *			-DER_NO_HDL	Invalid object open handle
+ *			-DER_INVAL	Invalid parameter
+ *			-DER_NOMEM	Out of memory
+ *			Otherwise the error of the first failed key
+ */
+int
+daos_kv_multi_put(daos_handle_t oh, daos_handle_t th, uint64_t flags, unsigned int nr,
+		  daos_kv_req_t *reqs, daos_event_t *ev);
+
+/**
+ * Fetch the values of a batch of keys, see daos_kv_multi_put().
+ *
+ * \param[in]	oh	Object open handle.
+ * \param[in]	th	Transaction handle.
+ * \param[in]	flags	Fetch flags, applied to all keys.
+ * \param[in]	nr	Number of keys in \a reqs.
+ * \param[in,out]
+ *		reqs	Array of \a nr keys, the value, size and result of each key
+ *			are returned in it.
+ * \param[in]	ev	Completion event, it is optional and can be NULL.
+ *			Function will run in blocking mode if \a ev is NULL.
+ *
+ * \return		These values will be returned by \a ev::ev_error in
+ *			non-blocking mode:
+ *			0		Success
+ *			-DER_NO_HDL	Invalid object open handle
+ *			-DER_INVAL	Invalid parameter
+ *			-DER_NOMEM	Out of memory
+ *			Otherwise the error of the first failed key, e.g.
+ *			-DER_REC2BIG	Value does not fit in buffer
+ */
+int
+daos_kv_multi_get(daos_handle_t oh, daos_handle_t th, uint64_t flags, unsigned int nr,
+		  daos_kv_req_t *reqs, daos_event_t *ev);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -133,7 +133,10 @@ enum daos_pool_props {
 	DAOS_PROP_PO_CHECKPOINT_FREQ,
 	/** WAL usage threshold to trigger checkpoint, default is 50% */
 	DAOS_PROP_PO_CHECKPOINT_THRESH,
-	/** Reintegration mode for pool, data_sync|no_data_sync default is data_sync*/
+	/**
+	 * Reintegration mode for pool, data_sync|no_data_sync|incremental
+	 * default is data_sync
+	 */
 	DAOS_PROP_PO_REINT_MODE,
 	/** Metadata duplicate operations detection enabled (1) or disabled (0) */
 	DAOS_PROP_PO_SVC_OPS_ENABLED,
@@ -216,6 +219,8 @@ enum {
 enum {
 	DAOS_REINT_MODE_DATA_SYNC = 0,
 	DAOS_REINT_MODE_NO_DATA_SYNC = 1,
+	/** Only discard and rebuild the data written after the target was excluded */
+	DAOS_REINT_MODE_INCREMENTAL = 2,
 };
 
 /**
@@ -383,9 +388,22 @@ enum daos_cont_props {
 	DAOS_PROP_CO_OBJ_VERSION,
 	/** The container performance domain, now always inherit from pool */
 	DAOS_PROP_CO_PERF_DOMAIN,
+	/**
+	 * Where EC degraded reads are reconstructed, see DAOS_PROP_CO_EC_RECOV_CLIENT.
+	 * Default: DAOS_PROP_CO_EC_RECOV_CLIENT
+	 */
+	DAOS_PROP_CO_EC_RECOV,
 	DAOS_PROP_CO_MAX,
 };
 
+/** container EC degraded read reconstruction */
+enum {
+	/** the client fetches the surviving cells and decodes them */
+	DAOS_PROP_CO_EC_RECOV_CLIENT,
+	/** the parity shard engine decodes and only returns the requested range */
+	DAOS_PROP_CO_EC_RECOV_SERVER,
+};
+
 /** first citizen objects of a container, stored as container property */
 struct daos_prop_co_roots {
 	/** array that stores root, SB OIDs */
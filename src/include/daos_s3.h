@@ -574,6 +574,39 @@ ds3_upload_init(struct ds3_multipart_upload_info *info, const char *bucket_name,
 int
 ds3_upload_remove(const char *bucket_name, const char *upload_id, ds3_t *ds3);
 
+/**
+ * Complete an S3 multipart upload whose parts were written with ds3_upload_part_open().
+ * The upload data becomes the object \a key and only the part layout is recorded, so the
+ * cost is in the number of parts, not in their size. The upload entry is left to
+ * ds3_upload_remove().
+ *
+ * \param[in]	upload_id	ID of the upload.
+ * \param[in]	key		Key of the S3 object to create.
+ * \param[in]	nparts		Number of parts in \a part_nums and \a part_sizes.
+ * \param[in]	part_nums	Numbers of the parts making the object, in ascending order.
+ * \param[in]	part_sizes	Sizes of the parts.
+ * \param[in]	info		(Optional) S3 object info to set.
+ * \param[in]	ds3b		Pointer to the S3 bucket handle to use.
+ *
+ * \return			0 on success, -E2BIG if the layout of the parts is too large
+ *				to be recorded, -errno code on failure.
+ */
+int
+ds3_upload_complete(const char *upload_id, const char *key, uint32_t nparts,
+		    const uint64_t *part_nums, const daos_size_t *part_sizes,
+		    struct ds3_object_info *info, ds3_bucket_t *ds3b);
+
+/**
+ * Remove the data of an aborted S3 multipart upload written with ds3_upload_part_open().
+ *
+ * \param[in]	upload_id	ID of the upload.
+ * \param[in]	ds3b		Pointer to the S3 bucket handle to use.
+ *
+ * \return			0 on success, -errno code on failure.
+ */
+int
+ds3_upload_remove_data(const char *upload_id, ds3_bucket_t *ds3b);
+
 /**
  * Gwt S3 multipart upload info identified by \a upload_id in the bucket identified by \a
  * bucket_name
@@ -653,6 +686,25 @@ int
 ds3_part_read(void *buf, daos_off_t off, daos_size_t *size, ds3_part_t *ds3p, ds3_t *ds3,
 	      daos_event_t *ev);
 
+/**
+ * Open an S3 multipart part identified by \a part_num whose data is written in place in the
+ * bucket, at the slot of the part in the data of the upload. The upload can then be completed
+ * by ds3_upload_complete() without copying the parts.
+ *
+ * \param[in]	bucket_name	Name of the bucket.
+ * \param[in]	upload_id	ID of the upload.
+ * \param[in]	part_num	The part number, from 1 to 10000.
+ * \param[in]	truncate	whether to truncate the part.
+ * \param[out]	ds3p		Returned S3 part handle.
+ * \param[in]	ds3b		Pointer to the S3 bucket handle to use.
+ * \param[in]	ds3		Pointer to the DAOS S3 pool handle to use.
+ *
+ * \return			0 on success, -errno code on failure.
+ */
+int
+ds3_upload_part_open(const char *bucket_name, const char *upload_id, uint64_t part_num,
+		     bool truncate, ds3_part_t **ds3p, ds3_bucket_t *ds3b, ds3_t *ds3);
+
 /**
  * Set S3 part info.
  *
@@ -119,6 +119,10 @@ struct ds_cont_child {
 	 * if it needs to do EC aggregate.
 	 */
 	uint64_t		sc_ec_update_timestamp;
+	/* Objects with most replica bytes pending EC aggregation, owned by the
+	 * EC aggregation ULT.
+	 */
+	struct ec_agg_hot	*sc_ec_agg_hot;
 
 	/* The objects with committable DTXs in DRAM. */
 	daos_handle_t		 sc_dtx_cos_hdl;
@@ -132,13 +136,26 @@ struct ds_cont_child {
 	uint32_t		 sc_status_pm_ver;
 	/* flag of CONT_CAPA_READ_DATA/_WRITE_DATA disabled */
 	uint32_t		 sc_rw_disabled:1;
+	/* Pool/container handles of the engine client stack, opened on demand to
+	 * reconstruct EC degraded reads locally (DAOS_PROP_CO_EC_RECOV).
+	 */
+	daos_handle_t		 sc_ec_recov_poh;
+	daos_handle_t		 sc_ec_recov_coh;
+	/* Pool map version the handles were opened with */
+	uint32_t		 sc_ec_recov_map_ver;
+	/* Number of EC recoveries using the handles */
+	uint32_t		 sc_ec_recov_users;
 };
 
 struct agg_param {
 	void			*ap_data;
 	struct ds_cont_child	*ap_cont;
+	/* Sched request of the helper ULT aggregating a partition, see vos_aggregate_part() */
+	struct sched_request	*ap_req;
 	daos_epoch_t		ap_full_scan_hlc;
 	bool			ap_vos_agg;
+	/* The last VOS aggregation kept the punched entries, see VOS_AGG_FL_KEEP_PUNCH */
+	bool			ap_punch_kept;
 };
 
 typedef int (*cont_aggregate_cb_t)(struct ds_cont_child *cont,
@@ -204,6 +221,8 @@ void ds_cont_child_get(struct ds_cont_child *cont);
 
 int ds_cont_child_open_create(uuid_t pool_uuid, uuid_t cont_uuid,
 			      struct ds_cont_child **cont);
+int ds_cont_child_ec_recov_hdl(struct ds_cont_child *cont, daos_handle_t *coh);
+void ds_cont_child_ec_recov_hdl_put(struct ds_cont_child *cont);
 
 typedef int (*cont_iter_cb_t)(uuid_t co_uuid, vos_iter_entry_t *ent, void *arg);
 int ds_cont_iter(daos_handle_t ph, uuid_t co_uuid, cont_iter_cb_t callback,
@@ -263,6 +282,7 @@ void ds_cont_ec_timestamp_update(struct ds_cont_child *cont);
 typedef int(*cont_rdb_iter_cb_t)(uuid_t pool_uuid, uuid_t cont_uuid, struct rdb_tx *tx, void *arg);
 int ds_cont_rdb_iterate(struct cont_svc *svc, cont_rdb_iter_cb_t iter_cb, void *cb_arg);
 int ds_cont_rf_check(uuid_t pool_uuid, uuid_t cont_uuid, struct rdb_tx *tx);
+int ds_cont_destroy_epoch_get(uuid_t pool_uuid, struct rdb_tx *tx, daos_epoch_t *epoch);
 
 int ds_cont_fetch_ec_agg_boundary(void *ns, uuid_t cont_uuid);
 #endif /* ___DAOS_SRV_CONTAINER_H_ */
@@ -493,6 +493,7 @@ vos_cont_query(daos_handle_t coh, vos_cont_info_t *cinfo);
 enum {
 	VOS_AGG_FL_FORCE_SCAN	= (1UL << 0),	/* Scan all obj/dkey/akeys */
 	VOS_AGG_FL_FORCE_MERGE	= (1UL << 1),	/* Merge all coalesce-able EV records */
+	VOS_AGG_FL_KEEP_PUNCH	= (1UL << 2),	/* Don't remove punched obj/dkey/akeys */
 };
 
 /**
@@ -513,6 +514,32 @@ int
 vos_aggregate(daos_handle_t coh, daos_epoch_range_t *epr,
 	      int (*yield_func)(void *arg), void *yield_arg, uint32_t flags);
 
+/**
+ * Aggregate one partition of the container within the epoch range \a epr, so that
+ * several ULTs can aggregate the same container concurrently. The dkeys are hashed
+ * over partitions [0, \a part_nr), the objects themselves are aggregated by the final
+ * partition \a part_nr, which must only run once all the others are done.
+ *
+ * Caller must hold the aggregation by vos_aggregate_enter() for all the partitions,
+ * and bump the HAE by vos_aggregate_hae_update() if none of them was incomplete.
+ *
+ * \param coh	  [IN]		Container open handle
+ * \param epr	  [IN]		The epoch range of aggregation
+ * \param part	  [IN]		Partition to aggregate, \a part_nr for the final one
+ * \param part_nr    [IN]		Number of dkey partitions
+ * \param yield_func [IN]	Pointer to customized yield function
+ * \param yield_arg  [IN]	Argument of yield function
+ * \param flags      [IN]	Aggregation flags
+ * \param incomplete [OUT]	Set when entries were left behind (uncommitted
+ *				entries, space shortage or error)
+ *
+ * \return			Zero on success, negative value if error
+ */
+int
+vos_aggregate_part(daos_handle_t coh, daos_epoch_range_t *epr, uint32_t part,
+		   uint32_t part_nr, int (*yield_func)(void *arg), void *yield_arg,
+		   uint32_t flags, bool *incomplete);
+
 /**
  * Discards changes in all epochs with the epoch range \a epr
  *
@@ -1341,6 +1368,16 @@ vos_pool_needs_checkpoint(daos_handle_t poh);
 int
 vos_pool_checkpoint(daos_handle_t poh);
 
+/** Checkpoint at most @max_pages dirty pages of the VOS pool, the ones holding the oldest
+ *  transactions, and purge the WAL as far as they allow.  Called repeatedly in the background
+ *  to keep the WAL usage low without the I/O burst of a full checkpoint.
+ *
+ * \param[in] poh		Open vos pool handle
+ * \param[in] max_pages		Maximum number of pages to write, 0 for a full checkpoint
+ */
+int
+vos_pool_checkpoint_incr(daos_handle_t poh, uint64_t max_pages);
+
 /**
  * The following declarations are for checksum scrubbing functions. The function
  * types provide an interface for injecting dependencies into the
@@ -1392,6 +1429,8 @@ struct scrub_ctx_metrics {
 	struct d_tm_node_t	*scm_corruption;
 	struct d_tm_node_t	*scm_corruption_total;
 	struct d_tm_node_t	*scm_scrub_count;
+	struct d_tm_node_t	*scm_bytes_per_sec;
+	struct d_tm_node_t	*scm_coverage;
 	struct timespec		 scm_busy_start;
 
 };
@@ -1416,6 +1455,8 @@ struct scrub_ctx {
 	int			 sc_pool_last_csum_calcs;
 	int			 sc_pool_csum_calcs;
 	uint64_t		 sc_bytes_scrubbed;
+	/* bytes scrubbed by the previous tree scrub, for the coverage metric */
+	uint64_t		 sc_bytes_scrubbed_last;
 	uint32_t		 sc_pool_tgt_corrupted_detected;
 	ds_pool_tgt_drain	 sc_drain_pool_tgt_fn;
 
@@ -1443,6 +1484,18 @@ struct scrub_ctx {
 	/* Current vos object iterator */
 	daos_handle_t		 sc_vos_iter_handle;
 
+	/**
+	 * Batching, checksums are verified back to back until sc_batch_max bytes have
+	 * been scrubbed, only then does the scrubber pace itself. The batch grows while
+	 * the target is idle and shrinks while it is busy.
+	 */
+	uint64_t		 sc_batch_bytes;
+	uint64_t		 sc_batch_max;
+	uint32_t		 sc_batch_csums;
+	/* Read buffer reused across extents */
+	void			*sc_buf;
+	uint64_t		 sc_buf_len;
+
 	/* Schedule controlling function pointers and arg */
 	sc_is_idle_fn_t		 sc_is_idle_fn;
 	sc_sleep_fn_t		 sc_sleep_fn;
@@ -1535,4 +1588,13 @@ vos_aggregate_enter(daos_handle_t coh, daos_epoch_range_t *epr);
 void
 vos_aggregate_exit(daos_handle_t coh);
 
+/**
+ * Bump the HAE (Highest Aggregated Epoch) once all the partitions of an aggregation
+ * completed, see vos_aggregate_part().
+ * \param[in]	coh	container open handle.
+ * \param[in]	epr	aggregated epoch range.
+ */
+void
+vos_aggregate_hae_update(daos_handle_t coh, daos_epoch_range_t *epr);
+
 #endif /* __VOS_API_H */
@@ -1945,48 +1945,6 @@ tgt_check:
 	}
 }
 
-static struct obj_ec_recov_codec *
-obj_ec_recov_codec_alloc(struct daos_oclass_attr *oca)
-{
-	struct obj_ec_recov_codec	*recov;
-	unsigned short			 k = obj_ec_data_tgt_nr(oca);
-	unsigned short			 p = obj_ec_parity_tgt_nr(oca);
-	void				*buf, *tmp_ptr;
-	size_t				 struct_size, tbl_size, matrix_size;
-	size_t				 idx_size, list_size, err_size;
-
-	struct_size = roundup(sizeof(struct obj_ec_recov_codec), 8);
-	tbl_size = k * p * 32;
-	matrix_size = roundup((k + p) * k, 8);
-	idx_size = roundup(sizeof(uint32_t) * k, 8);
-	list_size = roundup(sizeof(uint32_t) * p, 8);
-	err_size = roundup(sizeof(bool) * (k + p), 8);
-
-	D_ALLOC(buf, struct_size + tbl_size + 3 * matrix_size + idx_size +
-		     list_size + err_size);
-	if (buf == NULL)
-		return NULL;
-
-	tmp_ptr = buf;
-	recov = buf;
-	tmp_ptr += struct_size;
-	recov->er_gftbls = tmp_ptr;
-	tmp_ptr += tbl_size;
-	recov->er_de_matrix = tmp_ptr;
-	tmp_ptr += matrix_size;
-	recov->er_inv_matrix = tmp_ptr;
-	tmp_ptr += matrix_size;
-	recov->er_b_matrix = tmp_ptr;
-	tmp_ptr += matrix_size;
-	recov->er_dec_idx = tmp_ptr;
-	tmp_ptr += idx_size;
-	recov->er_err_list = tmp_ptr;
-	tmp_ptr += list_size;
-	recov->er_in_err = tmp_ptr;
-
-	return recov;
-}
-
 int
 obj_ec_recov_add(struct obj_reasb_req *reasb_req,
 		 struct daos_recx_ep_list *recx_lists, unsigned int nr)
@@ -2081,8 +2039,12 @@ out:
 static void
 obj_ec_recov_codec_free(struct obj_reasb_req *reasb_req)
 {
-	if (reasb_req->orr_fail)
-		D_FREE(reasb_req->orr_fail->efi_recov_codec);
+	struct obj_ec_fail_info	*fail_info = reasb_req->orr_fail;
+
+	if (fail_info != NULL && fail_info->efi_recov_codec != NULL) {
+		obj_ec_recov_codec_put(fail_info->efi_recov_codec);
+		fail_info->efi_recov_codec = NULL;
+	}
 }
 
 struct obj_ec_fail_info *
@@ -2133,18 +2095,6 @@ obj_ec_fail_info_reset(struct obj_reasb_req *reasb_req)
 	reasb_req->orr_parity_list_nr = 0;
 }
 
-static bool
-obj_ec_err_match(uint32_t nerrs, uint32_t *err_list1, uint32_t *err_list2)
-{
-	uint32_t	i;
-
-	for (i = 0; i < nerrs; i++) {
-		if (err_list1[i] != err_list2[i])
-			return false;
-	}
-	return true;
-}
-
 static int
 obj_ec_recov_codec_init(struct dc_object *obj, struct obj_reasb_req *reasb_req,
 			uint64_t dkey_hash, uint32_t nerrs, uint32_t *err_list)
@@ -2153,10 +2103,9 @@ obj_ec_recov_codec_init(struct dc_object *obj, struct obj_reasb_req *reasb_req,
 	struct obj_ec_fail_info		*fail_info = reasb_req->orr_fail;
 	struct obj_ec_codec		*codec;
 	struct obj_ec_recov_codec	*recov;
-	unsigned char			s;
-	uint32_t			i, j, r, k, p;
-	uint32_t			err_tgt_off;
-	int				rc;
+	uint32_t			 err_offs[OBJ_EC_MAX_P];
+	uint32_t			 i, k, p;
+	int				 rc;
 
 	D_ASSERT(fail_info != NULL);
 	k = obj_ec_data_tgt_nr(oca);
@@ -2169,78 +2118,23 @@ obj_ec_recov_codec_init(struct dc_object *obj, struct obj_reasb_req *reasb_req,
 		return rc;
 	}
 
-	if (fail_info->efi_recov_codec == NULL) {
-		fail_info->efi_recov_codec = obj_ec_recov_codec_alloc(oca);
-		if (fail_info->efi_recov_codec == NULL)
-			return -DER_NOMEM;
-	}
-	recov = fail_info->efi_recov_codec;
-
-	if (recov->er_nerrs == nerrs &&
-	    obj_ec_err_match(nerrs, err_list, recov->er_err_list))
-		return 0;
-
 	codec = codec_get(reasb_req, obj->cob_md.omd_id);
 	if (codec == NULL)
 		return -DER_INVAL;
 
-	/* init the err status */
-	recov->er_nerrs = nerrs;
-	recov->er_data_nerrs = 0;
-	memset(recov->er_in_err, 0, sizeof(bool) * (k + p));
 	for (i = 0; i < nerrs; i++) {
-		err_tgt_off = obj_ec_shard_off(obj, dkey_hash, err_list[i]);
-
 		D_ASSERT(err_list[i] < k + p);
-		recov->er_err_list[i] = err_tgt_off;
-		recov->er_in_err[err_tgt_off] = true;
-		if (err_tgt_off < k)
-			recov->er_data_nerrs++;
-	}
-
-	/* if all parity targets failed, just reuse the encode gftbls */
-	if (recov->er_data_nerrs == 0 && recov->er_nerrs == p) {
-		memcpy(recov->er_gftbls, codec->ec_gftbls, k * p * 32);
-		D_DEBUG(DB_IO, "all parity tgts failed, reuse enc gftbls.\n");
-		return 0;
-	}
-
-	/* Construct matrix b by removing error rows */
-	for (i = 0, r = 0; i < k; i++, r++) {
-		while (recov->er_in_err[r])
-			r++;
-		for (j = 0; j < k; j++)
-			recov->er_b_matrix[k * i + j] =
-				codec->ec_en_matrix[k * r + j];
-		recov->er_dec_idx[i] = r;
-	}
-
-	/* Cauchy matrix is always invertible, should not fail */
-	rc = gf_invert_matrix(recov->er_b_matrix, recov->er_inv_matrix, k);
-	D_ASSERT(rc == 0);
-
-	/* Generate decode matrix (err_list from invert matrix) */
-	for (i = 0; i < recov->er_data_nerrs; i++) {
-		err_tgt_off = obj_ec_shard_off(obj, dkey_hash, err_list[i]);
-		for (j = 0; j < k; j++)
-			recov->er_de_matrix[k * i + j] =
-				recov->er_inv_matrix[k * err_tgt_off + j];
+		err_offs[i] = obj_ec_shard_off(obj, dkey_hash, err_list[i]);
 	}
-	/* err_list from encode_matrix * invert matrix, for parity decoding */
-	for (p = recov->er_data_nerrs; p < recov->er_nerrs; p++) {
-		err_tgt_off = obj_ec_shard_off(obj, dkey_hash, err_list[p]);
-		for (i = 0; i < k; i++) {
-			s = 0;
-			for (j = 0; j < k; j++)
-				s ^= gf_mul(recov->er_inv_matrix[j * k + i],
-					    codec->ec_en_matrix[k * err_tgt_off + j]);
 
-			recov->er_de_matrix[k * p + i] = s;
-		}
-	}
+	/* decode tables are shared through the class codec cache */
+	recov = obj_ec_recov_codec_get(codec, nerrs, err_offs);
+	if (recov == NULL)
+		return -DER_NOMEM;
 
-	ec_init_tables(k, recov->er_nerrs, recov->er_de_matrix,
-		       recov->er_gftbls);
+	if (fail_info->efi_recov_codec != NULL)
+		obj_ec_recov_codec_put(fail_info->efi_recov_codec);
+	fail_info->efi_recov_codec = recov;
 
 	return 0;
 }
@@ -2598,25 +2492,6 @@ out:
 	return rc;
 }
 
-static void
-obj_ec_recov_stripe(struct obj_ec_recov_codec *codec,
-		    struct daos_oclass_attr *oca, void *buf_stripe,
-		    uint64_t cell_sz)
-{
-	unsigned char	*buf_src[OBJ_EC_MAX_K];
-	unsigned char	*buf_err[OBJ_EC_MAX_P];
-	uint32_t	 i, k;
-
-	k = obj_ec_data_tgt_nr(oca);
-	for (i = 0; i < k; i++)
-		buf_src[i] = buf_stripe + codec->er_dec_idx[i] * cell_sz;
-	for (i = 0; i < codec->er_nerrs; i++)
-		buf_err[i] = buf_stripe + codec->er_err_list[i] * cell_sz;
-
-	ec_encode_data(cell_sz, k, codec->er_nerrs, codec->er_gftbls,
-		       buf_src, buf_err);
-}
-
 struct oes_copy_arg {
 	void		*buf;
 	uint64_t	 size;
@@ -2793,7 +2668,7 @@ obj_ec_recov_data(struct obj_reasb_req *reasb_req, uint32_t iod_nr)
 	d_sg_list_t			*stripe_sgl, *sgl;
 	daos_iod_t			*iod;
 	void				*buf_stripe;
-	uint32_t			 i, j, sidx, stripe_nr, recx_nr;
+	uint32_t			 i, j, stripe_nr, recx_nr;
 	uint64_t			 cell_sz, stripe_total_sz;
 	uint64_t			 stripe_rec_nr =
 						obj_ec_stripe_rec_nr(oca);
@@ -2835,11 +2710,9 @@ obj_ec_recov_data(struct obj_reasb_req *reasb_req, uint32_t iod_nr)
 				stripe_nr = recx_ep->re_recx.rx_nr /
 					    stripe_rec_nr;
 			}
-			for (sidx = 0; sidx < stripe_nr; sidx++) {
-				obj_ec_recov_stripe(codec, oca, buf_stripe,
-						    cell_sz);
-				buf_stripe += stripe_total_sz;
-			}
+			obj_ec_recov_stripes(codec, oca, buf_stripe, cell_sz,
+					     stripe_total_sz, stripe_nr);
+			buf_stripe += stripe_total_sz * stripe_nr;
 		}
 		obj_ec_recov_fill_back(iod, sgl, recov_list, stripe_list,
 				       stripe_sgl, stripe_total_sz,
@@ -1064,6 +1064,12 @@ dc_obj_shard_rw(struct dc_obj_shard *shard, enum obj_rpc_opc opc,
 		if (toiod->oto_orig_tgt_idx != toiod->oto_tgt_idx) {
 			orw->orw_flags |= ORF_EC_DEGRADED;
 			orw->orw_tgt_idx = toiod->oto_orig_tgt_idx;
+			/* The engine reconstructs with its own client stack, whose fetches
+			 * carry ORF_FOR_EC_AGG, never ask it to recurse.
+			 */
+			if (shard->do_co->dc_props.dcp_ec_srv_recov &&
+			    !(orw->orw_flags & (ORF_FOR_MIGRATION | ORF_FOR_EC_AGG)))
+				orw->orw_flags |= ORF_EC_RECOV_SRV;
 		}
 	}
 
@@ -419,6 +419,7 @@ void
 obj_ec_codec_fini(void)
 {
 	struct obj_ec_codec	*ec_codec;
+	struct obj_ec_recov_codec *recov;
 	struct daos_obj_class	*oc;
 	int			 ocnr = 0;
 	int			 i;
@@ -441,6 +442,13 @@ obj_ec_codec_fini(void)
 
 	for (i = 0; i < ocnr; i++) {
 		ec_codec = &oc_ec_codecs[i].ec_codec;
+		if (ec_codec->ec_k != 0) {
+			while ((recov = d_list_pop_entry(&ec_codec->ec_recov_lru,
+							 struct obj_ec_recov_codec,
+							 er_link)) != NULL)
+				D_FREE(recov);
+			D_MUTEX_DESTROY(&ec_codec->ec_recov_lock);
+		}
 		if (ec_codec->ec_en_matrix != NULL)
 			D_FREE(ec_codec->ec_en_matrix);
 		if (ec_codec->ec_gftbls != NULL)
@@ -506,6 +514,12 @@ obj_ec_codec_init()
 				" exceed data target number).\n", k, p);
 			D_GOTO(failed, rc = -DER_INVAL);
 		}
+		rc = D_MUTEX_INIT(&ec_codec->ec_recov_lock, NULL);
+		if (rc)
+			D_GOTO(failed, rc);
+		D_INIT_LIST_HEAD(&ec_codec->ec_recov_lru);
+		ec_codec->ec_k = k;
+		ec_codec->ec_p = p;
 		m = k + p;
 		/* 32B needed for data generated for each input coefficient */
 		D_ALLOC(ec_codec->ec_gftbls, k * p * 32);
@@ -555,6 +569,244 @@ obj_ec_codec_get(daos_oclass_id_t oc_id)
 	return &ecc_array[idx]->ec_codec;
 }
 
+static struct obj_ec_recov_codec *
+obj_ec_recov_codec_alloc(uint32_t k, uint32_t p)
+{
+	struct obj_ec_recov_codec	*recov;
+	void				*buf, *tmp_ptr;
+	size_t				 struct_size, tbl_size, matrix_size;
+	size_t				 idx_size, list_size, err_size;
+
+	struct_size = roundup(sizeof(struct obj_ec_recov_codec), 8);
+	tbl_size = k * p * 32;
+	matrix_size = roundup((k + p) * k, 8);
+	idx_size = roundup(sizeof(uint32_t) * k, 8);
+	list_size = roundup(sizeof(uint32_t) * p, 8);
+	err_size = roundup(sizeof(bool) * (k + p), 8);
+
+	D_ALLOC(buf, struct_size + tbl_size + 3 * matrix_size + idx_size +
+		     list_size + err_size);
+	if (buf == NULL)
+		return NULL;
+
+	tmp_ptr = buf;
+	recov = buf;
+	tmp_ptr += struct_size;
+	recov->er_gftbls = tmp_ptr;
+	tmp_ptr += tbl_size;
+	recov->er_de_matrix = tmp_ptr;
+	tmp_ptr += matrix_size;
+	recov->er_inv_matrix = tmp_ptr;
+	tmp_ptr += matrix_size;
+	recov->er_b_matrix = tmp_ptr;
+	tmp_ptr += matrix_size;
+	recov->er_dec_idx = tmp_ptr;
+	tmp_ptr += idx_size;
+	recov->er_err_list = tmp_ptr;
+	tmp_ptr += list_size;
+	recov->er_in_err = tmp_ptr;
+	D_INIT_LIST_HEAD(&recov->er_link);
+
+	return recov;
+}
+
+/** Build the decode tables for the (sorted) failed cell offsets */
+static struct obj_ec_recov_codec *
+obj_ec_recov_codec_build(struct obj_ec_codec *codec, uint32_t nerrs, uint32_t *err_offs)
+{
+	struct obj_ec_recov_codec	*recov;
+	uint32_t			 k = codec->ec_k;
+	uint32_t			 p = codec->ec_p;
+	uint32_t			 i, j, r, e;
+	unsigned char			 s;
+	int				 rc;
+
+	recov = obj_ec_recov_codec_alloc(k, p);
+	if (recov == NULL)
+		return NULL;
+
+	recov->er_codec = codec;
+	recov->er_nerrs = nerrs;
+	recov->er_data_nerrs = 0;
+	memset(recov->er_in_err, 0, sizeof(bool) * (k + p));
+	for (i = 0; i < nerrs; i++) {
+		D_ASSERT(err_offs[i] < k + p);
+		recov->er_err_list[i] = err_offs[i];
+		recov->er_in_err[err_offs[i]] = true;
+		if (err_offs[i] < k)
+			recov->er_data_nerrs++;
+	}
+
+	/* if all parity targets failed, just reuse the encode gftbls */
+	if (recov->er_data_nerrs == 0 && recov->er_nerrs == p) {
+		memcpy(recov->er_gftbls, codec->ec_gftbls, k * p * 32);
+		for (i = 0; i < k; i++)
+			recov->er_dec_idx[i] = i;
+		return recov;
+	}
+
+	/* Construct matrix b by removing error rows */
+	for (i = 0, r = 0; i < k; i++, r++) {
+		while (recov->er_in_err[r])
+			r++;
+		for (j = 0; j < k; j++)
+			recov->er_b_matrix[k * i + j] = codec->ec_en_matrix[k * r + j];
+		recov->er_dec_idx[i] = r;
+	}
+
+	/* Cauchy matrix is always invertible, should not fail */
+	rc = gf_invert_matrix(recov->er_b_matrix, recov->er_inv_matrix, k);
+	D_ASSERT(rc == 0);
+
+	/* Generate decode matrix, data cells in error come first (sorted offsets) */
+	for (i = 0; i < recov->er_data_nerrs; i++) {
+		for (j = 0; j < k; j++)
+			recov->er_de_matrix[k * i + j] =
+				recov->er_inv_matrix[k * err_offs[i] + j];
+	}
+	/* err_list from encode_matrix * invert matrix, for parity decoding */
+	for (e = recov->er_data_nerrs; e < recov->er_nerrs; e++) {
+		for (i = 0; i < k; i++) {
+			s = 0;
+			for (j = 0; j < k; j++)
+				s ^= gf_mul(recov->er_inv_matrix[j * k + i],
+					    codec->ec_en_matrix[k * err_offs[e] + j]);
+			recov->er_de_matrix[k * e + i] = s;
+		}
+	}
+
+	ec_init_tables(k, recov->er_nerrs, recov->er_de_matrix, recov->er_gftbls);
+	return recov;
+}
+
+static struct obj_ec_recov_codec *
+obj_ec_recov_codec_lookup(struct obj_ec_codec *codec, uint32_t nerrs, uint32_t *err_offs)
+{
+	struct obj_ec_recov_codec	*recov;
+
+	d_list_for_each_entry(recov, &codec->ec_recov_lru, er_link) {
+		if (recov->er_nerrs == nerrs &&
+		    memcmp(recov->er_err_list, err_offs, sizeof(*err_offs) * nerrs) == 0) {
+			d_list_move(&recov->er_link, &codec->ec_recov_lru);
+			recov->er_ref++;
+			return recov;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Get the recovery codec of \a codec for the failed cell offsets \a err_offs.
+ * Decode tables only depend on the object class and on the failure pattern,
+ * so they are cached in a small LRU of the class codec and shared by all
+ * degraded fetches, instead of being rebuilt (matrix inversion + table init)
+ * by every fetch task. The returned codec must be released by
+ * obj_ec_recov_codec_put().
+ */
+struct obj_ec_recov_codec *
+obj_ec_recov_codec_get(struct obj_ec_codec *codec, uint32_t nerrs, uint32_t *err_offs)
+{
+	struct obj_ec_recov_codec	*recov, *victim;
+	uint32_t			 offs[OBJ_EC_MAX_P];
+	uint32_t			 i, j, tmp;
+
+	D_ASSERT(nerrs > 0 && nerrs <= codec->ec_p);
+	/* the cache key is the sorted offset list */
+	memcpy(offs, err_offs, sizeof(*offs) * nerrs);
+	for (i = 1; i < nerrs; i++) {
+		for (j = i; j > 0 && offs[j - 1] > offs[j]; j--) {
+			tmp = offs[j];
+			offs[j] = offs[j - 1];
+			offs[j - 1] = tmp;
+		}
+	}
+
+	D_MUTEX_LOCK(&codec->ec_recov_lock);
+	recov = obj_ec_recov_codec_lookup(codec, nerrs, offs);
+	D_MUTEX_UNLOCK(&codec->ec_recov_lock);
+	if (recov != NULL)
+		return recov;
+
+	recov = obj_ec_recov_codec_build(codec, nerrs, offs);
+	if (recov == NULL)
+		return NULL;
+
+	D_MUTEX_LOCK(&codec->ec_recov_lock);
+	victim = obj_ec_recov_codec_lookup(codec, nerrs, offs);
+	if (victim != NULL) {
+		/* raced with another builder, use the cached one */
+		D_MUTEX_UNLOCK(&codec->ec_recov_lock);
+		D_FREE(recov);
+		return victim;
+	}
+
+	/* one reference for the cache, one for the caller */
+	recov->er_ref = 2;
+	d_list_add(&recov->er_link, &codec->ec_recov_lru);
+	if (++codec->ec_recov_nr > OBJ_EC_RECOV_CACHE_MAX) {
+		victim = d_list_entry(codec->ec_recov_lru.prev, struct obj_ec_recov_codec,
+				      er_link);
+		d_list_del_init(&victim->er_link);
+		codec->ec_recov_nr--;
+		if (--victim->er_ref > 0)
+			victim = NULL;
+	} else {
+		victim = NULL;
+	}
+	D_MUTEX_UNLOCK(&codec->ec_recov_lock);
+
+	D_FREE(victim);
+	return recov;
+}
+
+void
+obj_ec_recov_codec_put(struct obj_ec_recov_codec *recov)
+{
+	struct obj_ec_codec	*codec = recov->er_codec;
+	bool			 zombie;
+
+	D_MUTEX_LOCK(&codec->ec_recov_lock);
+	D_ASSERT(recov->er_ref > 0);
+	zombie = (--recov->er_ref == 0);
+	D_MUTEX_UNLOCK(&codec->ec_recov_lock);
+
+	/* only evicted codecs can drop the last reference */
+	if (zombie) {
+		D_ASSERT(d_list_empty(&recov->er_link));
+		D_FREE(recov);
+	}
+}
+
+/**
+ * Recover \a stripe_nr consecutive stripes. Cells of one stripe are adjacent in
+ * the stripe buffer, so the source/error cell pointers are computed once and
+ * advanced by the stripe size, rather than re-derived for every stripe.
+ */
+void
+obj_ec_recov_stripes(struct obj_ec_recov_codec *codec,
+		     struct daos_oclass_attr *oca, void *buf_stripe,
+		     uint64_t cell_sz, uint64_t stripe_sz, uint32_t stripe_nr)
+{
+	unsigned char	*buf_src[OBJ_EC_MAX_K];
+	unsigned char	*buf_err[OBJ_EC_MAX_P];
+	uint32_t	 i, k, sidx;
+
+	k = obj_ec_data_tgt_nr(oca);
+	for (i = 0; i < k; i++)
+		buf_src[i] = buf_stripe + codec->er_dec_idx[i] * cell_sz;
+	for (i = 0; i < codec->er_nerrs; i++)
+		buf_err[i] = buf_stripe + codec->er_err_list[i] * cell_sz;
+
+	for (sidx = 0; sidx < stripe_nr; sidx++) {
+		ec_encode_data(cell_sz, k, codec->er_nerrs, codec->er_gftbls,
+			       buf_src, buf_err);
+		for (i = 0; i < k; i++)
+			buf_src[i] += stripe_sz;
+		for (i = 0; i < codec->er_nerrs; i++)
+			buf_err[i] += stripe_sz;
+	}
+}
+
 static void
 oc_sop_swap(void *array, int a, int b)
 {
@@ -38,8 +38,17 @@ struct obj_ec_codec {
 	 * from coding coefficients. Needed for both encoding and decoding.
 	 */
 	unsigned char		*ec_gftbls;
+	/** LRU of recovery codecs built from this codec, see obj_ec_recov_codec_get() */
+	d_list_t		 ec_recov_lru;
+	pthread_mutex_t		 ec_recov_lock;
+	uint32_t		 ec_recov_nr;
+	uint32_t		 ec_k;
+	uint32_t		 ec_p;
 };
 
+/** Max number of recovery codecs cached for each EC object class */
+#define OBJ_EC_RECOV_CACHE_MAX	64
+
 /** Shard IO descriptor */
 struct obj_shard_iod {
 	/** tgt index [0, k+p) */
@@ -210,17 +219,24 @@ struct obj_ec_seg_sorter {
 };
 #define OBJ_EC_SEG_NIL		 (-1)
 
-/** ISAL codec for EC data recovery */
+/**
+ * ISAL codec for EC data recovery. It only depends on the object class and on
+ * the set of failed cell offsets, so it is built once and shared (read-only)
+ * by all the degraded fetches hitting the same failure pattern.
+ */
 struct obj_ec_recov_codec {
 	unsigned char		*er_gftbls;	/* GF tables */
 	unsigned char		*er_de_matrix;	/* decode matrix */
 	unsigned char		*er_inv_matrix;	/* invert matrix */
 	unsigned char		*er_b_matrix;	/* temporary b matrix */
 	uint32_t		*er_dec_idx;	/* decode index */
-	uint32_t		*er_err_list;	/* target idx list in error */
+	uint32_t		*er_err_list;	/* sorted cell offsets in error */
 	bool			*er_in_err;	/* boolean array for targets */
 	uint32_t		 er_nerrs;	/* #targets in error */
 	uint32_t		 er_data_nerrs; /* #data-targets in error */
+	struct obj_ec_codec	*er_codec;	/* owner codec (cache) */
+	d_list_t		 er_link;	/* link in ec_recov_lru */
+	uint32_t		 er_ref;	/* protected by ec_recov_lock */
 };
 
 /* EC recovery task */
@@ -732,6 +748,12 @@ obj_ec_tgt_in_err(uint32_t *err_list, uint32_t nerrs, uint16_t tgt_idx)
 int obj_ec_codec_init(void);
 void obj_ec_codec_fini(void);
 struct obj_ec_codec *obj_ec_codec_get(daos_oclass_id_t oc_id);
+struct obj_ec_recov_codec *
+obj_ec_recov_codec_get(struct obj_ec_codec *codec, uint32_t nerrs, uint32_t *err_offs);
+void obj_ec_recov_codec_put(struct obj_ec_recov_codec *recov);
+void
+obj_ec_recov_stripes(struct obj_ec_recov_codec *codec, struct daos_oclass_attr *oca,
+		     void *buf_stripe, uint64_t cell_sz, uint64_t stripe_sz, uint32_t stripe_nr);
 
 static inline struct obj_ec_codec *
 obj_id2ec_codec(daos_obj_id_t id)
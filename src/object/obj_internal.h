@@ -813,7 +813,8 @@ struct obj_io_context {
 	uint32_t		 ioc_began:1,
 				 ioc_free_sgls:1,
 				 ioc_lost_reply:1,
-				 ioc_fetch_snap:1;
+				 ioc_fetch_snap:1,
+				 ioc_ec_srv_recov:1;
 };
 
 static inline uint64_t
@@ -845,6 +846,54 @@ recx_compare(const void *rank1, const void *rank2)
 		return 1;
 }
 
+/* Pieces of the recovered ranges inside the client bulk of one iod */
+struct obj_ec_srv_recov_piece {
+	uint64_t	 sp_off;	/* offset in the iod bulk */
+	uint64_t	 sp_len;
+	char		*sp_buf;	/* recovered data */
+};
+
+/*
+ * Walk the (DAOS index space) iod extents and the recovered extents of one iod, fill
+ * @pieces if it is not NULL, return the number of pieces. Recovered extents are laid
+ * out back to back in @buf.
+ */
+static inline uint32_t
+obj_ec_srv_recov_pieces(daos_iod_t *iod, struct daos_recx_ep_list *list, daos_size_t rec_size,
+			char *buf, struct obj_ec_srv_recov_piece *pieces)
+{
+	uint64_t	pos = 0;
+	uint64_t	buf_off;
+	uint64_t	lo, hi;
+	uint32_t	nr = 0;
+	int		i, j;
+
+	for (i = 0; i < iod->iod_nr; i++) {
+		daos_recx_t	*recx = &iod->iod_recxs[i];
+
+		buf_off = 0;
+		for (j = 0; j < list->re_nr; j++) {
+			daos_recx_t	*r = &list->re_items[j].re_recx;
+
+			lo = max(recx->rx_idx, r->rx_idx);
+			hi = min(DAOS_RECX_END(*recx), DAOS_RECX_END(*r));
+			if (lo < hi) {
+				if (pieces != NULL) {
+					pieces[nr].sp_off = pos + (lo - recx->rx_idx) * rec_size;
+					pieces[nr].sp_len = (hi - lo) * rec_size;
+					pieces[nr].sp_buf = buf + buf_off +
+							    (lo - r->rx_idx) * rec_size;
+				}
+				nr++;
+			}
+			buf_off += r->rx_nr * rec_size;
+		}
+		pos += recx->rx_nr * rec_size;
+	}
+
+	return nr;
+}
+
 static inline void
 daos_iom_sort(daos_iom_t *map)
 {
@@ -187,6 +187,8 @@ enum obj_rpc_flags {
 	ORF_REBUILDING_IO	= (1 << 23),
 	/* 'sgls' is NULL, for update sub-request of CPD RPC. */
 	ORF_EMPTY_SGL		= (1 << 24),
+	/* EC degraded fetch, the parity shard engine may reconstruct the lost data itself. */
+	ORF_EC_RECOV_SRV	= (1 << 25),
 };
 
 /* common for update/fetch */
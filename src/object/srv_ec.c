@@ -17,7 +17,8 @@
 #include "obj_rpc.h"
 #include "srv_internal.h"
 
-static void
+/* Returns true for partial update, whose data is stored as replicas on parity shards */
+static bool
 _obj_ec_metrics_process(daos_iod_t *iod, struct obj_io_desc *oiod, struct daos_oclass_attr *oca,
 			struct obj_pool_metrics *opm)
 {
@@ -28,13 +29,14 @@ _obj_ec_metrics_process(daos_iod_t *iod, struct obj_io_desc *oiod, struct daos_o
 
 	if (iod->iod_type == DAOS_IOD_SINGLE) {
 		if (iod->iod_size == DAOS_REC_ANY)
-			return;
-		if (iod->iod_size <= OBJ_EC_SINGV_EVENDIST_SZ(obj_ec_data_tgt_nr(oca)))
+			return false;
+		if (iod->iod_size <= OBJ_EC_SINGV_EVENDIST_SZ(obj_ec_data_tgt_nr(oca))) {
 			d_tm_inc_counter(opm->opm_update_ec_partial, 1);
-		else
-			d_tm_inc_counter(opm->opm_update_ec_full, 1);
+			return true;
+		}
 
-		return;
+		d_tm_inc_counter(opm->opm_update_ec_full, 1);
+		return false;
 	}
 
 	/* only when IOD with all full-stripe update, count for opm_update_ec_full.
@@ -43,7 +45,7 @@ _obj_ec_metrics_process(daos_iod_t *iod, struct obj_io_desc *oiod, struct daos_o
 	 */
 	if (oiod->oiod_nr < obj_ec_tgt_nr(oca)) {
 		d_tm_inc_counter(opm->opm_update_ec_partial, 1);
-		return;
+		return true;
 	}
 
 	cell_size = obj_ec_cell_rec_nr(oca);
@@ -58,7 +60,7 @@ _obj_ec_metrics_process(daos_iod_t *iod, struct obj_io_desc *oiod, struct daos_o
 				if (recx->rx_idx % cell_size != 0 ||
 				    recx->rx_nr % cell_size != 0) {
 					d_tm_inc_counter(opm->opm_update_ec_partial, 1);
-					return;
+					return true;
 				}
 			}
 			continue;
@@ -66,7 +68,7 @@ _obj_ec_metrics_process(daos_iod_t *iod, struct obj_io_desc *oiod, struct daos_o
 		D_ASSERT(nr > 0);
 		if (siod->siod_nr != nr) {
 			d_tm_inc_counter(opm->opm_update_ec_partial, 1);
-			return;
+			return true;
 		}
 		for (j = 0; j < nr; j++) {
 			D_ASSERT(siod->siod_idx + j < iod->iod_nr);
@@ -76,19 +78,22 @@ _obj_ec_metrics_process(daos_iod_t *iod, struct obj_io_desc *oiod, struct daos_o
 			    ((recx->rx_idx & (~PARITY_INDICATOR)) !=
 			     (recx0->rx_idx & (~PARITY_INDICATOR)))) {
 			d_tm_inc_counter(opm->opm_update_ec_partial, 1);
-			return;
+			return true;
 			}
 		}
 	}
 
 	d_tm_inc_counter(opm->opm_update_ec_full, 1);
+	return false;
 }
 
 void
-obj_ec_metrics_process(struct obj_iod_array *iod_array, struct obj_io_context *ioc)
+obj_ec_metrics_process(struct obj_rw_in *orw, struct obj_io_context *ioc)
 {
+	struct obj_iod_array	*iod_array = &orw->orw_iod_array;
 	struct obj_pool_metrics *opm;
-	int			i;
+	daos_size_t		 replica_bytes = 0;
+	int			 i, j;
 
 	D_ASSERT(ioc->ioc_opc == DAOS_OBJ_RPC_UPDATE);
 	if (iod_array->oia_iods == NULL || !daos_oclass_is_ec(&ioc->ioc_oca))
@@ -102,6 +107,19 @@ obj_ec_metrics_process(struct obj_iod_array *iod_array, struct obj_io_context *i
 		iod = &iod_array->oia_iods[i];
 		oiod = &iod_array->oia_oiods[i];
 
-		_obj_ec_metrics_process(iod, oiod, &ioc->ioc_oca, opm);
+		if (!_obj_ec_metrics_process(iod, oiod, &ioc->ioc_oca, opm))
+			continue;
+
+		if (iod->iod_type == DAOS_IOD_SINGLE) {
+			replica_bytes += iod->iod_size;
+			continue;
+		}
+		for (j = 0; j < iod->iod_nr; j++) {
+			if (!(iod->iod_recxs[j].rx_idx & PARITY_INDICATOR))
+				replica_bytes += iod->iod_recxs[j].rx_nr * iod->iod_size;
+		}
 	}
+
+	/* The replicas of the partial update are to be aggregated into parity */
+	obj_ec_agg_hot_add(ioc->ioc_coc, orw->orw_oid, replica_bytes);
 }
@@ -18,14 +18,16 @@
  *	- The parity for peer parity extents is transferred.
  *	- Replicas for the stripe are removed from parity targets.
  *
- * If replicas are partial, and prior parity exists:
- *	- If less than half cells are updated (have replicas, parity is updated:
- *		- Old data cells for cells with replica data are fetched from
- *		  data targets (old, since fetched at epoch of existing parity).
+ * If replicas are partial, and prior parity exists, the cheaper of the two
+ * ways below is chosen by the amount of data to be fetched from peers:
+ *	- Parity delta, parity is updated:
+ *		- Old data for the ranges overwritten by replicas are fetched
+ *		  from data targets (old, since fetched at epoch of existing
+ *		  parity).
  *		- Peer parity is fetched.
  *		- Parity is incrementally updated.
  *		- Updated parity is transferred to peer parity target(s).
- *	- If half or more of the cells are update by replicas:
+ *	- Re-encode:
  *		- All cells not filled by local replicas are fetched.
  *		- New parity is generated from entire stripe.
  *		- Updated parity is transferred to peer parity target(s).
@@ -51,6 +53,7 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <daos/common.h>
+#include <gurt/heap.h>
 #include <daos_srv/vos.h>
 #include <daos_srv/daos_engine.h>
 #include <daos_srv/srv_obj_ec.h>
@@ -114,6 +117,7 @@ struct ec_agg_entry {
 	daos_handle_t		 ae_obj_hdl;	 /* Object handle for cur obj */
 	struct pl_obj_layout	*ae_obj_layout;
 	struct daos_shard_loc	 ae_peer_pshards[OBJ_EC_MAX_P];
+	struct obj_pool_metrics	*ae_metrics;	 /* Target metrics of the pool */
 	uint32_t		 ae_grp_idx;
 	uint32_t		ae_is_leader:1;
 };
@@ -131,6 +135,7 @@ struct ec_agg_param {
 	void			*ap_yield_arg;   /* yield argument            */
 	uint32_t		 ap_credits_max; /* # of tight loops to yield */
 	uint32_t		 ap_credits;     /* # of tight loops          */
+	struct ec_agg_hot	*ap_hot;	 /* hot objects of the cont   */
 	uint32_t		 ap_initialized:1; /* initialized flag */
 };
 
@@ -139,7 +144,10 @@ struct ec_agg_param {
 struct ec_agg_stripe_ud {
 	struct ec_agg_entry	*asu_agg_entry; /* Associated entry      */
 	uint8_t			*asu_bit_map;   /* Bitmap of cells       */
-	daos_recx_t		*asu_recxs;     /* For re-replicate      */
+	daos_recx_t		*asu_recxs;     /* For re-replicate, or
+						 * changed ranges for delta
+						 */
+	unsigned int		 asu_recx_cnt;  /* Count of changed ranges */
 	unsigned int		 asu_cell_cnt;  /* Count of cells        */
 	bool			 asu_recalc;    /* Should recalc parity  */
 	bool			 asu_write_par; /* Should write parity   */
@@ -159,6 +167,232 @@ struct ec_agg_extent {
 	bool		ae_hole;        /* extent is a hole   */
 };
 
+/* Max number of objects tracked by the hot object table of the container */
+#define EC_AGG_HOT_MAX		256
+#define EC_AGG_HOT_BUCKETS	64
+
+/* Object with replicas pending EC aggregation on this target.
+ */
+struct ec_agg_hot_obj {
+	struct d_binheap_node	eho_node;	/* heap link, sorted by bytes   */
+	d_list_t		eho_link;	/* hash bucket link             */
+	daos_unit_oid_t		eho_oid;	/* OID of the parity shard      */
+	daos_size_t		eho_bytes;	/* replica bytes since last agg */
+	uint32_t		eho_in_heap:1,	/* linked in the heap           */
+				eho_done:1;	/* aggregated in current round  */
+};
+
+/* Per-container table of the objects with the most replica bytes, updated by
+ * EC partial updates, so that aggregation processes them first. The heap is a
+ * min-heap, its root is the object to be evicted once the table is full. Only
+ * accessed by the xstream of the target.
+ */
+struct ec_agg_hot {
+	struct d_binheap	 eh_heap;
+	d_list_t		 eh_buckets[EC_AGG_HOT_BUCKETS];
+	daos_size_t		 eh_bytes;	/* total bytes of tracked objs  */
+	struct d_tm_node_t	*eh_reclaimable;	/* per-target sum of eh_bytes */
+};
+
+static inline struct ec_agg_hot_obj *
+ec_agg_hot_node2obj(struct d_binheap_node *node)
+{
+	return container_of(node, struct ec_agg_hot_obj, eho_node);
+}
+
+static bool
+ec_agg_hot_cmp(struct d_binheap_node *a, struct d_binheap_node *b)
+{
+	return ec_agg_hot_node2obj(a)->eho_bytes < ec_agg_hot_node2obj(b)->eho_bytes;
+}
+
+static struct d_binheap_ops ec_agg_hot_ops = {
+	.hop_enter	= NULL,
+	.hop_exit	= NULL,
+	.hop_compare	= ec_agg_hot_cmp,
+};
+
+static inline d_list_t *
+ec_agg_hot_bucket(struct ec_agg_hot *hot, daos_unit_oid_t oid)
+{
+	uint64_t key = d_hash_mix64(oid.id_pub.lo ^ oid.id_pub.hi ^ oid.id_shard);
+
+	return &hot->eh_buckets[key % EC_AGG_HOT_BUCKETS];
+}
+
+static struct ec_agg_hot_obj *
+ec_agg_hot_lookup(struct ec_agg_hot *hot, daos_unit_oid_t oid)
+{
+	struct ec_agg_hot_obj	*obj;
+
+	d_list_for_each_entry(obj, ec_agg_hot_bucket(hot, oid), eho_link) {
+		if (daos_unit_oid_compare(obj->eho_oid, oid) == 0)
+			return obj;
+	}
+	return NULL;
+}
+
+static inline void
+ec_agg_hot_bytes_update(struct ec_agg_hot *hot, daos_size_t add, daos_size_t sub)
+{
+	/* The gauge is shared by all the containers of the target */
+	hot->eh_bytes = hot->eh_bytes + add - sub;
+	if (add != 0)
+		d_tm_inc_gauge(hot->eh_reclaimable, add);
+	if (sub != 0)
+		d_tm_dec_gauge(hot->eh_reclaimable, sub);
+}
+
+static void
+ec_agg_hot_obj_free(struct ec_agg_hot *hot, struct ec_agg_hot_obj *obj)
+{
+	if (obj->eho_in_heap)
+		d_binheap_remove(&hot->eh_heap, &obj->eho_node);
+	d_list_del(&obj->eho_link);
+	ec_agg_hot_bytes_update(hot, 0, obj->eho_bytes);
+	D_FREE(obj);
+}
+
+static void
+ec_agg_hot_obj_insert(struct ec_agg_hot *hot, struct ec_agg_hot_obj *obj)
+{
+	int rc;
+
+	rc = d_binheap_insert(&hot->eh_heap, &obj->eho_node);
+	if (rc == 0)
+		obj->eho_in_heap = 1;
+	else
+		ec_agg_hot_obj_free(hot, obj);
+}
+
+void
+obj_ec_agg_hot_add(struct ds_cont_child *cont, daos_unit_oid_t oid, daos_size_t bytes)
+{
+	struct ec_agg_hot	*hot = cont->sc_ec_agg_hot;
+	struct ec_agg_hot_obj	*obj;
+	struct d_binheap_node	*root;
+
+	if (hot == NULL || bytes == 0)
+		return;
+
+	obj = ec_agg_hot_lookup(hot, oid);
+	if (obj != NULL) {
+		obj->eho_bytes += bytes;
+		obj->eho_done = 0;
+		ec_agg_hot_bytes_update(hot, bytes, 0);
+		/* Re-sort. If it is being aggregated, it is re-queued at the end of
+		 * the round.
+		 */
+		if (obj->eho_in_heap) {
+			d_binheap_remove(&hot->eh_heap, &obj->eho_node);
+			obj->eho_in_heap = 0;
+			ec_agg_hot_obj_insert(hot, obj);
+		}
+		return;
+	}
+
+	if (d_binheap_size(&hot->eh_heap) >= EC_AGG_HOT_MAX) {
+		root = d_binheap_root(&hot->eh_heap);
+		if (ec_agg_hot_node2obj(root)->eho_bytes >= bytes)
+			return;
+		ec_agg_hot_obj_free(hot, ec_agg_hot_node2obj(root));
+	}
+
+	D_ALLOC_PTR(obj);
+	if (obj == NULL)
+		return;
+
+	obj->eho_oid = oid;
+	obj->eho_bytes = bytes;
+	d_list_add(&obj->eho_link, ec_agg_hot_bucket(hot, oid));
+	ec_agg_hot_bytes_update(hot, bytes, 0);
+	ec_agg_hot_obj_insert(hot, obj);
+}
+
+/* Whether the object was aggregated by the hot pass of the current round */
+static bool
+ec_agg_hot_done(struct ec_agg_hot *hot, daos_unit_oid_t oid)
+{
+	struct ec_agg_hot_obj *obj;
+
+	if (hot == NULL)
+		return false;
+
+	obj = ec_agg_hot_lookup(hot, oid);
+	return obj != NULL && obj->eho_done;
+}
+
+/* Drops the objects aggregated in the round just finished, and re-queues the
+ * ones updated again or not aggregated.
+ */
+static void
+ec_agg_hot_round_end(struct ec_agg_hot *hot)
+{
+	struct ec_agg_hot_obj	*obj;
+	struct ec_agg_hot_obj	*tmp;
+	int			 i;
+
+	if (hot == NULL)
+		return;
+
+	for (i = 0; i < EC_AGG_HOT_BUCKETS; i++) {
+		d_list_for_each_entry_safe(obj, tmp, &hot->eh_buckets[i], eho_link) {
+			if (obj->eho_in_heap)
+				continue;
+			if (obj->eho_done || obj->eho_bytes == 0)
+				ec_agg_hot_obj_free(hot, obj);
+			else
+				ec_agg_hot_obj_insert(hot, obj);
+		}
+	}
+}
+
+static int
+ec_agg_hot_create(struct ds_cont_child *cont)
+{
+	struct obj_pool_metrics	*opm = cont->sc_pool->spc_metrics[DAOS_OBJ_MODULE];
+	struct ec_agg_hot	*hot;
+	int			 i;
+	int			 rc;
+
+	D_ALLOC_PTR(hot);
+	if (hot == NULL)
+		return -DER_NOMEM;
+
+	rc = d_binheap_create_inplace(DBH_FT_NOLOCK, 0, NULL, &ec_agg_hot_ops, &hot->eh_heap);
+	if (rc) {
+		D_FREE(hot);
+		return rc;
+	}
+
+	for (i = 0; i < EC_AGG_HOT_BUCKETS; i++)
+		D_INIT_LIST_HEAD(&hot->eh_buckets[i]);
+	if (opm != NULL)
+		hot->eh_reclaimable = opm->opm_ec_agg_reclaimable;
+	cont->sc_ec_agg_hot = hot;
+	return 0;
+}
+
+static void
+ec_agg_hot_destroy(struct ds_cont_child *cont)
+{
+	struct ec_agg_hot	*hot = cont->sc_ec_agg_hot;
+	struct ec_agg_hot_obj	*obj;
+	struct ec_agg_hot_obj	*tmp;
+	int			 i;
+
+	if (hot == NULL)
+		return;
+
+	cont->sc_ec_agg_hot = NULL;
+	for (i = 0; i < EC_AGG_HOT_BUCKETS; i++) {
+		d_list_for_each_entry_safe(obj, tmp, &hot->eh_buckets[i], eho_link)
+			ec_agg_hot_obj_free(hot, obj);
+	}
+	d_binheap_destroy_inplace(&hot->eh_heap);
+	D_FREE(hot);
+}
+
 static inline struct daos_csummer *
 ec_agg_param2csummer(struct ec_agg_param *agg_param)
 {
@@ -617,6 +851,119 @@ out:
 	return rc;
 }
 
+/* Collects the ranges of the cells in bit_map that are overwritten by the
+ * replicas newer than the parity. The parity delta only depends on these
+ * ranges, the rest of the old data is not needed. The ranges are merged per
+ * cell, and returned in cell order. Returns the number of records covered.
+ */
+static uint64_t
+agg_delta_ranges(struct ec_agg_entry *entry, uint8_t *bit_map,
+		 daos_recx_t *recxs, unsigned int *recx_cnt)
+{
+	struct ec_agg_extent	*extent;
+	unsigned int		 len = ec_age2cs(entry);
+	unsigned int		 k = ec_age2k(entry);
+	uint64_t		 ss = k * len * entry->ae_cur_stripe.as_stripenum;
+	uint64_t		 cell_start, cell_end;
+	uint64_t		 estart, eend;
+	uint64_t		 rec_cnt = 0;
+	unsigned int		 i, nr = 0, first;
+
+	for (i = 0; i < k; i++) {
+		if (!isset(bit_map, i))
+			continue;
+
+		cell_start = ss + (uint64_t)i * len;
+		cell_end = cell_start + len;
+		first = nr;
+		/* The extents are sorted by the start offset */
+		d_list_for_each_entry(extent, &entry->ae_cur_stripe.as_dextents, ae_link) {
+			if (extent->ae_epoch <= entry->ae_par_extent.ape_epoch)
+				continue;
+			estart = max(extent->ae_recx.rx_idx, cell_start);
+			eend = min(DAOS_RECX_END(extent->ae_recx), cell_end);
+			if (estart >= eend)
+				continue;
+
+			if (nr > first && DAOS_RECX_END(recxs[nr - 1]) >= estart) {
+				if (DAOS_RECX_END(recxs[nr - 1]) < eend) {
+					rec_cnt += eend - DAOS_RECX_END(recxs[nr - 1]);
+					recxs[nr - 1].rx_nr = eend - recxs[nr - 1].rx_idx;
+				}
+				continue;
+			}
+			recxs[nr].rx_idx = estart;
+			recxs[nr].rx_nr = eend - estart;
+			rec_cnt += recxs[nr].rx_nr;
+			nr++;
+		}
+	}
+
+	*recx_cnt = nr;
+	return rec_cnt;
+}
+
+/* Fetches the old data of the ranges overwritten by the replicas, at the
+ * epoch of the existing parity, for the parity delta. Each range is placed
+ * at its position of the cell in the old data buffer.
+ */
+static int
+agg_fetch_odata_ranges(struct ec_agg_entry *entry, uint8_t *bit_map,
+		       daos_recx_t *recxs, unsigned int recx_cnt)
+{
+	daos_iod_t		 iod = { 0 };
+	d_sg_list_t		 sgl = { 0 };
+	unsigned char		*buf;
+	uint64_t		 cell_b = ec_age2cs_b(entry);
+	uint64_t		 rsize = entry->ae_rsize;
+	unsigned int		 len = ec_age2cs(entry);
+	unsigned int		 k = ec_age2k(entry);
+	uint64_t		 ss = k * len * entry->ae_cur_stripe.as_stripenum;
+	uint64_t		 cell_idx;
+	unsigned int		 i, j, c;
+	int			 rc;
+
+	D_ASSERT(recx_cnt > 0);
+	D_ALLOC_ARRAY(sgl.sg_iovs, recx_cnt);
+	if (sgl.sg_iovs == NULL)
+		return -DER_NOMEM;
+
+	sgl.sg_nr = recx_cnt;
+	buf = entry->ae_sgl.sg_iovs[AGG_IOV_ODATA].iov_buf;
+	for (i = 0; i < recx_cnt; i++) {
+		cell_idx = (recxs[i].rx_idx - ss) / len;
+		/* The old data buffer only holds the cells in bit_map */
+		for (c = 0, j = 0; c < cell_idx; c++) {
+			if (isset(bit_map, c))
+				j++;
+		}
+		d_iov_set(&sgl.sg_iovs[i],
+			  &buf[j * cell_b + (recxs[i].rx_idx - ss - cell_idx * len) * rsize],
+			  recxs[i].rx_nr * rsize);
+	}
+
+	iod.iod_name	= entry->ae_akey;
+	iod.iod_type	= DAOS_IOD_ARRAY;
+	iod.iod_size	= rsize;
+	iod.iod_nr	= recx_cnt;
+	iod.iod_recxs	= recxs;
+
+	rc = agg_get_obj_handle(entry);
+	if (rc) {
+		D_ERROR("Failed to open object: "DF_RC"\n", DP_RC(rc));
+		goto out;
+	}
+
+	rc = dsc_obj_fetch(entry->ae_obj_hdl, entry->ae_par_extent.ape_epoch, &entry->ae_dkey,
+			   1, &iod, &sgl, NULL, DIOF_FOR_EC_AGG, NULL, NULL);
+	if (rc)
+		D_ERROR("dsc_obj_fetch failed: "DF_RC"\n", DP_RC(rc));
+
+out:
+	D_FREE(sgl.sg_iovs);
+	return rc;
+}
+
 /* Fetches the full data stripe (called when replicas form a full stripe).
  */
 static int
@@ -1025,7 +1372,8 @@ agg_diff_preprocess(struct ec_agg_entry *entry, unsigned char *diff,
 				", len "DF_U64"]\n", DP_UOID(entry->ae_oid),
 				hole_off, estart - hole_end);
 		}
-		hole_off = eend - cell_start;
+		/* The extent might be covered by a previous larger one */
+		hole_off = max(hole_off, eend - cell_start);
 	}
 	if (hole_off > 0 && hole_off < len) {
 		memset(diff + hole_off * rsize, 0,
@@ -1127,11 +1475,14 @@ agg_process_partial_stripe_ult(void *arg)
 	unsigned int		 cell_cnt = stripe_ud->asu_cell_cnt;
 	int			 rc = 0;
 
-	/* Fetch the data cells on other shards. For parity update,
-	 * the bitmap is set for the same cells as are replicated.
+	/* Fetch the data cells on other shards. For parity update, only
+	 * the ranges overwritten by the replicas are fetched.
 	 */
-	rc = agg_fetch_odata_cells(entry, bit_map, cell_cnt,
-				   stripe_ud->asu_recalc);
+	if (stripe_ud->asu_recalc)
+		rc = agg_fetch_odata_cells(entry, bit_map, cell_cnt, true);
+	else
+		rc = agg_fetch_odata_ranges(entry, bit_map, stripe_ud->asu_recxs,
+					    stripe_ud->asu_recx_cnt);
 	if (rc)
 		goto out;
 
@@ -1164,11 +1515,14 @@ agg_process_partial_stripe(struct ec_agg_entry *entry)
 	uint8_t			 tbit_map[OBJ_TGT_BITMAP_LEN] = {0};
 	unsigned int		 len = ec_age2cs(entry);
 	unsigned int		 k = ec_age2k(entry);
+	unsigned int		 p = ec_age2p(entry);
 	unsigned int		 i, full_cell_cnt = 0;
 	unsigned int		 cell_cnt = 0;
 	uint64_t		 ss;
 	uint64_t		 estart, elen = 0;
 	uint64_t		 eend = 0;
+	uint64_t		 delta_recs = 0;
+	uint64_t		 fetch_recs;
 	bool			 has_old_replicas = false;
 	int			 tid, rc = 0;
 
@@ -1204,12 +1558,31 @@ agg_process_partial_stripe(struct ec_agg_entry *entry)
 				    entry->ae_cur_stripe.as_stripenum,
 				    &full_cell_cnt);
 
-	if (full_cell_cnt >= k / 2 || cell_cnt == k || has_old_replicas) {
+	/* The parity delta needs the old data of the overwritten ranges, and
+	 * the parity of the peers, while re-encode needs all the cells not
+	 * fully overwritten. Choose the one moving less data from peers.
+	 */
+	if (cell_cnt > 0 && cell_cnt < k && !has_old_replicas) {
+		D_ALLOC_ARRAY(stripe_ud.asu_recxs,
+			      cell_cnt * entry->ae_cur_stripe.as_extent_cnt);
+		if (stripe_ud.asu_recxs == NULL) {
+			rc = -DER_NOMEM;
+			goto out;
+		}
+		delta_recs = agg_delta_ranges(entry, tbit_map, stripe_ud.asu_recxs,
+					      &stripe_ud.asu_recx_cnt);
+		delta_recs += (uint64_t)(p - 1) * len;
+	}
+
+	if (delta_recs == 0 || (uint64_t)(k - full_cell_cnt) * len <= delta_recs) {
 		stripe_ud.asu_recalc = true;
+		fetch_recs = (uint64_t)(k - full_cell_cnt) * len;
 		cell_cnt = full_cell_cnt;
 		bit_map = fcbit_map;
-	} else
+	} else {
+		fetch_recs = delta_recs;
 		bit_map = tbit_map;
+	}
 
 	rc = agg_prep_sgl(entry);
 	if (rc)
@@ -1255,10 +1628,18 @@ agg_process_partial_stripe(struct ec_agg_entry *entry)
 		goto ev_out;
 	}
 
+	if (entry->ae_metrics != NULL) {
+		d_tm_inc_counter(stripe_ud.asu_recalc ? entry->ae_metrics->opm_ec_agg_recalc :
+				 entry->ae_metrics->opm_ec_agg_delta, 1);
+		d_tm_inc_counter(entry->ae_metrics->opm_ec_agg_fetch_bytes,
+				 fetch_recs * entry->ae_rsize);
+	}
+
 ev_out:
 	ABT_eventual_free(&stripe_ud.asu_eventual);
 
 out:
+	D_FREE(stripe_ud.asu_recxs);
 	return rc;
 }
 
@@ -2324,6 +2705,14 @@ agg_filter(daos_handle_t ih, vos_iter_desc_t *desc, void *cb_arg, unsigned int *
 		goto done;
 	}
 
+	if (ec_agg_hot_done(agg_param->ap_hot, desc->id_oid)) {
+		D_DEBUG(DB_EPC, "Skip oid:"DF_UOID" aggregated as hot obj\n",
+			DP_UOID(desc->id_oid));
+		agg_param->ap_credits++;
+		*acts = VOS_ITER_CB_SKIP;
+		goto done;
+	}
+
 check:
 	if (desc->id_agg_write <= agg_param->ap_filter_eph) {
 		if (desc->id_type == VOS_ITER_OBJ)
@@ -2555,6 +2944,8 @@ ec_agg_param_init(struct ds_cont_child *cont, struct agg_param *param)
 	uuid_copy(info->api_pool_uuid, cont->sc_pool->spc_uuid);
 	uuid_copy(info->api_cont_uuid, cont->sc_uuid);
 	info->api_pool = cont->sc_pool->spc_pool;
+	agg_param->ap_agg_entry.ae_metrics = cont->sc_pool->spc_metrics[DAOS_OBJ_MODULE];
+	agg_param->ap_hot = cont->sc_ec_agg_hot;
 
 	agg_param->ap_cont_handle	= cont->sc_hdl;
 	agg_param->ap_yield_func	= agg_rate_ctl;
@@ -2600,6 +2991,82 @@ out:
 	return rc;
 }
 
+/* Aggregates the objects of the hot table, the ones with most replica bytes
+ * first, before the full VOS iteration. The objects stay out of the heap
+ * until ec_agg_hot_round_end(), so they can not be evicted meanwhile. Returns
+ * a positive value if the aggregation is aborted.
+ */
+static int
+agg_hot_objects(struct ec_agg_param *agg_param, vos_iter_param_t *iter_param)
+{
+	struct ec_agg_hot	 *hot = agg_param->ap_hot;
+	struct ec_agg_hot_obj	**objs;
+	struct ec_agg_hot_obj	 *obj;
+	struct vos_iter_anchors	  anchors;
+	vos_iter_param_t	  param = *iter_param;
+	vos_iter_entry_t	  entry = { 0 };
+	daos_size_t		  bytes;
+	unsigned int		  acts = 0;
+	int			  nr, i;
+	int			  rc = 0;
+
+	if (hot == NULL || d_binheap_is_empty(&hot->eh_heap))
+		return 0;
+
+	nr = d_binheap_size(&hot->eh_heap);
+	D_ALLOC_ARRAY(objs, nr);
+	if (objs == NULL)
+		return 0;
+
+	/* The root of the min-heap has the least bytes */
+	for (i = nr - 1; i >= 0; i--) {
+		objs[i] = ec_agg_hot_node2obj(d_binheap_remove_root(&hot->eh_heap));
+		objs[i]->eho_in_heap = 0;
+	}
+
+	for (i = 0; i < nr; i++) {
+		obj = objs[i];
+		D_DEBUG(DB_EPC, "hot oid:"DF_UOID" bytes "DF_U64"\n",
+			DP_UOID(obj->eho_oid), obj->eho_bytes);
+		bytes = obj->eho_bytes;
+		obj->eho_done = 1;
+		obj->eho_bytes = 0;
+		ec_agg_hot_bytes_update(hot, 0, bytes);
+
+		entry.ie_oid = obj->eho_oid;
+		rc = ec_agg_object(DAOS_HDL_INVAL, &entry, agg_param, &acts);
+		if (rc == 0) {
+			agg_param->ap_epr = param.ip_epr;
+			param.ip_oid = obj->eho_oid;
+			memset(&anchors, 0, sizeof(anchors));
+			rc = vos_iterate(&param, VOS_ITER_DKEY, true, &anchors, agg_iterate_pre_cb,
+					 agg_iterate_post_cb, agg_param, NULL);
+		}
+		agg_clear_extents(&agg_param->ap_agg_entry);
+		agg_reset_entry(&agg_param->ap_agg_entry, NULL, NULL);
+
+		if (rc > 0)
+			break;
+		/* Punched or destroyed meanwhile, stays done so it is dropped */
+		if (rc == -DER_NONEXIST) {
+			D_DEBUG(DB_EPC, "hot oid:"DF_UOID" is gone\n", DP_UOID(obj->eho_oid));
+			rc = 0;
+		}
+		/* Let the full iteration retry the object */
+		if (rc < 0) {
+			D_DEBUG(DB_EPC, "hot oid:"DF_UOID" agg failed: "DF_RC"\n",
+				DP_UOID(obj->eho_oid), DP_RC(rc));
+			obj->eho_done = 0;
+			obj->eho_bytes += bytes;
+			ec_agg_hot_bytes_update(hot, bytes, 0);
+			rc = 0;
+		}
+	}
+	D_FREE(objs);
+
+	return rc;
+}
+
 /* Iterates entire VOS. Invokes nested iterator to recurse through trees
  * for all objects meeting the criteria: object is EC, and this target is
  * leader.
@@ -2661,12 +3128,15 @@ cont_ec_aggregate_cb(struct ds_cont_child *cont, daos_epoch_range_t *epr,
 
 	agg_reset_entry(&ec_agg_param->ap_agg_entry, NULL, NULL);
 
-	rc = vos_iterate(&iter_param, VOS_ITER_OBJ, true, &anchors,
-			 agg_iterate_pre_cb, agg_iterate_post_cb, ec_agg_param, NULL);
+	rc = agg_hot_objects(ec_agg_param, &iter_param);
+	if (rc == 0)
+		rc = vos_iterate(&iter_param, VOS_ITER_OBJ, true, &anchors,
+				 agg_iterate_pre_cb, agg_iterate_post_cb, ec_agg_param, NULL);
 
 	/* Post_cb may not being executed in some cases */
 	agg_clear_extents(&ec_agg_param->ap_agg_entry);
 	agg_reset_entry(&ec_agg_param->ap_agg_entry, NULL, NULL);
+	ec_agg_hot_round_end(ec_agg_param->ap_hot);
 
 	if (daos_handle_is_valid(ec_agg_param->ap_agg_entry.ae_obj_hdl)) {
 		dsc_obj_close(ec_agg_param->ap_agg_entry.ae_obj_hdl);
@@ -2717,6 +3187,12 @@ ds_obj_ec_aggregate(void *arg)
 		DP_UUID(cont->sc_uuid));
 	param.ap_data = &agg_param;
 	param.ap_cont = cont;
+	/* Not fatal, all the objects are still found by the full iteration */
+	rc = ec_agg_hot_create(cont);
+	if (rc)
+		D_WARN(DF_UUID" failed to create EC agg hot table: "DF_RC"\n",
+		       DP_UUID(cont->sc_uuid), DP_RC(rc));
+
 	rc = ec_agg_param_init(cont, &param);
 	if (rc) {
 		/* To make sure the EC aggregation can be run on this xstream, let's do not exit
@@ -2729,4 +3205,5 @@ ds_obj_ec_aggregate(void *arg)
 	cont_aggregate_interval(cont, cont_ec_aggregate_cb, &param);
 
 	ec_agg_param_fini(cont, &agg_param);
+	ec_agg_hot_destroy(cont);
 }
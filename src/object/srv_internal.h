@@ -25,6 +25,9 @@
 
 extern struct dss_module_key obj_module_key;
 
+/* Max size of a record returned inline by the enumeration for migration */
+#define OBJ_MIGRATE_INLINE_THRES	1024
+
 /* Per pool attached to the migrate tls(per xstream) */
 struct migrate_pool_tls {
 	/* POOL UUID and pool to be migrated */
@@ -69,6 +72,11 @@ struct migrate_pool_tls {
 	/* Max epoch for the migration, used for migrate fetch RPC */
 	uint64_t		mpt_max_eph;
 
+	/* Incremental reintegration: the target already has the data up to
+	 * this epoch, so only newer data is migrated. 0 to migrate all.
+	 */
+	uint64_t		mpt_min_eph;
+
 	/* The ULT number on each target xstream, which actually refer
 	 * back to the item within mpt_obj/dkey_ult_cnts array.
 	 */
@@ -92,6 +100,18 @@ struct migrate_pool_tls {
 	uint32_t		mpt_inflight_max_ult;
 	uint32_t		mpt_opc;
 
+	/* Adaptive throttle, only used on target xstreams. When the foreground
+	 * latency SLO (in usecs) is set, mpt_inflight_max_size/ult above are
+	 * adjusted between a floor and these ceilings according to the latency
+	 * and queue depth of the foreground I/O on the same target.
+	 */
+	uint64_t		mpt_throttle_max_size;
+	uint64_t		mpt_throttle_ts;
+	uint64_t		mpt_throttle_fg_nr;
+	uint32_t		mpt_throttle_max_ult;
+	uint32_t		mpt_lat_slo;
+	uint32_t		mpt_fg_qd_max;
+
 	ABT_cond		mpt_init_cond;
 	ABT_mutex		mpt_init_mutex;
 
@@ -180,6 +200,14 @@ struct obj_pool_metrics {
 	struct d_tm_node_t	*opm_update_ec_full;
 	/** Total number of EC partial update operations (type = counter) */
 	struct d_tm_node_t	*opm_update_ec_partial;
+	/** Total number of EC aggregation partial stripes with parity delta (type = counter) */
+	struct d_tm_node_t	*opm_ec_agg_delta;
+	/** Total number of EC aggregation partial stripes re-encoded (type = counter) */
+	struct d_tm_node_t	*opm_ec_agg_recalc;
+	/** Total bytes fetched from peers by EC aggregation of partial stripes (type = counter) */
+	struct d_tm_node_t	*opm_ec_agg_fetch_bytes;
+	/** Replica bytes of the objects tracked for EC aggregation (type = gauge) */
+	struct d_tm_node_t	*opm_ec_agg_reclaimable;
 };
 
 struct obj_tls {
@@ -205,6 +233,17 @@ struct obj_tls {
 
 	struct d_tm_node_t	*ot_update_bio_lat[NR_LATENCY_BUCKETS];
 	struct d_tm_node_t	*ot_fetch_bio_lat[NR_LATENCY_BUCKETS];
+
+	/** Foreground (non-migration) update/fetch state sampled by migration throttle */
+	uint64_t		ot_fg_lat_avg;
+	uint64_t		ot_fg_nr;
+	uint32_t		ot_fg_active;
+
+	/** Moving average of foreground update/fetch latency in us (type = gauge) */
+	struct d_tm_node_t	*ot_fg_lat;
+	/** In-flight size and ULT budgets chosen by migration throttle (type = gauge) */
+	struct d_tm_node_t	*ot_migrate_size;
+	struct d_tm_node_t	*ot_migrate_ult;
 };
 
 static inline struct obj_tls *
@@ -231,6 +270,28 @@ lat_bucket(uint64_t size)
 	return 56 - nr;
 }
 
+/* Foreground I/O is the update/fetch not issued on behalf of migration */
+static inline bool
+obj_rpc_is_fg_io(crt_rpc_t *rpc)
+{
+	struct obj_rw_in	*orw;
+
+	if (!obj_rpc_is_update(rpc) && !obj_rpc_is_fetch(rpc))
+		return false;
+
+	orw = crt_req_get(rpc);
+	return (orw->orw_flags & ORF_FOR_MIGRATION) == 0;
+}
+
+/* Feed one foreground I/O latency (in us) into the moving average (1/8 weight) */
+static inline void
+obj_fg_io_sample(struct obj_tls *tls, uint64_t latency)
+{
+	tls->ot_fg_lat_avg = tls->ot_fg_lat_avg - (tls->ot_fg_lat_avg >> 3) + (latency >> 3);
+	tls->ot_fg_nr++;
+	d_tm_set_gauge(tls->ot_fg_lat, tls->ot_fg_lat_avg);
+}
+
 enum latency_type {
 	BULK_LATENCY,
 	BIO_LATENCY,
@@ -626,6 +687,7 @@ fill_oid(daos_unit_oid_t oid, struct ds_obj_enum_arg *arg);
 
 /* srv_ec.c */
 struct obj_rw_in;
-void obj_ec_metrics_process(struct obj_iod_array *iod_array, struct obj_io_context *ioc);
+void obj_ec_metrics_process(struct obj_rw_in *orw, struct obj_io_context *ioc);
+void obj_ec_agg_hot_add(struct ds_cont_child *cont, daos_unit_oid_t oid, daos_size_t bytes);
 
 #endif /* __DAOS_OBJ_SRV_INTENRAL_H__ */
@@ -184,6 +184,24 @@ obj_tls_init(int tags, int xs_id, int tgt_id)
 	obj_latency_tm_init(DAOS_OBJ_RPC_FETCH, tgt_id, tls->ot_fetch_bio_lat,
 			    "bio_fetch", "BIO fetch processing time");
 
+	rc = d_tm_add_metric(&tls->ot_fg_lat, D_TM_STATS_GAUGE,
+			     "moving average of foreground update/fetch latency", "us",
+			     "io/migrate/fg_latency/tgt_%u", tgt_id);
+	if (rc)
+		D_WARN("Failed to create foreground latency sensor: "DF_RC"\n", DP_RC(rc));
+
+	rc = d_tm_add_metric(&tls->ot_migrate_size, D_TM_GAUGE,
+			     "max in-flight migration size chosen by throttle", "bytes",
+			     "io/migrate/max_inflight_size/tgt_%u", tgt_id);
+	if (rc)
+		D_WARN("Failed to create migrate size sensor: "DF_RC"\n", DP_RC(rc));
+
+	rc = d_tm_add_metric(&tls->ot_migrate_ult, D_TM_GAUGE,
+			     "max migration ULTs chosen by throttle", "ults",
+			     "io/migrate/max_ult/tgt_%u", tgt_id);
+	if (rc)
+		D_WARN("Failed to create migrate ULT sensor: "DF_RC"\n", DP_RC(rc));
+
 	return tls;
 }
 
@@ -554,6 +572,34 @@ obj_metrics_alloc(const char *path, int tgt_id)
 		D_WARN("Failed to create EC partial update counter: "DF_RC"\n",
 		       DP_RC(rc));
 
+	/** Total number of EC aggregation partial stripes by parity delta, of type counter */
+	rc = d_tm_add_metric(&metrics->opm_ec_agg_delta, D_TM_COUNTER,
+			     "total number of EC aggregation partial stripes with parity delta",
+			     "stripes", "%s/EC_agg/partial_delta/tgt_%u", path, tgt_id);
+	if (rc)
+		D_WARN("Failed to create EC agg delta counter: "DF_RC"\n", DP_RC(rc));
+
+	/** Total number of EC aggregation partial stripes re-encoded, of type counter */
+	rc = d_tm_add_metric(&metrics->opm_ec_agg_recalc, D_TM_COUNTER,
+			     "total number of EC aggregation partial stripes re-encoded",
+			     "stripes", "%s/EC_agg/partial_recalc/tgt_%u", path, tgt_id);
+	if (rc)
+		D_WARN("Failed to create EC agg recalc counter: "DF_RC"\n", DP_RC(rc));
+
+	/** Total bytes fetched from peers by EC aggregation, of type counter */
+	rc = d_tm_add_metric(&metrics->opm_ec_agg_fetch_bytes, D_TM_COUNTER,
+			     "total number of bytes fetched by EC aggregation of partial stripes",
+			     "bytes", "%s/EC_agg/xferred/fetch/tgt_%u", path, tgt_id);
+	if (rc)
+		D_WARN("Failed to create EC agg bytes fetch counter: "DF_RC"\n", DP_RC(rc));
+
+	/** Replica bytes pending EC aggregation of the hot objects, of type gauge */
+	rc = d_tm_add_metric(&metrics->opm_ec_agg_reclaimable, D_TM_GAUGE,
+			     "replica bytes of the objects pending EC aggregation",
+			     "bytes", "%s/EC_agg/reclaimable/tgt_%u", path, tgt_id);
+	if (rc)
+		D_WARN("Failed to create EC agg reclaimable gauge: "DF_RC"\n", DP_RC(rc));
+
 	return metrics;
 }
 
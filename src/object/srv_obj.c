@@ -1317,6 +1317,7 @@ obj_local_rw_internal(crt_rpc_t *rpc, struct obj_io_context *ioc, daos_iod_t *io
 	bool				create_map;
 	bool				spec_fetch = false;
 	bool				iod_converted = false;
+	bool				ec_srv_recov = false;
 	struct daos_recx_ep_list	*recov_lists = NULL;
 	uint64_t			 cond_flags;
 	uint64_t			 sched_seq = sched_cur_seq();
@@ -1465,6 +1466,10 @@ obj_local_rw_internal(crt_rpc_t *rpc, struct obj_io_context *ioc, daos_iod_t *io
 			}
 			iod_converted = true;
 
+			/* The maps and checksums only describe the local extents */
+			ec_srv_recov = (orw->orw_flags & ORF_EC_RECOV_SRV) && rma && !create_map &&
+				       !ioc->ioc_coc->sc_props.dcp_csum_enabled;
+
 			if (orw->orw_flags & ORF_EC_RECOV_FROM_PARITY) {
 				if (shadows == NULL) {
 					rc = -DER_DATA_LOSS;
@@ -1684,6 +1689,9 @@ post:
 	time = daos_get_ntime();
 	rc = bio_iod_post_async(biod, rc);
 	bio_post_latency = daos_get_ntime() - time;
+
+	/* Reconstructed by obj_ec_srv_recov() once the DTX is done */
+	ioc->ioc_ec_srv_recov = rc == 0 && ec_srv_recov && orwo->orw_rels.ca_arrays != NULL;
 out:
 	/* The DTX has been aborted during long time bulk data transfer. */
 	if (unlikely(dth->dth_aborted))
@@ -1997,6 +2005,234 @@ out:
 	return rc;
 }
 
+/*
+ * EC degraded fetch served by this parity shard, with DAOS_PROP_CO_EC_RECOV set to
+ * "server": read the lost ranges through the engine client stack, which rebuilds them
+ * from the surviving shards, and put them into the client bulk, so the client needs
+ * no recovery round trip. Called once the local fetch and its DTX are done, as it
+ * waits for the other engines. The recovery lists are only dropped from the reply
+ * when all the data has been transferred, on any failure the client reconstructs as
+ * usual.
+ */
+static void
+obj_ec_srv_recov(crt_rpc_t *rpc, struct obj_io_context *ioc)
+{
+	struct obj_rw_in		*orw = crt_req_get(rpc);
+	struct obj_rw_out		*orwo = crt_reply_get(rpc);
+	struct daos_recx_ep_list	*lists = orwo->orw_rels.ca_arrays;
+	struct obj_ec_srv_recov_piece	*pieces = NULL;
+	daos_iod_t			 iod = { 0 };
+	daos_iod_t			*iods = &iod;
+	struct dcs_iod_csums		 csum = { 0 };
+	struct dcs_csum_info		 csum_info = { 0 };
+	struct dcs_iod_csums		*csums = &csum;
+	uint64_t			 off = 0;
+	uint64_t			*offs = &off;
+	uint64_t			 local_skips = 0;
+	uint8_t				*skips = (uint8_t *)&local_skips;
+	uint32_t			 iods_nr = 0;
+	daos_iod_t			*r_iods = NULL;
+	d_sg_list_t			*r_sgls = NULL;
+	d_sg_list_t			*b_sgls = NULL;
+	d_sg_list_t			**b_sgl_ptrs = NULL;
+	uint32_t			*r_map = NULL;
+	uint32_t			*l_map = NULL;
+	daos_handle_t			 coh = DAOS_HDL_INVAL;
+	daos_handle_t			 oh = DAOS_HDL_INVAL;
+	uint64_t			*sizes = orwo->orw_iod_sizes.ca_arrays;
+	daos_size_t			*data_sizes = orwo->orw_data_sizes.ca_arrays;
+	daos_size_t			 rec_size;
+	uint32_t			 r_nr = 0;
+	uint32_t			 nr;
+	int				 i, j, k, idx;
+	int				 rc;
+
+	/* The lists are indexed as the iods of the request, see obj_rw_recx_list_post() */
+	D_ASSERT(orwo->orw_rels.ca_count == orw->orw_nr);
+	for (i = 0; i < orw->orw_nr; i++) {
+		if (lists[i].re_nr == 0)
+			continue;
+		/* single value is rebuilt from the full stripe, leave it to the client */
+		if (orw->orw_iod_array.oia_iods[i].iod_type != DAOS_IOD_ARRAY)
+			return;
+		r_nr++;
+	}
+	if (r_nr == 0)
+		return;
+
+	rc = ds_cont_child_ec_recov_hdl(ioc->ioc_coc, &coh);
+	if (rc != 0)
+		goto out;
+
+	/* The iods of this shard, as they were fetched */
+	rc = obj_get_iods_offs(orw->orw_oid, &orw->orw_iod_array, &ioc->ioc_oca,
+			       orw->orw_dkey_hash, ioc->ioc_layout_ver, &iods, &offs, &skips,
+			       &csums, &csum_info, &iods_nr);
+	if (rc != 0)
+		goto out;
+
+	D_ALLOC_ARRAY(r_iods, r_nr);
+	D_ALLOC_ARRAY(r_sgls, r_nr);
+	D_ALLOC_ARRAY(r_map, r_nr);
+	D_ALLOC_ARRAY(l_map, iods_nr);
+	D_ALLOC_ARRAY(b_sgls, iods_nr);
+	D_ALLOC_ARRAY(b_sgl_ptrs, iods_nr);
+	if (r_iods == NULL || r_sgls == NULL || r_map == NULL || l_map == NULL ||
+	    b_sgls == NULL || b_sgl_ptrs == NULL)
+		D_GOTO(out, rc = -DER_NOMEM);
+
+	for (i = 0, idx = 0; i < orw->orw_nr; i++) {
+		if (skips != NULL && isset(skips, i))
+			continue;
+		l_map[idx++] = i;
+	}
+	D_ASSERT(idx == iods_nr);
+
+	for (i = 0, k = 0; i < iods_nr; i++) {
+		struct daos_recx_ep_list	*list = &lists[l_map[i]];
+		daos_iod_t			*r_iod;
+		d_sg_list_t			*r_sgl;
+		daos_size_t			 len = 0;
+		char				*buf;
+
+		b_sgl_ptrs[i] = &b_sgls[i];
+		if (list->re_nr == 0)
+			continue;
+
+		r_iod = &r_iods[k];
+		r_sgl = &r_sgls[k];
+		r_map[k++] = i;
+		rec_size = sizes[l_map[i]] != 0 ? sizes[l_map[i]] : list->re_items[0].re_rec_size;
+
+		r_iod->iod_name = iods[i].iod_name;
+		r_iod->iod_type = DAOS_IOD_ARRAY;
+		r_iod->iod_size = rec_size;
+		r_iod->iod_nr = list->re_nr;
+		D_ALLOC_ARRAY(r_iod->iod_recxs, list->re_nr);
+		if (r_iod->iod_recxs == NULL)
+			D_GOTO(out, rc = -DER_NOMEM);
+		for (j = 0; j < list->re_nr; j++) {
+			r_iod->iod_recxs[j] = list->re_items[j].re_recx;
+			len += list->re_items[j].re_recx.rx_nr * rec_size;
+		}
+
+		rc = d_sgl_init(r_sgl, 1);
+		if (rc != 0)
+			goto out;
+		D_ALLOC(buf, len);
+		if (buf == NULL)
+			D_GOTO(out, rc = -DER_NOMEM);
+		d_iov_set(&r_sgl->sg_iovs[0], buf, len);
+	}
+
+	rc = dsc_obj_open(coh, orw->orw_oid.id_pub, DAOS_OO_RO, &oh);
+	if (rc != 0)
+		goto out;
+
+	rc = dsc_obj_fetch(oh, orw->orw_epoch, &orw->orw_dkey, r_nr, r_iods, r_sgls, NULL,
+			   DIOF_FOR_EC_AGG, NULL, NULL);
+	if (rc != 0)
+		goto out;
+
+	/* Lay the recovered ranges into the client bulk, the gaps are skipped as holes */
+	for (k = 0; k < r_nr; k++) {
+		d_sg_list_t	*b_sgl;
+		uint64_t	 b_off = 0;
+
+		i = r_map[k];
+		/* all lost records are holes */
+		if (r_iods[k].iod_size == 0)
+			continue;
+
+		rec_size = r_iods[k].iod_size;
+		iods[i].iod_size = rec_size;
+		nr = obj_ec_srv_recov_pieces(&iods[i], &lists[l_map[i]], rec_size, NULL, NULL);
+		if (nr == 0)
+			continue;
+
+		D_FREE(pieces);
+		D_ALLOC_ARRAY(pieces, nr);
+		if (pieces == NULL)
+			D_GOTO(out, rc = -DER_NOMEM);
+		obj_ec_srv_recov_pieces(&iods[i], &lists[l_map[i]], rec_size,
+					r_sgls[k].sg_iovs[0].iov_buf, pieces);
+
+		b_sgl = &b_sgls[i];
+		rc = d_sgl_init(b_sgl, nr * 2);
+		if (rc != 0)
+			goto out;
+		b_sgl->sg_nr_out = 0;
+		for (j = 0; j < nr; j++) {
+			D_ASSERT(pieces[j].sp_off >= b_off);
+			if (pieces[j].sp_off > b_off)
+				d_iov_set(&b_sgl->sg_iovs[b_sgl->sg_nr_out++], NULL,
+					  pieces[j].sp_off - b_off);
+			d_iov_set(&b_sgl->sg_iovs[b_sgl->sg_nr_out++], pieces[j].sp_buf,
+				  pieces[j].sp_len);
+			b_off = pieces[j].sp_off + pieces[j].sp_len;
+		}
+	}
+
+	rc = obj_bulk_transfer(rpc, CRT_BULK_PUT, false, orw->orw_bulks.ca_arrays, offs, skips,
+			       DAOS_HDL_INVAL, b_sgl_ptrs, iods_nr, NULL, ioc->ioc_coh);
+	if (rc != 0)
+		goto out;
+
+	/* Reply sizes cover the recovered data now */
+	for (i = 0; i < iods_nr; i++) {
+		if (b_sgls[i].sg_nr == 0)
+			continue;
+
+		idx = l_map[i];
+		sizes[idx] = iods[i].iod_size;
+		data_sizes[idx] = max(data_sizes[idx], daos_sgl_buf_size(&b_sgls[i]));
+	}
+
+	daos_recx_ep_list_free(lists, orwo->orw_rels.ca_count);
+	orwo->orw_rels.ca_arrays = NULL;
+	orwo->orw_rels.ca_count = 0;
+out:
+	if (rc != 0)
+		DL_INFO(rc, DF_UOID " EC degraded fetch reconstruction, fall back to client",
+			DP_UOID(orw->orw_oid));
+	if (daos_handle_is_valid(oh))
+		dsc_obj_close(oh);
+	if (daos_handle_is_valid(coh))
+		ds_cont_child_ec_recov_hdl_put(ioc->ioc_coc);
+	if (r_iods != NULL) {
+		for (k = 0; k < r_nr; k++)
+			D_FREE(r_iods[k].iod_recxs);
+		D_FREE(r_iods);
+	}
+	if (r_sgls != NULL) {
+		for (k = 0; k < r_nr; k++)
+			d_sgl_fini(&r_sgls[k], true);
+		D_FREE(r_sgls);
+	}
+	if (b_sgls != NULL) {
+		for (i = 0; i < iods_nr; i++)
+			d_sgl_fini(&b_sgls[i], false);
+		D_FREE(b_sgls);
+	}
+	D_FREE(b_sgl_ptrs);
+	D_FREE(l_map);
+	D_FREE(r_map);
+	D_FREE(pieces);
+	if (csums != NULL && csums != &csum && csums != orw->orw_iod_array.oia_iod_csums) {
+		for (i = 0; i < iods_nr; i++) {
+			if (iods[i].iod_type == DAOS_IOD_SINGLE && csums[i].ic_data != NULL)
+				D_FREE(csums[i].ic_data);
+		}
+		D_FREE(csums);
+	}
+	if (iods != NULL && iods != &iod && iods != orw->orw_iod_array.oia_iods)
+		D_FREE(iods);
+	if (offs != NULL && offs != &off && offs != orw->orw_iod_array.oia_offs)
+		D_FREE(offs);
+	if (skips != NULL && skips != (uint8_t *)&local_skips)
+		D_FREE(skips);
+}
+
 static int
 obj_capa_check(struct ds_cont_hdl *coh, bool is_write, bool is_agg_migrate)
 {
@@ -2195,6 +2431,8 @@ out:
 	/** increment active request counter and start the chrono */
 	tls = obj_tls_get();
 	d_tm_inc_gauge(tls->ot_op_active[opc_get(rpc->cr_opc)], 1);
+	if (obj_rpc_is_fg_io(rpc))
+		tls->ot_fg_active++;
 	ioc->ioc_start_time = daos_get_ntime();
 	ioc->ioc_began = 1;
 	return rc;
@@ -2209,11 +2447,16 @@ obj_update_sensors(struct obj_io_context *ioc, int err)
 	struct d_tm_node_t	*lat;
 	uint32_t		opc = ioc->ioc_opc;
 	uint64_t		time;
+	bool			fg_io;
 
 	opm = ioc->ioc_coc->sc_pool->spc_metrics[DAOS_OBJ_MODULE];
 
+	fg_io = obj_rpc_is_fg_io(ioc->ioc_rpc);
+
 	d_tm_dec_gauge(tls->ot_op_active[opc], 1);
 	d_tm_inc_counter(opm->opm_total[opc], 1);
+	if (fg_io)
+		tls->ot_fg_active--;
 
 	if (unlikely(err != 0))
 		return;
@@ -2224,6 +2467,8 @@ obj_update_sensors(struct obj_io_context *ioc, int err)
 	 */
 	time = daos_get_ntime() - ioc->ioc_start_time;
 	time >>= 10;
+	if (fg_io)
+		obj_fg_io_sample(tls, time);
 
 	switch (opc) {
 	case DAOS_OBJ_RPC_UPDATE:
@@ -2231,7 +2476,7 @@ obj_update_sensors(struct obj_io_context *ioc, int err)
 		lat = tls->ot_update_lat[lat_bucket(ioc->ioc_io_size)];
 		orw = crt_req_get(ioc->ioc_rpc);
 		if (orw->orw_iod_array.oia_iods != NULL)
-			obj_ec_metrics_process(&orw->orw_iod_array, ioc);
+			obj_ec_metrics_process(orw, ioc);
 
 		break;
 	case DAOS_OBJ_RPC_TGT_UPDATE:
@@ -2848,6 +3093,8 @@ ds_obj_rw_handler(crt_rpc_t *rpc)
 			rc = obj_local_rw(rpc, &ioc, dth);
 			rc = dtx_end(dth, ioc.ioc_coc, rc);
 		}
+		if (rc == 0 && ioc.ioc_ec_srv_recov)
+			obj_ec_srv_recov(rpc, &ioc);
 
 		D_GOTO(out, rc);
 	}
@@ -3347,7 +3594,14 @@ ds_obj_enum_handler(crt_rpc_t *rpc)
 	anchors[0].ia_ev = oei->oei_anchor;
 
 	/* TODO: Transfer the inline_thres from enumerate RPC */
-	enum_arg.inline_thres = 32;
+	/* Migration applies the inline records straight from the enumeration
+	 * buffer, which saves the fetch RPC per dkey of small replicated objects.
+	 * EC rebuild always fetches, to recalculate the checksums.
+	 */
+	if ((oei->oei_flags & ORF_FOR_MIGRATION) && !daos_oclass_is_ec(&ioc.ioc_oca))
+		enum_arg.inline_thres = OBJ_MIGRATE_INLINE_THRES;
+	else
+		enum_arg.inline_thres = 32;
 
 	if (opc == DAOS_OBJ_RECX_RPC_ENUMERATE) {
 		oeo->oeo_eprs.ca_count = 0;
@@ -38,6 +38,18 @@
 /* Max migrate ULT number on the server */
 #define MIGRATE_DEFAULT_MAX_ULT	4096
 #define ENV_MIGRATE_ULT_CNT	"D_MIGRATE_ULT_CNT"
+
+/* Foreground update/fetch latency SLO in usecs, 0 disables the adaptive throttle */
+#define ENV_MIGRATE_LAT_SLO	"D_MIGRATE_LAT_SLO"
+/* Foreground queue depth on a target above which the target is considered busy */
+#define ENV_MIGRATE_FG_QD	"D_MIGRATE_FG_QD"
+#define MIGRATE_DEFAULT_FG_QD	32
+/* Floor of the per-target in-flight size when the throttle backs off */
+#define MIGRATE_MIN_SIZE	(1 << 20)
+/* Floor of the per-target ULT budget, i.e. one dkey ULT */
+#define MIGRATE_MIN_ULT		2
+/* How often the throttle re-evaluates the budgets, in msecs */
+#define MIGRATE_THROTTLE_INTV	100
 struct migrate_one {
 	daos_key_t		 mo_dkey;
 	uint64_t		 mo_dkey_hash;
@@ -459,11 +471,14 @@ struct migrate_pool_tls_create_arg {
 	ATOMIC uint32_t *obj_ult_cnts;
 	ATOMIC uint32_t *dkey_ult_cnts;
 	uint64_t max_eph;
+	uint64_t min_eph;
 	unsigned int version;
 	unsigned int generation;
 	uint32_t opc;
 	uint32_t new_layout_ver;
 	uint32_t max_ult_cnt;
+	uint32_t lat_slo;
+	uint32_t fg_qd_max;
 };
 
 int
@@ -513,6 +528,7 @@ migrate_pool_tls_create_one(void *data)
 	pool_tls->mpt_size = 0;
 	pool_tls->mpt_root_hdl = DAOS_HDL_INVAL;
 	pool_tls->mpt_max_eph = arg->max_eph;
+	pool_tls->mpt_min_eph = arg->min_eph;
 	pool_tls->mpt_new_layout_ver = arg->new_layout_ver;
 	pool_tls->mpt_opc = arg->opc;
 	if (dss_get_module_info()->dmi_xs_id == 0) {
@@ -538,6 +554,16 @@ migrate_pool_tls_create_one(void *data)
 		pool_tls->mpt_inflight_max_ult = arg->max_ult_cnt / dss_tgt_nr;
 		pool_tls->mpt_tgt_obj_ult_cnt = &arg->obj_ult_cnts[tgt_id];
 		pool_tls->mpt_tgt_dkey_ult_cnt = &arg->dkey_ult_cnts[tgt_id];
+
+		/* Start from the static budget, the throttle (if enabled) will move
+		 * it down under foreground load and up to twice the size when idle.
+		 */
+		pool_tls->mpt_lat_slo = arg->lat_slo;
+		pool_tls->mpt_fg_qd_max = arg->fg_qd_max;
+		pool_tls->mpt_throttle_max_ult = pool_tls->mpt_inflight_max_ult;
+		pool_tls->mpt_throttle_max_size = pool_tls->mpt_inflight_max_size;
+		if (arg->lat_slo != 0)
+			pool_tls->mpt_throttle_max_size <<= 1;
 	}
 
 	pool_tls->mpt_inflight_size = 0;
@@ -563,7 +589,8 @@ out:
 static int
 migrate_pool_tls_lookup_create(struct ds_pool *pool, unsigned int version, unsigned int generation,
 			       uuid_t pool_hdl_uuid, uuid_t co_hdl_uuid, uint64_t max_eph,
-			       uint32_t new_layout_ver, uint32_t opc, struct migrate_pool_tls **p_tls)
+			       uint64_t min_eph, uint32_t new_layout_ver, uint32_t opc,
+			       struct migrate_pool_tls **p_tls)
 {
 	struct migrate_pool_tls *tls = NULL;
 	struct migrate_pool_tls_create_arg arg = { 0 };
@@ -571,6 +598,8 @@ migrate_pool_tls_lookup_create(struct ds_pool *pool, unsigned int version, unsig
 	struct daos_prop_entry	*entry;
 	int			rc = 0;
 	uint32_t		max_migrate_ult = MIGRATE_DEFAULT_MAX_ULT;
+	uint32_t		lat_slo = 0;
+	uint32_t		fg_qd_max = MIGRATE_DEFAULT_FG_QD;
 
 	D_ASSERT(dss_get_module_info()->dmi_xs_id == 0);
 	tls = migrate_pool_tls_lookup(pool->sp_uuid, version, generation);
@@ -592,6 +621,8 @@ migrate_pool_tls_lookup_create(struct ds_pool *pool, unsigned int version, unsig
 	}
 
 	d_getenv_uint(ENV_MIGRATE_ULT_CNT, &max_migrate_ult);
+	d_getenv_uint(ENV_MIGRATE_LAT_SLO, &lat_slo);
+	d_getenv_uint(ENV_MIGRATE_FG_QD, &fg_qd_max);
 	D_ASSERT(generation != (unsigned int)(-1));
 	uuid_copy(arg.pool_uuid, pool->sp_uuid);
 	uuid_copy(arg.pool_hdl_uuid, pool_hdl_uuid);
@@ -599,9 +630,12 @@ migrate_pool_tls_lookup_create(struct ds_pool *pool, unsigned int version, unsig
 	arg.version = version;
 	arg.opc = opc;
 	arg.max_eph = max_eph;
+	arg.min_eph = min_eph;
 	arg.new_layout_ver = new_layout_ver;
 	arg.generation = generation;
 	arg.max_ult_cnt = max_migrate_ult;
+	arg.lat_slo = lat_slo;
+	arg.fg_qd_max = fg_qd_max;
 
 	/*
 	 * dss_task_collective does not do collective on sys xstrem,
@@ -1717,6 +1751,30 @@ migrate_get_cont_child(struct migrate_pool_tls *tls, uuid_t cont_uuid,
 	return rc;
 }
 
+/**
+ * Whether all of the records of the dkey were returned inline by the enumeration,
+ * i.e. it can be applied to the local VOS without fetching from the remote.
+ */
+static bool
+migrate_one_is_inline(struct migrate_one *mrone, struct daos_oclass_attr *oca)
+{
+	int i;
+
+	if (daos_oclass_is_ec(oca) || mrone->mo_iods_num_from_parity > 0)
+		return false;
+
+	for (i = 0; i < mrone->mo_iod_num; i++) {
+		if (mrone->mo_iods[i].iod_type != DAOS_IOD_ARRAY)
+			return false;
+		if (mrone->mo_iods[i].iod_size == 0)
+			continue;
+		if (mrone->mo_sgls == NULL || mrone->mo_sgls[i].sg_nr == 0)
+			return false;
+	}
+
+	return true;
+}
+
 static int
 migrate_dkey(struct migrate_pool_tls *tls, struct migrate_one *mrone,
 	     daos_size_t data_size)
@@ -1797,7 +1855,8 @@ migrate_dkey(struct migrate_pool_tls *tls, struct migrate_one *mrone,
 						  mrone->mo_dkey_hash, &mrone->mo_oca,
 						  mrone->mo_oid.id_shard))
 		rc = migrate_fetch_update_parity(mrone, oh, cont);
-	else if (data_size < MAX_BUF_SIZE || data_size == (daos_size_t)(-1))
+	else if (data_size < MAX_BUF_SIZE || data_size == (daos_size_t)(-1) ||
+		 migrate_one_is_inline(mrone, &mrone->mo_oca))
 		rc = migrate_fetch_update_inline(mrone, oh, cont);
 	else
 		rc = migrate_fetch_update_bulk(mrone, oh, cont);
@@ -1896,6 +1955,71 @@ out:
 	return rc;
 }
 
+/*
+ * Adjust the in-flight size and ULT budgets of the current target according
+ * to the foreground I/O on the same target (AIMD): halve the budgets when the
+ * foreground latency average exceeds the SLO or too many foreground requests
+ * are queued, and grow them by 1/8 of the ceiling when there is no foreground
+ * I/O or the latency is well below the SLO.
+ */
+static void
+migrate_throttle_adjust(struct migrate_pool_tls *tls)
+{
+	struct obj_tls	*otls;
+	uint64_t	 now;
+	uint64_t	 size;
+	uint32_t	 ult;
+	bool		 busy;
+	bool		 idle;
+
+	D_ASSERT(dss_get_module_info()->dmi_xs_id != 0);
+	if (tls->mpt_lat_slo == 0)
+		return;
+
+	now = sched_cur_msec();
+	if (now < tls->mpt_throttle_ts + MIGRATE_THROTTLE_INTV)
+		return;
+	tls->mpt_throttle_ts = now;
+
+	otls = obj_tls_get();
+	size = tls->mpt_inflight_max_size;
+	ult = tls->mpt_inflight_max_ult;
+
+	busy = otls->ot_fg_lat_avg > tls->mpt_lat_slo ||
+	       otls->ot_fg_active > tls->mpt_fg_qd_max;
+	/* No foreground I/O completed since last check, the average is stale */
+	idle = otls->ot_fg_active == 0 && otls->ot_fg_nr == tls->mpt_throttle_fg_nr;
+	tls->mpt_throttle_fg_nr = otls->ot_fg_nr;
+
+	if (busy && !idle) {
+		size = max(size >> 1, MIGRATE_MIN_SIZE);
+		ult = max(ult >> 1, MIGRATE_MIN_ULT);
+	} else if (idle || otls->ot_fg_lat_avg < tls->mpt_lat_slo / 2) {
+		size = min(size + (tls->mpt_throttle_max_size >> 3),
+			   tls->mpt_throttle_max_size);
+		ult = min(ult + max(tls->mpt_throttle_max_ult >> 3, 1),
+			  tls->mpt_throttle_max_ult);
+	}
+
+	if (size == tls->mpt_inflight_max_size && ult == tls->mpt_inflight_max_ult)
+		return;
+
+	D_DEBUG(DB_REBUILD, DF_UUID" fg lat "DF_U64"/%u qd %u: size "DF_U64" -> "DF_U64
+		", ult %u -> %u\n", DP_UUID(tls->mpt_pool_uuid), otls->ot_fg_lat_avg,
+		tls->mpt_lat_slo, otls->ot_fg_active, tls->mpt_inflight_max_size, size,
+		tls->mpt_inflight_max_ult, ult);
+
+	if (size > tls->mpt_inflight_max_size || ult > tls->mpt_inflight_max_ult) {
+		ABT_mutex_lock(tls->mpt_inflight_mutex);
+		ABT_cond_broadcast(tls->mpt_inflight_cond);
+		ABT_mutex_unlock(tls->mpt_inflight_mutex);
+	}
+	tls->mpt_inflight_max_size = size;
+	tls->mpt_inflight_max_ult = ult;
+	d_tm_set_gauge(otls->ot_migrate_size, size);
+	d_tm_set_gauge(otls->ot_migrate_ult, ult);
+}
+
 static int
 migrate_tgt_enter(struct migrate_pool_tls *tls)
 {
@@ -1904,6 +2028,7 @@ migrate_tgt_enter(struct migrate_pool_tls *tls)
 
 	D_ASSERT(dss_get_module_info()->dmi_xs_id != 0);
 
+	migrate_throttle_adjust(tls);
 	dkey_cnt = atomic_load(tls->mpt_tgt_dkey_ult_cnt);
 	while (tls->mpt_inflight_max_ult / 2 <= dkey_cnt) {
 		D_DEBUG(DB_REBUILD, "tgt %u max %u\n", dkey_cnt, tls->mpt_inflight_max_ult);
@@ -1914,6 +2039,7 @@ migrate_tgt_enter(struct migrate_pool_tls *tls)
 		if (tls->mpt_fini)
 			D_GOTO(out, rc = -DER_SHUTDOWN);
 
+		migrate_throttle_adjust(tls);
 		dkey_cnt = atomic_load(tls->mpt_tgt_dkey_ult_cnt);
 	}
 
@@ -1984,24 +2110,11 @@ migrate_tgt_exit(struct migrate_pool_tls *tls, int ult_type)
 }
 
 static void
-migrate_one_ult(void *arg)
+migrate_one_process(struct migrate_pool_tls *tls, struct migrate_one *mrone)
 {
-	struct migrate_one	*mrone = arg;
-	struct migrate_pool_tls	*tls;
 	daos_size_t		data_size;
 	int			rc = 0;
 
-	while (daos_fail_check(DAOS_REBUILD_TGT_REBUILD_HANG))
-		dss_sleep(0);
-
-	tls = migrate_pool_tls_lookup(mrone->mo_pool_uuid,
-				      mrone->mo_pool_tls_version, mrone->mo_generation);
-	if (tls == NULL || tls->mpt_fini) {
-		D_WARN("some one abort the rebuild "DF_UUID"\n",
-		       DP_UUID(mrone->mo_pool_uuid));
-		goto out;
-	}
-
 	data_size = daos_iods_len(mrone->mo_iods, mrone->mo_iod_num);
 	data_size += daos_iods_len(mrone->mo_iods_from_parity,
 				   mrone->mo_iods_num_from_parity);
@@ -2021,10 +2134,11 @@ migrate_one_ult(void *arg)
 		ABT_mutex_lock(tls->mpt_inflight_mutex);
 		ABT_cond_wait(tls->mpt_inflight_cond, tls->mpt_inflight_mutex);
 		ABT_mutex_unlock(tls->mpt_inflight_mutex);
+		migrate_throttle_adjust(tls);
 	}
 
 	if (tls->mpt_fini)
-		D_GOTO(out, rc);
+		return;
 
 	tls->mpt_inflight_size += data_size;
 	rc = migrate_dkey(tls, mrone, data_size);
@@ -2044,6 +2158,26 @@ migrate_one_ult(void *arg)
 	 */
 	if (rc != -DER_NONEXIST && rc != -DER_DATA_LOSS && tls->mpt_status == 0)
 		tls->mpt_status = rc;
+}
+
+static void
+migrate_one_ult(void *arg)
+{
+	struct migrate_one	*mrone = arg;
+	struct migrate_pool_tls	*tls;
+
+	while (daos_fail_check(DAOS_REBUILD_TGT_REBUILD_HANG))
+		dss_sleep(0);
+
+	tls = migrate_pool_tls_lookup(mrone->mo_pool_uuid,
+				      mrone->mo_pool_tls_version, mrone->mo_generation);
+	if (tls == NULL || tls->mpt_fini) {
+		D_WARN("some one abort the rebuild "DF_UUID"\n",
+		       DP_UUID(mrone->mo_pool_uuid));
+		goto out;
+	}
+
+	migrate_one_process(tls, mrone);
 out:
 	migrate_one_destroy(mrone);
 	if (tls != NULL) {
@@ -2052,6 +2186,47 @@ out:
 	}
 }
 
+/* Dkeys of one object whose records all came inline with the enumeration */
+struct migrate_one_batch {
+	d_list_t	mob_list;
+	int		mob_nr;
+};
+
+/* Max number of inline dkeys applied by one migrate ULT */
+#define MIGRATE_BATCH_MAX	64
+
+static void
+migrate_batch_ult(void *arg)
+{
+	struct migrate_one_batch *batch = arg;
+	struct migrate_one	*mrone;
+	struct migrate_pool_tls	*tls;
+
+	while (daos_fail_check(DAOS_REBUILD_TGT_REBUILD_HANG))
+		dss_sleep(0);
+
+	D_ASSERT(!d_list_empty(&batch->mob_list));
+	mrone = d_list_entry(batch->mob_list.next, struct migrate_one, mo_list);
+	tls = migrate_pool_tls_lookup(mrone->mo_pool_uuid,
+				      mrone->mo_pool_tls_version, mrone->mo_generation);
+	if (tls == NULL || tls->mpt_fini)
+		D_WARN("some one abort the rebuild "DF_UUID"\n",
+		       DP_UUID(mrone->mo_pool_uuid));
+
+	while ((mrone = d_list_pop_entry(&batch->mob_list, struct migrate_one,
+					 mo_list)) != NULL) {
+		if (tls != NULL && !tls->mpt_fini)
+			migrate_one_process(tls, mrone);
+		migrate_one_destroy(mrone);
+	}
+
+	D_FREE(batch);
+	if (tls != NULL) {
+		migrate_tgt_exit(tls, DKEY_ULT);
+		migrate_pool_tls_put(tls);
+	}
+}
+
 /* If src_iod is NULL, it will try to merge the recxs inside dst_iod */
 static int
 migrate_merge_iod_recx(daos_iod_t *dst_iod, uint64_t boundary, daos_epoch_t **p_dst_ephs,
@@ -2773,11 +2948,37 @@ put:
 	return rc;
 }
 
+/* Start the ULT for the batched inline dkeys, the batch is freed by the ULT */
+static int
+migrate_batch_start(struct migrate_pool_tls *tls, struct migrate_one_batch *batch, int tgt_idx)
+{
+	struct migrate_one	*mrone;
+	int			rc;
+
+	rc = migrate_tgt_enter(tls);
+	if (rc)
+		goto free;
+
+	rc = dss_ult_create(migrate_batch_ult, batch, DSS_XS_VOS, tgt_idx,
+			    MIGRATE_STACK_SIZE, NULL);
+	if (rc == 0)
+		return 0;
+
+	migrate_tgt_exit(tls, DKEY_ULT);
+free:
+	while ((mrone = d_list_pop_entry(&batch->mob_list, struct migrate_one,
+					 mo_list)) != NULL)
+		migrate_one_destroy(mrone);
+	D_FREE(batch);
+	return rc;
+}
+
 static int
 migrate_start_ult(struct enum_unpack_arg *unpack_arg)
 {
 	struct migrate_pool_tls *tls;
 	struct iter_obj_arg	*arg = unpack_arg->arg;
+	struct migrate_one_batch *batch = NULL;
 	struct migrate_one	*mrone;
 	struct migrate_one	*tmp;
 	int			rc = 0;
@@ -2795,6 +2996,29 @@ migrate_start_ult(struct enum_unpack_arg *unpack_arg)
 			DP_KEY(&mrone->mo_dkey), arg->tgt_idx,
 			mrone->mo_iod_num);
 
+		/* Small dkeys do not need any fetch, so apply them together in
+		 * one ULT instead of paying the ULT and throttle cost per dkey.
+		 */
+		if (migrate_one_is_inline(mrone, &unpack_arg->oc_attr)) {
+			if (batch == NULL) {
+				D_ALLOC_PTR(batch);
+				if (batch == NULL) {
+					rc = -DER_NOMEM;
+					break;
+				}
+				D_INIT_LIST_HEAD(&batch->mob_list);
+			}
+			d_list_move_tail(&mrone->mo_list, &batch->mob_list);
+			if (++batch->mob_nr < MIGRATE_BATCH_MAX)
+				continue;
+
+			rc = migrate_batch_start(tls, batch, arg->tgt_idx);
+			batch = NULL;
+			if (rc)
+				break;
+			continue;
+		}
+
 		rc = migrate_tgt_enter(tls);
 		if (rc)
 			break;
@@ -2808,6 +3032,16 @@ migrate_start_ult(struct enum_unpack_arg *unpack_arg)
 		}
 	}
 
+	if (batch != NULL) {
+		if (rc == 0) {
+			rc = migrate_batch_start(tls, batch, arg->tgt_idx);
+		} else {
+			while ((mrone = d_list_pop_entry(&batch->mob_list, struct migrate_one,
+							 mo_list)) != NULL)
+				migrate_one_destroy(mrone);
+			D_FREE(batch);
+		}
+	}
 put:
 	if (tls)
 		migrate_pool_tls_put(tls);
@@ -2816,6 +3050,9 @@ put:
 
 #define KDS_NUM		96
 #define ITER_BUF_SIZE	2048
+/* Upper bound of the enumeration buffer once it is enlarged for a big object */
+#define ITER_BUF_MAX	(64 << 10)
+#define KDS_MAX		1024
 
 /**
  * Iterate akeys/dkeys of the object
@@ -2830,7 +3067,9 @@ migrate_one_epoch_object(daos_epoch_range_t *epr, struct migrate_pool_tls *tls,
 	char			 stack_buf[ITER_BUF_SIZE] = {0};
 	char			*buf = NULL;
 	daos_size_t		 buf_len;
-	daos_key_desc_t		 kds[KDS_NUM] = {0};
+	daos_key_desc_t		 stack_kds[KDS_NUM] = {0};
+	daos_key_desc_t		*kds = stack_kds;
+	uint32_t		 kds_nr = KDS_NUM;
 	d_iov_t			 csum = {0};
 	d_iov_t			 *p_csum;
 	uint8_t			 stack_csum_buf[CSUM_BUF_SIZE] = {0};
@@ -2930,7 +3169,7 @@ migrate_one_epoch_object(daos_epoch_range_t *epr, struct migrate_pool_tls *tls,
 
 	while (!tls->mpt_fini) {
 		memset(buf, 0, buf_len);
-		memset(kds, 0, KDS_NUM * sizeof(*kds));
+		memset(kds, 0, kds_nr * sizeof(*kds));
 		iov.iov_len = 0;
 		iov.iov_buf = buf;
 		iov.iov_buf_len = buf_len;
@@ -2943,7 +3182,7 @@ migrate_one_epoch_object(daos_epoch_range_t *epr, struct migrate_pool_tls *tls,
 			p_csum->iov_len = 0;
 
 		daos_anchor_set_flags(&dkey_anchor, enum_flags);
-		num = KDS_NUM;
+		num = kds_nr;
 		rc = dsc_obj_list_obj(oh, epr, NULL, NULL, NULL,
 				     &num, kds, &sgl, &anchor,
 				     &dkey_anchor, &akey_anchor, p_csum);
@@ -3069,6 +3308,31 @@ migrate_one_epoch_object(daos_epoch_range_t *epr, struct migrate_pool_tls *tls,
 		if (daos_anchor_is_eof(&dkey_anchor))
 			break;
 
+		/* The enumeration filled the buffer, so the object has more keys,
+		 * enlarge the buffer to get more keys and inline records by each
+		 * RPC. Keep going with the current buffer if allocation fails.
+		 */
+		if (buf_len < ITER_BUF_MAX &&
+		    (num == kds_nr || sgl.sg_iovs[0].iov_len > buf_len / 2)) {
+			daos_key_desc_t	*new_kds = NULL;
+			char		*new_buf;
+			daos_size_t	 new_len = min(buf_len * 4, ITER_BUF_MAX);
+
+			D_ALLOC(new_buf, new_len);
+			if (kds == stack_kds && new_buf != NULL)
+				D_ALLOC_ARRAY(new_kds, KDS_MAX);
+			if (new_buf != NULL) {
+				if (buf != stack_buf)
+					D_FREE(buf);
+				buf = new_buf;
+				buf_len = new_len;
+			}
+			if (new_kds != NULL) {
+				kds = new_kds;
+				kds_nr = KDS_MAX;
+			}
+		}
+
 		/* Restore leader flag to always try the leader first */
 		enum_flags |= DIOF_TO_LEADER;
 	}
@@ -3076,6 +3340,9 @@ migrate_one_epoch_object(daos_epoch_range_t *epr, struct migrate_pool_tls *tls,
 	if (buf != NULL && buf != stack_buf)
 		D_FREE(buf);
 
+	if (kds != stack_kds)
+		D_FREE(kds);
+
 	if (csum.iov_buf != NULL && csum.iov_buf != stack_csum_buf)
 		D_FREE(csum.iov_buf);
 out_obj:
@@ -3172,6 +3439,43 @@ ds_migrate_stop(struct ds_pool *pool, unsigned int version, unsigned int generat
 	D_INFO(DF_UUID" migrate stopped\n", DP_UUID(pool->sp_uuid));
 }
 
+/*
+ * Incremental reintegration: the epoch up to which the target already has the
+ * data of the object. EC objects were discarded entirely, since the parity
+ * shards may have been rewritten by partial updates, see obj_discard_cb().
+ */
+static daos_epoch_t
+migrate_min_eph(struct migrate_pool_tls *tls, struct iter_obj_arg *arg)
+{
+	struct daos_oclass_attr	*oca;
+
+	if (tls->mpt_min_eph == 0)
+		return 0;
+
+	oca = daos_oclass_attr_find(arg->oid.id_pub, NULL);
+	if (oca == NULL || daos_oclass_is_ec(oca))
+		return 0;
+
+	return tls->mpt_min_eph;
+}
+
+/*
+ * Trim the part of \a epr up to \a min_eph, that the target already has.
+ * Return false if there is nothing left to migrate in the range.
+ */
+static bool
+migrate_epr_trim(daos_epoch_t min_eph, daos_epoch_range_t *epr)
+{
+	if (min_eph == 0)
+		return true;
+
+	if (epr->epr_hi <= min_eph)
+		return false;
+
+	epr->epr_lo = max(epr->epr_lo, min_eph + 1);
+	return true;
+}
+
 static int
 migrate_obj_punch(struct iter_obj_arg *arg)
 {
@@ -3198,6 +3502,7 @@ migrate_obj_ult(void *data)
 	struct iter_obj_arg	*arg = data;
 	struct migrate_pool_tls	*tls = NULL;
 	daos_epoch_range_t	epr;
+	daos_epoch_t		min_eph;
 	int			i;
 	int			rc = 0;
 
@@ -3229,9 +3534,12 @@ migrate_obj_ult(void *data)
 		}
 	}
 
+	min_eph = migrate_min_eph(tls, arg);
 	for (i = 0; i < arg->snap_cnt; i++) {
 		epr.epr_lo = i > 0 ? arg->snaps[i - 1] + 1 : 0;
 		epr.epr_hi = arg->snaps[i];
+		if (!migrate_epr_trim(min_eph, &epr))
+			continue;
 		D_DEBUG(DB_REBUILD, "rebuild_snap %d "DF_X64"-"DF_X64"\n",
 			i, epr.epr_lo, epr.epr_hi);
 		rc = migrate_one_epoch_object(&epr, tls, arg);
@@ -3239,7 +3547,8 @@ migrate_obj_ult(void *data)
 			D_GOTO(free, rc);
 	}
 
-	if (arg->snap_cnt > 0 && arg->punched_epoch != 0) {
+	/* Incremental reintegration also needs to replay the punch on the old object */
+	if ((arg->snap_cnt > 0 || min_eph != 0) && arg->punched_epoch > min_eph) {
 		rc = migrate_obj_punch(arg);
 		if (rc)
 			D_GOTO(free, rc);
@@ -3249,7 +3558,8 @@ migrate_obj_ult(void *data)
 	D_ASSERT(tls->mpt_max_eph != 0);
 	epr.epr_hi = tls->mpt_max_eph;
 	if (arg->epoch > 0) {
-		rc = migrate_one_epoch_object(&epr, tls, arg);
+		if (migrate_epr_trim(min_eph, &epr))
+			rc = migrate_one_epoch_object(&epr, tls, arg);
 	} else {
 		/* The obj has been punched for this range */
 		D_DEBUG(DB_REBUILD, "punched obj "DF_UOID" epoch"
@@ -3653,10 +3963,10 @@ migrate_try_obj_insert(struct migrate_pool_tls *tls, uuid_t co_uuid,
 
 int
 ds_migrate_object(struct ds_pool *pool, uuid_t po_hdl, uuid_t co_hdl, uuid_t co_uuid,
-		  uint32_t version, unsigned int generation, uint64_t max_eph, uint32_t opc,
-		  daos_unit_oid_t *oids, daos_epoch_t *epochs, daos_epoch_t *punched_epochs,
-		  unsigned int *shards, uint32_t count, unsigned int tgt_idx,
-		  uint32_t new_layout_ver)
+		  uint32_t version, unsigned int generation, uint64_t max_eph, uint64_t min_eph,
+		  uint32_t opc, daos_unit_oid_t *oids, daos_epoch_t *epochs,
+		  daos_epoch_t *punched_epochs, unsigned int *shards, uint32_t count,
+		  unsigned int tgt_idx, uint32_t new_layout_ver)
 {
 	struct migrate_pool_tls	*tls = NULL;
 	int			i;
@@ -3664,7 +3974,7 @@ ds_migrate_object(struct ds_pool *pool, uuid_t po_hdl, uuid_t co_hdl, uuid_t co_
 
 	/* Check if the pool tls exists */
 	rc = migrate_pool_tls_lookup_create(pool, version, generation, po_hdl, co_hdl, max_eph,
-					    new_layout_ver, opc, &tls);
+					    min_eph, new_layout_ver, opc, &tls);
 	if (rc != 0)
 		D_GOTO(out, rc);
 	if (tls->mpt_fini)
@@ -3734,6 +4044,7 @@ ds_obj_migrate_handler(crt_rpc_t *rpc)
 	uuid_t			co_hdl_uuid;
 	struct ds_pool		*pool = NULL;
 	uint32_t		rebuild_ver;
+	uint64_t		min_eph;
 	int			rc;
 
 	migrate_in = crt_req_get(rpc);
@@ -3784,8 +4095,11 @@ ds_obj_migrate_handler(crt_rpc_t *rpc)
 		D_GOTO(out, rc);
 	}
 
+	/* The reintegration epoch came with the scan request of the same rebuild */
+	min_eph = ds_rebuild_reint_epoch(migrate_in->om_pool_uuid, migrate_in->om_version,
+					 migrate_in->om_generation);
 	rc = ds_migrate_object(pool, po_hdl_uuid, co_hdl_uuid, co_uuid, migrate_in->om_version,
-			       migrate_in->om_generation, migrate_in->om_max_eph,
+			       migrate_in->om_generation, migrate_in->om_max_eph, min_eph,
 			       migrate_in->om_opc, oids, ephs, punched_ephs, shards, oids_count,
 			       migrate_in->om_tgt_idx, migrate_in->om_new_layout_ver);
 out:
@@ -3962,7 +4276,7 @@ ds_object_migrate_send(struct ds_pool *pool, uuid_t pool_hdl_uuid, uuid_t cont_h
 	uuid_copy(migrate_in->om_coh_uuid, cont_hdl_uuid);
 	migrate_in->om_version = version;
 	migrate_in->om_generation = generation;
-	migrate_in->om_max_eph = max_eph,
+	migrate_in->om_max_eph = max_eph;
 	migrate_in->om_tgt_idx = index;
 	migrate_in->om_new_layout_ver = new_layout_ver;
 	migrate_in->om_opc = migrate_opc;
@@ -0,0 +1,345 @@
+/*
+ * (C) Copyright 2024 Intel Corporation.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause-Patent
+ */
+
+#include <stddef.h>
+#include <stdarg.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <isa-l.h>
+#include <daos/tests_lib.h>
+#include <daos/test_perf.h>
+#include "../obj_internal.h"
+
+#define CELL_SZ		(4 << 10)
+#define STRIPE_NR	16
+
+/* obj_class.c references these through dc_obj_query_class() */
+struct dc_object *
+obj_hdl2ptr(daos_handle_t oh)
+{
+	return NULL;
+}
+
+void
+obj_decref(struct dc_object *obj)
+{
+}
+
+struct ec_recov_test_state {
+	struct obj_ec_codec	*codec;
+	uint32_t		 k;
+	uint32_t		 p;
+	/* STRIPE_NR stripes of (k + p) cells, same layout as efi_stripe_sgls */
+	unsigned char		*stripes;
+	unsigned char		*orig;
+};
+
+static void
+ec_encode_stripes(struct ec_recov_test_state *st)
+{
+	unsigned char	*data[OBJ_EC_MAX_K];
+	unsigned char	*parity[OBJ_EC_MAX_P];
+	unsigned char	*stripe;
+	uint32_t	 i, s;
+
+	for (s = 0; s < STRIPE_NR; s++) {
+		stripe = st->stripes + (uint64_t)s * (st->k + st->p) * CELL_SZ;
+		for (i = 0; i < st->k; i++)
+			data[i] = stripe + i * CELL_SZ;
+		for (i = 0; i < st->p; i++)
+			parity[i] = stripe + (st->k + i) * CELL_SZ;
+		ec_encode_data(CELL_SZ, st->k, st->p, st->codec->ec_gftbls, data, parity);
+	}
+}
+
+/* the decode done by obj_ec_recov_data() on the stripes read back */
+static void
+ec_decode_stripes(struct ec_recov_test_state *st, struct obj_ec_recov_codec *recov)
+{
+	struct daos_oclass_attr	oca = { 0 };
+
+	oca.ca_resil = DAOS_RES_EC;
+	oca.u.ec.e_k = st->k;
+	oca.u.ec.e_p = st->p;
+	obj_ec_recov_stripes(recov, &oca, st->stripes, CELL_SZ,
+			     (uint64_t)(st->k + st->p) * CELL_SZ, STRIPE_NR);
+}
+
+static void
+ec_erase_cells(struct ec_recov_test_state *st, uint32_t nerrs, uint32_t *err_offs)
+{
+	uint32_t	i, s;
+
+	for (s = 0; s < STRIPE_NR; s++)
+		for (i = 0; i < nerrs; i++)
+			memset(st->stripes + ((uint64_t)s * (st->k + st->p) + err_offs[i]) *
+			       CELL_SZ, 0, CELL_SZ);
+}
+
+static int
+ec_recov_setup(struct ec_recov_test_state **stp, daos_oclass_id_t oc_id, uint32_t k, uint32_t p)
+{
+	struct ec_recov_test_state	*st;
+	uint64_t			 size = (uint64_t)STRIPE_NR * (k + p) * CELL_SZ;
+
+	D_ALLOC_PTR(st);
+	if (st == NULL)
+		return -1;
+
+	st->k = k;
+	st->p = p;
+	st->codec = obj_ec_codec_get(oc_id);
+	assert_non_null(st->codec);
+	D_ALLOC(st->stripes, size);
+	D_ALLOC(st->orig, size);
+	if (st->stripes == NULL || st->orig == NULL)
+		return -1;
+
+	dts_buf_render((char *)st->stripes, size);
+	ec_encode_stripes(st);
+	memcpy(st->orig, st->stripes, size);
+	*stp = st;
+
+	return 0;
+}
+
+static int
+ec_recov_setup_4p2(void **state)
+{
+	return ec_recov_setup((struct ec_recov_test_state **)state, OC_EC_4P2G1, 4, 2);
+}
+
+static int
+ec_recov_setup_16p2(void **state)
+{
+	return ec_recov_setup((struct ec_recov_test_state **)state, OC_EC_16P2G1, 16, 2);
+}
+
+static int
+ec_recov_teardown(void **state)
+{
+	struct ec_recov_test_state *st = *state;
+
+	D_FREE(st->stripes);
+	D_FREE(st->orig);
+	D_FREE(st);
+
+	return 0;
+}
+
+static void
+ec_recov_check(struct ec_recov_test_state *st, uint32_t nerrs, uint32_t *err_offs)
+{
+	struct obj_ec_recov_codec	*recov, *again;
+
+	recov = obj_ec_recov_codec_get(st->codec, nerrs, err_offs);
+	assert_non_null(recov);
+	assert_int_equal(recov->er_nerrs, nerrs);
+
+	ec_erase_cells(st, nerrs, err_offs);
+	ec_decode_stripes(st, recov);
+	assert_memory_equal(st->stripes, st->orig,
+			    (uint64_t)STRIPE_NR * (st->k + st->p) * CELL_SZ);
+
+	/* same failure pattern hits the cache, whatever the order of the list */
+	if (nerrs == 2) {
+		uint32_t	swapped[2] = {err_offs[1], err_offs[0]};
+
+		again = obj_ec_recov_codec_get(st->codec, nerrs, swapped);
+	} else {
+		again = obj_ec_recov_codec_get(st->codec, nerrs, err_offs);
+	}
+	assert_ptr_equal(recov, again);
+	obj_ec_recov_codec_put(again);
+	obj_ec_recov_codec_put(recov);
+}
+
+static void
+ec_recov_all_patterns(void **state)
+{
+	struct ec_recov_test_state	*st = *state;
+	uint32_t			 errs[2];
+
+	for (errs[0] = 0; errs[0] < st->k + st->p; errs[0]++) {
+		ec_recov_check(st, 1, errs);
+		for (errs[1] = errs[0] + 1; errs[1] < st->k + st->p; errs[1]++)
+			ec_recov_check(st, 2, errs);
+	}
+	assert_true(st->codec->ec_recov_nr <= OBJ_EC_RECOV_CACHE_MAX);
+}
+
+/* the n-th two-cell failure pattern, patterns are taken in a fixed cycle */
+static void
+ec_recov_next_pattern(struct ec_recov_test_state *st, uint32_t n, uint32_t *errs)
+{
+	uint32_t	m = st->k + st->p;
+
+	n %= m * (m - 1) / 2;
+	for (errs[0] = 0; n >= m - 1 - errs[0]; errs[0]++)
+		n -= m - 1 - errs[0];
+	errs[1] = errs[0] + 1 + n;
+}
+
+static void
+ec_recov_evicted_in_use(void **state)
+{
+	struct ec_recov_test_state	*st = *state;
+	struct obj_ec_recov_codec	*held, *recov;
+	uint32_t			 errs[2] = {0, 1};
+	uint32_t			 other[2];
+	uint32_t			 i, m;
+
+	held = obj_ec_recov_codec_get(st->codec, 2, errs);
+	assert_non_null(held);
+
+	/* flush the LRU with all the other patterns, the held codec must stay usable */
+	m = st->k + st->p;
+	assert_true((m - 2) * (m - 3) / 2 > OBJ_EC_RECOV_CACHE_MAX);
+	for (i = 0; i < m * (m - 1) / 2; i++) {
+		ec_recov_next_pattern(st, i, other);
+		if (other[0] < 2)
+			continue;
+		recov = obj_ec_recov_codec_get(st->codec, 2, other);
+		assert_non_null(recov);
+		obj_ec_recov_codec_put(recov);
+	}
+	assert_true(d_list_empty(&held->er_link));
+
+	ec_erase_cells(st, 2, errs);
+	ec_decode_stripes(st, held);
+	assert_memory_equal(st->stripes, st->orig,
+			    (uint64_t)STRIPE_NR * (st->k + st->p) * CELL_SZ);
+	obj_ec_recov_codec_put(held);
+}
+
+/*
+ * Decode tables setup cost, with the failure pattern cycling over more patterns
+ * than the cache holds (every get rebuilds) and over a single pattern (every get
+ * hits), then the decode cost of STRIPE_NR stripes for comparison.
+ */
+static void
+timing_ec_recov_codec(void **state)
+{
+	struct ec_recov_test_state	*st = *state;
+	struct obj_ec_recov_codec	*recov = NULL;
+	uint32_t			 errs[2];
+	uint32_t			 n = 0;
+
+	MEASURE_TIME(recov = obj_ec_recov_codec_get(st->codec, 2, errs),
+		     ec_recov_next_pattern(st, n++, errs),
+		     obj_ec_recov_codec_put(recov));
+
+	errs[0] = 0;
+	errs[1] = st->k;
+	MEASURE_TIME(recov = obj_ec_recov_codec_get(st->codec, 2, errs),
+		     noop(),
+		     obj_ec_recov_codec_put(recov));
+
+	recov = obj_ec_recov_codec_get(st->codec, 2, errs);
+	assert_non_null(recov);
+	MEASURE_TIME(ec_decode_stripes(st, recov), noop(), noop());
+	obj_ec_recov_codec_put(recov);
+}
+
+/*
+ * Layout of the data reconstructed by the parity shard engine into the client bulk, see
+ * obj_ec_srv_recov(): two requested extents [0, 8) and [16, 24), lost ranges [4, 18) and
+ * [20, 22) read back to back, the pieces come in the bulk order.
+ */
+static void
+ec_srv_recov_pieces(void **state)
+{
+	struct obj_ec_srv_recov_piece	 pieces[4];
+	struct daos_recx_ep		 items[2] = { 0 };
+	struct daos_recx_ep_list	 list = { 0 };
+	daos_recx_t			 recxs[2] = { { 0, 8 }, { 16, 8 } };
+	daos_iod_t			 iod = { 0 };
+	daos_size_t			 rec_size = 4;
+	char				 buf[16 * 4];
+
+	iod.iod_type = DAOS_IOD_ARRAY;
+	iod.iod_size = rec_size;
+	iod.iod_nr = 2;
+	iod.iod_recxs = recxs;
+	items[0].re_recx.rx_idx = 4;
+	items[0].re_recx.rx_nr = 14;
+	items[1].re_recx.rx_idx = 20;
+	items[1].re_recx.rx_nr = 2;
+	list.re_items = items;
+	list.re_nr = 2;
+
+	assert_int_equal(obj_ec_srv_recov_pieces(&iod, &list, rec_size, NULL, NULL), 3);
+	assert_int_equal(obj_ec_srv_recov_pieces(&iod, &list, rec_size, buf, pieces), 3);
+
+	/* [4, 8) of the first extent, head of the first lost range */
+	assert_int_equal(pieces[0].sp_off, 4 * rec_size);
+	assert_int_equal(pieces[0].sp_len, 4 * rec_size);
+	assert_ptr_equal(pieces[0].sp_buf, buf);
+	/* [16, 18) starts the second extent, at 8 records in the bulk */
+	assert_int_equal(pieces[1].sp_off, 8 * rec_size);
+	assert_int_equal(pieces[1].sp_len, 2 * rec_size);
+	assert_ptr_equal(pieces[1].sp_buf, buf + 12 * rec_size);
+	/* [20, 22) follows the first lost range in the buffer */
+	assert_int_equal(pieces[2].sp_off, 12 * rec_size);
+	assert_int_equal(pieces[2].sp_len, 2 * rec_size);
+	assert_ptr_equal(pieces[2].sp_buf, buf + 14 * rec_size);
+
+	/* nothing lost in the requested extents */
+	items[0].re_recx.rx_idx = 8;
+	items[0].re_recx.rx_nr = 8;
+	list.re_nr = 1;
+	assert_int_equal(obj_ec_srv_recov_pieces(&iod, &list, rec_size, NULL, NULL), 0);
+}
+
+#define	TA(fn, setup)	{ #fn, fn, setup, ec_recov_teardown }
+
+static const struct CMUnitTest ec_recov_tests[] = {
+	TA(ec_recov_all_patterns, ec_recov_setup_4p2),
+	TA(ec_recov_all_patterns, ec_recov_setup_16p2),
+	TA(ec_recov_evicted_in_use, ec_recov_setup_16p2),
+	TA(timing_ec_recov_codec, ec_recov_setup_16p2),
+	{ "ec_srv_recov_pieces", ec_srv_recov_pieces, NULL, NULL },
+};
+
+static int
+ec_recov_group_setup(void **state)
+{
+	int	rc;
+
+	rc = daos_debug_init(DAOS_LOG_DEFAULT);
+	if (rc)
+		return rc;
+
+	return obj_ec_codec_init();
+}
+
+static int
+ec_recov_group_teardown(void **state)
+{
+	obj_ec_codec_fini();
+	daos_debug_fini();
+	return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+	int	rc = 0;
+#if CMOCKA_FILTER_SUPPORTED == 1 /** for cmocka filter(requires cmocka 1.1.5) */
+	char	 filter[1024];
+
+	if (argc > 1) {
+		snprintf(filter, 1024, "*%s*", argv[1]);
+		cmocka_set_test_filter(filter);
+	}
+#endif
+
+	rc += cmocka_run_group_tests_name("EC degraded read decode codec cache",
+					  ec_recov_tests, ec_recov_group_setup,
+					  ec_recov_group_teardown);
+
+	return rc;
+}
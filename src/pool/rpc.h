@@ -88,7 +88,9 @@
 	X(POOL_ACL_DELETE, 0, &CQF_pool_acl_delete, ds_pool_acl_delete_handler, NULL)              \
 	X(POOL_RANKS_GET, 0, &CQF_pool_ranks_get, ds_pool_ranks_get_handler, NULL)                 \
 	X(POOL_UPGRADE, 0, &CQF_pool_upgrade, ds_pool_upgrade_handler, NULL)                       \
-	X(POOL_TGT_DISCARD, 0, &CQF_pool_tgt_discard, ds_pool_tgt_discard_handler, NULL)
+	X(POOL_TGT_DISCARD, 0, &CQF_pool_tgt_discard, ds_pool_tgt_discard_handler, NULL)           \
+	X(POOL_TGT_DISCARD_EPOCH, 0, &CQF_pool_tgt_discard_epoch, ds_pool_tgt_discard_handler,     \
+	  NULL)
 
 #define POOL_PROTO_RPC_LIST									\
 	POOL_PROTO_CLI_RPC_LIST(DAOS_POOL_VERSION)						\
@@ -1036,6 +1038,17 @@ CRT_RPC_DECLARE(pool_tgt_query_map, DAOS_ISEQ_POOL_TGT_QUERY_MAP, DAOS_OSEQ_POOL
 
 CRT_RPC_DECLARE(pool_tgt_discard, DAOS_ISEQ_POOL_TGT_DISCARD, DAOS_OSEQ_POOL_TGT_DISCARD)
 
+/*
+ * Incremental reintegration, the data up to ptdi_epoch is kept. A server-only opcode of its own,
+ * so that the client-facing pool protocol doesn't change.
+ */
+#define DAOS_ISEQ_POOL_TGT_DISCARD_EPOCH /* input fields */		 \
+	DAOS_ISEQ_POOL_TGT_DISCARD					 \
+	((uint64_t)			(ptdi_epoch)		CRT_VAR)
+
+CRT_RPC_DECLARE(pool_tgt_discard_epoch, DAOS_ISEQ_POOL_TGT_DISCARD_EPOCH,
+		DAOS_OSEQ_POOL_TGT_DISCARD)
+
 /* clang-format on */
 
 static inline int
@@ -31,6 +31,7 @@ RDB_STRING_KEY(ds_pool_prop_, svc_ops_enabled);
 RDB_STRING_KEY(ds_pool_prop_, svc_ops_max);
 RDB_STRING_KEY(ds_pool_prop_, svc_ops_num);
 RDB_STRING_KEY(ds_pool_prop_, svc_ops_age);
+RDB_STRING_KEY(ds_pool_prop_, tgt_excl_epochs);
 
 /** pool handle KVS */
 RDB_STRING_KEY(ds_pool_prop_, handles);
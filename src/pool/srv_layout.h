@@ -36,6 +36,11 @@
  * because version is absent from pool_buf, it has to be stored separately in
  * ds_pool_prop_map_version.
  *
+ * The ds_pool_prop_tgt_excl_epochs property stores, indexed by target ID, the
+ * epoch up to which the data of each excluded target is known to be complete,
+ * i.e. the HLC of its exclusion, or 0 if unknown. It is consulted by the
+ * incremental reintegration mode.
+ *
  * IMPORTANT! Please add new keys to this KVS like this:
  *
  *   extern d_iov_t ds_pool_prop_new_key;	comment_on_value_type
@@ -84,6 +89,7 @@ extern d_iov_t ds_pool_prop_svc_ops_enabled;    /* uint32_t */
 extern d_iov_t ds_pool_prop_svc_ops_max;        /* uint32_t */
 extern d_iov_t ds_pool_prop_svc_ops_num;        /* uint32_t */
 extern d_iov_t ds_pool_prop_svc_ops_age;        /* uint32_t */
+extern d_iov_t ds_pool_prop_tgt_excl_epochs;	/* daos_epoch_t[] */
 /* Please read the IMPORTANT notes above before adding new keys. */
 
 /*
@@ -25,6 +25,7 @@
 #include <daos/rpc.h>
 #include <daos/pool.h>
 #include <daos/rsvc.h>
+#include <daos/dtx.h>
 #include <daos_srv/container.h>
 #include <daos_srv/daos_mgmt_srv.h>
 #include <daos_srv/daos_engine.h>
@@ -304,6 +305,121 @@ read_map(struct rdb_tx *tx, const rdb_path_t *kvs, struct pool_map **map)
 	return pool_map_create(buf, version, map);
 }
 
+/*
+ * Look up the exclusion epoch array in persistent memory into "ephs" and the
+ * number of entries into "nr". A missing array is reported as empty.
+ */
+static int
+locate_excl_epochs(struct rdb_tx *tx, const rdb_path_t *kvs, daos_epoch_t **ephs, uint32_t *nr)
+{
+	d_iov_t	value;
+	int	rc;
+
+	d_iov_set(&value, NULL /* buf */, 0 /* size */);
+	rc = rdb_tx_lookup(tx, kvs, &ds_pool_prop_tgt_excl_epochs, &value);
+	if (rc == -DER_NONEXIST) {
+		*ephs = NULL;
+		*nr = 0;
+		return 0;
+	} else if (rc != 0) {
+		return rc;
+	}
+
+	*ephs = value.iov_buf;
+	*nr = value.iov_len / sizeof(**ephs);
+	return 0;
+}
+
+/*
+ * Record the exclusion epoch of the targets in "tgts" before "map" marks
+ * them down. Only a target in UPIN state has complete data up to now; any
+ * other state, e.g. a target excluded again in the middle of its
+ * reintegration, leaves nothing to build on, so its epoch is reset.
+ */
+static int
+update_excl_epochs(struct rdb_tx *tx, const rdb_path_t *kvs, struct pool_map *map,
+		   struct pool_target_id_list *tgts)
+{
+	daos_epoch_t   *old_ephs;
+	daos_epoch_t   *ephs;
+	daos_epoch_t	now = d_hlc_get();
+	uint32_t	old_nr;
+	uint32_t	nr;
+	d_iov_t		value;
+	int		i;
+	int		rc;
+
+	rc = locate_excl_epochs(tx, kvs, &old_ephs, &old_nr);
+	if (rc != 0)
+		return rc;
+
+	nr = old_nr;
+	for (i = 0; i < tgts->pti_number; i++)
+		nr = max(nr, tgts->pti_ids[i].pti_id + 1);
+
+	D_ALLOC_ARRAY(ephs, nr);
+	if (ephs == NULL)
+		return -DER_NOMEM;
+	if (old_nr > 0)
+		memcpy(ephs, old_ephs, old_nr * sizeof(*ephs));
+
+	for (i = 0; i < tgts->pti_number; i++) {
+		struct pool_target	*tgt;
+		uint32_t		 id = tgts->pti_ids[i].pti_id;
+
+		if (pool_map_find_target(map, id, &tgt) <= 0)
+			continue;
+
+		if (tgt->ta_comp.co_status == PO_COMP_ST_UPIN)
+			ephs[id] = now;
+		else if (!(tgt->ta_comp.co_status & (PO_COMP_ST_DOWN | PO_COMP_ST_DOWNOUT)))
+			ephs[id] = 0;
+	}
+
+	d_iov_set(&value, ephs, nr * sizeof(*ephs));
+	rc = rdb_tx_update(tx, kvs, &ds_pool_prop_tgt_excl_epochs, &value);
+	D_FREE(ephs);
+	return rc;
+}
+
+/*
+ * Return the epoch up to which the data on all the targets in "tgts" is still
+ * valid. The exclusion epoch is only taken by the pool service when the map
+ * changes: transactions with older epochs may still have been in flight, and
+ * committed on the other targets afterwards. So, like for aggregation, only
+ * the epochs older than DAOS_AGG_THRESHOLD before the exclusion are considered
+ * stable. 0 means that at least one of the targets has to be reintegrated from
+ * scratch.
+ */
+static int
+read_reint_epoch(struct rdb_tx *tx, const rdb_path_t *kvs, struct pool_target_id_list *tgts,
+		 daos_epoch_t *epoch)
+{
+	daos_epoch_t   *ephs;
+	daos_epoch_t	min_eph = DAOS_EPOCH_MAX;
+	daos_epoch_t	window = d_sec2hlc(DAOS_AGG_THRESHOLD) + d_hlc_epsilon_get();
+	uint32_t	nr;
+	int		i;
+	int		rc;
+
+	*epoch = 0;
+	rc = locate_excl_epochs(tx, kvs, &ephs, &nr);
+	if (rc != 0)
+		return rc;
+
+	for (i = 0; i < tgts->pti_number; i++) {
+		uint32_t id = tgts->pti_ids[i].pti_id;
+
+		if (id >= nr || ephs[id] <= window)
+			return 0;
+		min_eph = min(min_eph, ephs[id] - window);
+	}
+
+	if (tgts->pti_number > 0)
+		*epoch = min_eph;
+	return 0;
+}
+
 static char *
 pool_svc_rdb_path_common(const uuid_t pool_uuid, const char *suffix)
 {
@@ -2760,6 +2876,7 @@ pool_op_is_write(crt_opcode_t opc)
 	case POOL_TGT_QUERY:
 	case POOL_ADD_TGT:
 	case POOL_TGT_DISCARD:
+	case POOL_TGT_DISCARD_EPOCH:
 		is_write = false;
 		break;
 	default:
@@ -5655,7 +5772,7 @@ pool_check_upgrade_object_layout(struct rdb_tx *tx, struct pool_svc *svc,
 
 	if (current_layout_ver < DS_POOL_OBJ_VERSION) {
 		rc = ds_rebuild_schedule(svc->ps_pool, svc->ps_pool->sp_map_version,
-					 upgrade_eph, DS_POOL_OBJ_VERSION, NULL,
+					 upgrade_eph, 0, DS_POOL_OBJ_VERSION, NULL,
 					 RB_OP_UPGRADE, 0);
 		if (rc == 0)
 			*scheduled_layout_upgrade = true;
@@ -6819,6 +6936,13 @@ pool_svc_update_map_internal(struct pool_svc *svc, unsigned int opc,
 		}
 	}
 
+	/* Remember when the targets are excluded for incremental reintegration. */
+	if (opc == MAP_EXCLUDE) {
+		rc = update_excl_epochs(&tx, &svc->ps_root, map, tgts);
+		if (rc != 0)
+			D_GOTO(out_map, rc);
+	}
+
 	/*
 	 * Attempt to modify the temporary pool map and save its versions
 	 * before and after. If the version hasn't changed, we are done.
@@ -7056,6 +7180,62 @@ ds_pool_tgt_revert_rebuild(uuid_t pool_uuid, struct pool_target_id_list *list)
 					NULL, NULL, NULL, NULL, NULL, NULL);
 }
 
+/*
+ * Get the epoch up to which the data of the reintegrating targets in list is
+ * still valid, see read_reint_epoch(). It is 0 unless the pool reintegrates
+ * incrementally.
+ */
+static int
+pool_svc_reint_epoch_get(struct pool_svc *svc, struct pool_target_addr_list *list,
+			 daos_epoch_t *epoch)
+{
+	struct pool_target_id_list	tgts = { 0 };
+	struct pool_target_addr_list	inval_list = { 0 };
+	struct pool_map		       *map;
+	struct rdb_tx			tx;
+	daos_epoch_t			destroy_eph;
+	int				rc;
+
+	*epoch = 0;
+	if (list == NULL || svc->ps_pool->sp_reint_mode != DAOS_REINT_MODE_INCREMENTAL)
+		return 0;
+
+	rc = rdb_tx_begin(svc->ps_rsvc.s_db, svc->ps_rsvc.s_term, &tx);
+	if (rc != 0)
+		return rc;
+	ABT_rwlock_rdlock(svc->ps_lock);
+
+	rc = read_map(&tx, &svc->ps_root, &map);
+	if (rc != 0)
+		goto out_lock;
+
+	rc = pool_find_all_targets_by_addr(map, list, &tgts, &inval_list);
+	if (rc == 0 && inval_list.pta_number == 0)
+		rc = read_reint_epoch(&tx, &svc->ps_root, &tgts, epoch);
+	pool_map_decref(map);
+
+	/*
+	 * The scan only ships what the other targets still have, nothing of a
+	 * container destroyed since then, so the targets have to be wiped.
+	 */
+	if (rc == 0 && *epoch != 0) {
+		rc = ds_cont_destroy_epoch_get(svc->ps_uuid, &tx, &destroy_eph);
+		if (rc == 0 && destroy_eph > *epoch) {
+			D_INFO(DF_UUID": container destroyed at "DF_X64", full reintegration\n",
+			       DP_UUID(svc->ps_uuid), destroy_eph);
+			*epoch = 0;
+		}
+	}
+out_lock:
+	ABT_rwlock_unlock(svc->ps_lock);
+	rdb_tx_end(&tx);
+	pool_target_id_list_free(&tgts);
+	pool_target_addr_list_free(&inval_list);
+	D_DEBUG(DB_MD, DF_UUID": reintegration epoch "DF_X64": "DF_RC"\n",
+		DP_UUID(svc->ps_uuid), *epoch, DP_RC(rc));
+	return rc;
+}
+
 /*
  * Perform a pool map update indicated by opc. If successful, the new pool map
  * version is reported via map_version. Upon -DER_NOTLEADER, a pool service
@@ -7076,6 +7256,7 @@ pool_svc_update_map(struct pool_svc *svc, crt_opcode_t opc, bool exclude_rank,
 	int				rc;
 	char				*env;
 	daos_epoch_t			rebuild_eph = d_hlc_get();
+	daos_epoch_t			reint_eph = 0;
 	uint64_t			delay = 2;
 
 	rc = pool_svc_update_map_internal(svc, opc, exclude_rank, extend_rank_list,
@@ -7128,8 +7309,14 @@ pool_svc_update_map(struct pool_svc *svc, crt_opcode_t opc, bool exclude_rank,
 	D_DEBUG(DB_MD, "map ver %u/%u\n", map_version ? *map_version : -1,
 		tgt_map_ver);
 
+	if (opc == MAP_REINT) {
+		rc = pool_svc_reint_epoch_get(svc, list, &reint_eph);
+		if (rc)
+			D_GOTO(out, rc);
+	}
+
 	if (tgt_map_ver != 0) {
-		rc = ds_rebuild_schedule(svc->ps_pool, tgt_map_ver, rebuild_eph,
+		rc = ds_rebuild_schedule(svc->ps_pool, tgt_map_ver, rebuild_eph, reint_eph,
 					 0, &target_list, RB_OP_REBUILD, delay);
 		if (rc != 0) {
 			D_ERROR("rebuild fails rc: "DF_RC"\n", DP_RC(rc));
@@ -7182,9 +7369,10 @@ out:
 }
 
 static int
-pool_discard(crt_context_t ctx, struct pool_svc *svc, struct pool_target_addr_list *list)
+pool_discard(crt_context_t ctx, struct pool_svc *svc, struct pool_target_addr_list *list,
+	     daos_epoch_t epoch)
 {
-	struct pool_tgt_discard_in	*ptdi_in;
+	struct pool_tgt_discard_epoch_in *ptdi_in;
 	struct pool_tgt_discard_out	*ptdi_out;
 	crt_rpc_t			*rpc;
 	d_rank_list_t			*rank_list = NULL;
@@ -7212,7 +7400,9 @@ pool_discard(crt_context_t ctx, struct pool_svc *svc, struct pool_target_addr_li
 		D_GOTO(out, rc = 0);
 	}
 
-	opc = DAOS_RPC_OPCODE(POOL_TGT_DISCARD, DAOS_POOL_MODULE, DAOS_POOL_VERSION);
+	/* Only incremental reintegration sends the epoch, the same input followed by the epoch */
+	opc = DAOS_RPC_OPCODE(epoch == 0 ? POOL_TGT_DISCARD : POOL_TGT_DISCARD_EPOCH,
+			      DAOS_POOL_MODULE, DAOS_POOL_VERSION);
 	rc = crt_corpc_req_create(ctx, NULL, rank_list, opc, NULL,
 				  NULL, CRT_RPC_FLAG_FILTER_INVERT,
 				  crt_tree_topo(CRT_TREE_KNOMIAL, 32), &rpc);
@@ -7222,6 +7412,8 @@ pool_discard(crt_context_t ctx, struct pool_svc *svc, struct pool_target_addr_li
 	ptdi_in = crt_req_get(rpc);
 	ptdi_in->ptdi_addrs.ca_arrays = list->pta_addrs;
 	ptdi_in->ptdi_addrs.ca_count = list->pta_number;
+	if (epoch != 0)
+		ptdi_in->ptdi_epoch = epoch;
 	uuid_copy(ptdi_in->ptdi_uuid, svc->ps_pool->sp_uuid);
 	rc = dss_rpc_send(rpc);
 
@@ -7248,6 +7440,7 @@ ds_pool_update_handler(crt_rpc_t *rpc, int handler_version)
 	struct pool_svc		       *svc;
 	struct pool_target_addr_list	list = { 0 };
 	struct pool_target_addr_list	inval_list_out = { 0 };
+	daos_epoch_t			reint_eph;
 	int				rc;
 
 	pool_tgt_update_in_get_data(rpc, &list.pta_addrs, &list.pta_number);
@@ -7264,8 +7457,12 @@ ds_pool_update_handler(crt_rpc_t *rpc, int handler_version)
 		goto out;
 
 	if (opc_get(rpc->cr_opc) == POOL_REINT &&
-	    svc->ps_pool->sp_reint_mode == DAOS_REINT_MODE_DATA_SYNC) {
-		rc = pool_discard(rpc->cr_ctx, svc, &list);
+	    svc->ps_pool->sp_reint_mode != DAOS_REINT_MODE_NO_DATA_SYNC) {
+		rc = pool_svc_reint_epoch_get(svc, &list, &reint_eph);
+		if (rc)
+			goto out_svc;
+
+		rc = pool_discard(rpc->cr_ctx, svc, &list, reint_eph);
 		if (rc)
 			goto out_svc;
 	}
@@ -12,6 +12,18 @@
 #include <daos_prop.h>
 #include "srv_internal.h"
 
+/** Pages written by each step of the background checkpoint */
+#define CHKPT_INCR_PAGES	8
+/** Pause between two background checkpoint steps (ms), to bound the checkpoint bandwidth */
+#define CHKPT_INCR_INTERVAL	100
+
+enum chkpt_type {
+	CHKPT_NONE,
+	/** A few pages with the oldest writes, keeps the WAL usage under the threshold */
+	CHKPT_INCR,
+	CHKPT_FULL,
+};
+
 struct chkpt_ctx {
 	struct dss_module_info *cc_dmi;
 	uuid_t                  cc_pool_uuid;
@@ -23,10 +35,12 @@ struct chkpt_ctx {
 	void                   *cc_sched_arg;
 	ABT_eventual            cc_eventual;
 	uint32_t                cc_max_used_blocks;
+	/** Background checkpoint starts above this WAL usage */
+	uint32_t                cc_low_used_blocks;
 	uint32_t                cc_used_blocks;
 	uint32_t                cc_total_blocks;
 	uint32_t                cc_saved_thresh;
-	uint32_t                cc_sleeping : 1, cc_waiting : 1;
+	uint32_t                cc_sleeping : 1, cc_waiting : 1, cc_incr_pending : 1;
 };
 
 static int
@@ -117,10 +131,16 @@ update_cb(void *arg, uint64_t id, uint32_t used_blocks, uint32_t total_blocks)
 	}
 }
 
-/** Returns true if we should trigger a checkpoint.  Otherwise, it sleeps for some interval and
- *  returns false.
+/** Returns the type of checkpoint we should trigger.  Otherwise, it sleeps for some interval and
+ *  returns CHKPT_NONE.
+ *
+ *  Once the WAL is half way to the threshold, the dirty pages holding the oldest transactions are
+ *  written a few at a time, with a pause in between, so that the WAL stays between the low
+ *  watermark and the threshold with a steady checkpoint bandwidth.  A full checkpoint is only
+ *  needed if the writes outpace it, or when the timed interval elapses.  This applies to the lazy
+ *  mode too, which thus checkpoints in the background before the threshold is reached.
  */
-static bool
+static enum chkpt_type
 need_checkpoint(struct ds_pool_child *child, struct chkpt_ctx *ctx, uint64_t *start)
 {
 	uint32_t        sleep_time = 60000; /* Set default to 60 seconds */
@@ -136,10 +156,11 @@ need_checkpoint(struct ds_pool_child *child, struct chkpt_ctx *ctx, uint64_t *st
 		/** Recalculate the checkpoint max */
 		ctx->cc_saved_thresh    = pool->sp_checkpoint_thresh;
 		ctx->cc_max_used_blocks = (ctx->cc_total_blocks * ctx->cc_saved_thresh) / 100;
+		ctx->cc_low_used_blocks = ctx->cc_max_used_blocks / 2;
 	}
 
 	if (ctx->cc_used_blocks > ctx->cc_max_used_blocks)
-		return true;
+		return CHKPT_FULL;
 
 	if (pool->sp_checkpoint_mode == DAOS_CHECKPOINT_LAZY) {
 		*start = daos_getmtime_coarse();
@@ -158,10 +179,21 @@ need_checkpoint(struct ds_pool_child *child, struct chkpt_ctx *ctx, uint64_t *st
 	 */
 	elapsed = daos_getmtime_coarse() - *start;
 	if (elapsed >= sleep_time)
-		return true;
+		return CHKPT_FULL;
 
 	sleep_time -= elapsed;
 do_sleep:
+	if (pool->sp_checkpoint_mode != DAOS_CHECKPOINT_DISABLED &&
+	    ctx->cc_used_blocks > ctx->cc_low_used_blocks) {
+		if (!ctx->cc_incr_pending) {
+			ctx->cc_incr_pending = 1;
+			return CHKPT_INCR;
+		}
+		/** Rate limit the background checkpoint */
+		ctx->cc_incr_pending = 0;
+		sleep_time = min(sleep_time, CHKPT_INCR_INTERVAL);
+	}
+
 	D_DEBUG(DB_IO,
 		"Checkpoint ULT to sleep for %d ms. Used blocks %d/%d, threshold=%d, mode=%s\n",
 		sleep_time, ctx->cc_used_blocks, ctx->cc_total_blocks, ctx->cc_max_used_blocks,
@@ -172,7 +204,7 @@ do_sleep:
 	sched_req_sleep(child->spc_chkpt_req, sleep_time);
 	ctx->cc_sleeping = 0;
 
-	return false;
+	return CHKPT_NONE;
 }
 
 /** Setup checkpointing context and start checkpointing the pool */
@@ -184,6 +216,7 @@ chkpt_ult(void *arg)
 	uuid_t                pool_uuid;
 	daos_handle_t         poh;
 	uint64_t              start = 0;
+	enum chkpt_type       type;
 	int                   rc;
 
 	poh = child->spc_hdl;
@@ -207,10 +240,14 @@ chkpt_ult(void *arg)
 	vos_pool_checkpoint_init(poh, update_cb, wait_cb, &ctx, &ctx.cc_store);
 
 	while (!dss_ult_exiting(child->spc_chkpt_req)) {
-		if (!need_checkpoint(child, &ctx, &start))
+		type = need_checkpoint(child, &ctx, &start);
+		if (type == CHKPT_NONE)
 			continue;
 
-		rc = vos_pool_checkpoint(poh);
+		if (type == CHKPT_INCR)
+			rc = vos_pool_checkpoint_incr(poh, CHKPT_INCR_PAGES);
+		else
+			rc = vos_pool_checkpoint(poh);
 		if (rc == -DER_SHUTDOWN) {
 			D_ERROR("tgt_id %d shutting down. Checkpointer should quit\n",
 				ctx.cc_dmi->dmi_tgt_id);
@@ -220,7 +257,9 @@ chkpt_ult(void *arg)
 			D_ERROR("Issue with VOS checkpoint (tgt_id: %d): " DF_RC "\n",
 				ctx.cc_dmi->dmi_tgt_id, DP_RC(rc));
 		}
-		start = 0;
+		/** The timed interval restarts after a full checkpoint only */
+		if (type == CHKPT_FULL)
+			start = 0;
 	}
 	vos_pool_checkpoint_fini(poh);
 	ABT_eventual_free(&ctx.cc_eventual);
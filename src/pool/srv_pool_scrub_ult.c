@@ -30,6 +30,8 @@
 #define M_BYTES_SCRUBBED "bytes_scrubbed/current"
 #define M_BYTES_SCRUBBED_TOTAL "bytes_scrubbed/total"
 #define M_BYTES_SCRUBBED_PREV "bytes_scrubbed/prev"
+#define M_BYTES_PER_SEC "bytes_per_sec"
+#define M_COVERAGE "coverage"
 #define M_CSUM_CORRUPTION "corruption/current"
 #define M_CSUM_CORRUPTION_TOTAL "corruption/total"
 #define M_STARTED "scrubber_started"
@@ -200,6 +202,19 @@ sc_add_pool_metrics(struct scrub_ctx *ctx)
 	if (rc)
 		D_WARN("Failed to create scm_bytes_scrubbed_total metric: "DF_RC"\n", DP_RC(rc));
 
+	rc = d_tm_add_metric(&ctx->sc_metrics.scm_bytes_per_sec, D_TM_GAUGE,
+			     "Scrub rate of the current tree scrub", "bytes/sec",
+			     DF_POOL_DIR"/"M_BYTES_PER_SEC, DP_POOL_DIR(ctx));
+	if (rc)
+		D_WARN("Failed to create scm_bytes_per_sec metric: "DF_RC"\n", DP_RC(rc));
+
+	rc = d_tm_add_metric(&ctx->sc_metrics.scm_coverage, D_TM_GAUGE,
+			     "Bytes scrubbed by the current tree scrub, relative to the "
+			     "previous one", "%",
+			     DF_POOL_DIR"/"M_COVERAGE, DP_POOL_DIR(ctx));
+	if (rc)
+		D_WARN("Failed to create scm_coverage metric: "DF_RC"\n", DP_RC(rc));
+
 	rc = d_tm_add_metric(&ctx->sc_metrics.scm_corruption,
 			     D_TM_COUNTER, "Number of silent data corruption "
 					   "detected during current tree scrub",
@@ -31,6 +31,7 @@
 #include <daos/pool_map.h>
 #include <daos/rpc.h>
 #include <daos/pool.h>
+#include <daos/object.h>
 #include <daos_srv/container.h>
 #include <daos_srv/daos_mgmt_srv.h>
 #include <daos_srv/vos.h>
@@ -492,7 +493,7 @@ pool_child_start(struct ds_pool_child *child, bool recreate)
 	if (rc != 0)
 		goto out_chkpt;
 
-	/* Start all containers */
+	/* Start all containers, in the background */
 	rc = ds_cont_child_start_all(child);
 	if (rc)
 		goto out_cont;
@@ -1699,6 +1700,21 @@ update_pool_group(struct ds_pool *pool, struct pool_map *map)
 	return rc;
 }
 
+/*
+ * Whether some targets in "map" may come back with the data they had when
+ * they were excluded, i.e. are DOWN, DOWNOUT or being reintegrated.
+ */
+static bool
+pool_map_has_reint_pending(struct pool_map *map)
+{
+	unsigned int nr = 0;
+
+	/* Only counting, which can't fail */
+	pool_map_find_tgts_by_state(map, PO_COMP_ST_DOWN | PO_COMP_ST_DOWNOUT | PO_COMP_ST_UP,
+				    NULL /* tgt_pp */, &nr);
+	return nr > 0;
+}
+
 /*
  * Called via dss_collective() to update the pool map version in the
  * ds_pool_child object.
@@ -1777,6 +1793,7 @@ ds_pool_tgt_map_update(struct ds_pool *pool, struct pool_buf *buf,
 		/* Swap pool->sp_map and map. */
 		pool->sp_map = map;
 		map = tmp;
+		pool->sp_reint_pending = pool_map_has_reint_pending(pool->sp_map);
 
 		map_updated = true;
 		D_INFO(DF_UUID ": updated pool map: version=%u->%u pointer=%p->%p\n",
@@ -1945,7 +1962,7 @@ ds_pool_tgt_prop_update(struct ds_pool *pool, struct pool_iv_prop *iv_prop)
 	pool->sp_space_rb = iv_prop->pip_space_rb;
 	pool->sp_data_thresh = iv_prop->pip_data_thresh;
 
-	if (iv_prop->pip_reint_mode == DAOS_REINT_MODE_DATA_SYNC &&
+	if (iv_prop->pip_reint_mode != DAOS_REINT_MODE_NO_DATA_SYNC &&
 	    iv_prop->pip_self_heal & DAOS_SELF_HEAL_AUTO_REBUILD)
 		pool->sp_disable_rebuild = 0;
 	else
@@ -2075,7 +2092,8 @@ out:
 
 struct tgt_discard_arg {
 	uuid_t			     pool_uuid;
-	uint64_t		     epoch;
+	/* Epoch range of the data to be discarded */
+	daos_epoch_range_t	     epr;
 	struct pool_target_addr_list tgt_list;
 };
 
@@ -2123,15 +2141,24 @@ obj_discard_cb(daos_handle_t ch, vos_iter_entry_t *ent,
 {
 	struct child_discard_arg	*arg = data;
 	struct d_backoff_seq		backoff_seq;
-	daos_epoch_range_t		epr;
+	struct daos_oclass_attr		*oca;
+	daos_epoch_range_t		epr = arg->tgt_discard->epr;
 	int				rc;
 
+	/* Partial updates of EC objects rewrite the parity shards without updating the
+	 * object on the other shards, so EC objects are always discarded and rebuilt
+	 * entirely, even for incremental reintegration.
+	 */
+	if (epr.epr_lo != 0) {
+		oca = daos_oclass_attr_find(ent->ie_oid.id_pub, NULL);
+		if (oca == NULL || daos_oclass_is_ec(oca))
+			epr.epr_lo = 0;
+	}
+
 	rc = d_backoff_seq_init(&backoff_seq, 0 /* nzeros */, 16 /* factor */, 8 /* next (ms) */,
 				1 << 10 /* max (ms) */);
 	D_ASSERTF(rc == 0, "d_backoff_seq_init: "DF_RC"\n", DP_RC(rc));
 
-	epr.epr_hi = arg->tgt_discard->epoch;
-	epr.epr_lo = 0;
 	do {
 		/* Inform the iterator and delete the object */
 		*acts |= VOS_ITER_CB_DELETE;
@@ -2194,8 +2221,13 @@ cont_discard_cb(daos_handle_t ih, vos_iter_entry_t *entry,
 	D_ASSERTF(rc == 0, "d_backoff_seq_init: "DF_RC"\n", DP_RC(rc));
 
 	param.ip_hdl = coh;
+	/* Partial discard needs to see all the objects, including the punched ones: the
+	 * EC objects are discarded entirely, see obj_discard_cb().
+	 */
 	param.ip_epr.epr_lo = 0;
-	param.ip_epr.epr_hi = arg->tgt_discard->epoch;
+	param.ip_epr.epr_hi = DAOS_EPOCH_MAX;
+	if (arg->tgt_discard->epr.epr_lo != 0)
+		param.ip_flags = VOS_IT_PUNCHED;
 	uuid_copy(arg->cont_uuid, entry->ie_couuid);
 	do {
 		/* Inform the iterator and delete the object */
@@ -2415,8 +2447,12 @@ ds_pool_tgt_discard_handler(crt_rpc_t *rpc)
 	struct pool_target_addr_list	pta_list;
 	struct tgt_discard_arg		*arg = NULL;
 	struct ds_pool			*pool;
+	daos_epoch_t			epoch = 0;
 	int				rc;
 
+	if (opc_get(rpc->cr_opc) == POOL_TGT_DISCARD_EPOCH)
+		epoch = ((struct pool_tgt_discard_epoch_in *)in)->ptdi_epoch;
+
 	pta_list.pta_number = in->ptdi_addrs.ca_count;
 	pta_list.pta_addrs = in->ptdi_addrs.ca_arrays;
 	arg = tgt_discard_arg_alloc(&pta_list);
@@ -2428,7 +2464,11 @@ ds_pool_tgt_discard_handler(crt_rpc_t *rpc)
 	 * Let's do pool lookup to make sure pool child is already created.
 	 */
 	uuid_copy(arg->pool_uuid, in->ptdi_uuid);
-	arg->epoch = DAOS_EPOCH_MAX;
+	/* For incremental reintegration, the data up to ptdi_epoch is still valid
+	 * and only the newer data is discarded, otherwise discard everything.
+	 */
+	arg->epr.epr_lo = epoch == 0 ? 0 : epoch + 1;
+	arg->epr.epr_hi = DAOS_EPOCH_MAX;
 	rc = ds_pool_lookup(arg->pool_uuid, &pool);
 	if (rc) {
 		D_INFO(DF_UUID" can not be found: %d\n", DP_UUID(arg->pool_uuid), rc);
@@ -19,6 +19,8 @@
 #include <daos/pool_map.h>
 #include <daos_srv/daos_engine.h>
 #include <daos_srv/rebuild.h>
+#include <gurt/telemetry_common.h>
+#include <gurt/telemetry_producer.h>
 
 /* Track the pool rebuild status on each target, which exists on
  * all server targets. Then each target will report its rebuild
@@ -77,6 +79,8 @@ struct rebuild_tgt_pool_tracker {
 
 	/* Only used by reclaim job to discard those half-rebuild data */
 	uint64_t		rt_reclaim_epoch;
+	/* Incremental reintegration only rebuilds the data newer than this epoch */
+	uint64_t		rt_reint_epoch;
 	/* local rebuild epoch mainly to constrain the VOS aggregation
 	 * to make sure aggregation will not cross the epoch
 	 */
@@ -149,6 +153,9 @@ struct rebuild_global_pool_tracker {
 	 */
 	uint64_t	rgt_reclaim_epoch;
 
+	/* epoch up to which the data of the reintegrating targets is valid */
+	uint64_t	rgt_reint_epoch;
+
 	ABT_mutex	rgt_lock;
 	/* The current rebuild is done on the leader */
 	ABT_cond	rgt_done_cond;
@@ -221,6 +228,10 @@ struct rebuild_task {
 	 * of half-rebuild/reintegrated job.
 	 */
 	daos_epoch_t			dst_reclaim_eph;
+	/* Epoch up to which the data of the reintegrating targets is still
+	 * valid, 0 means rebuilding all of the data.
+	 */
+	daos_epoch_t			dst_reint_eph;
 	uint64_t			dst_schedule_time;
 	uint32_t			dst_map_ver;
 	uint32_t			dst_new_layout_version;
@@ -230,15 +241,26 @@ struct rebuild_task {
 	uint32_t			dst_reclaim_ver;
 };
 
+/* Objects to be rebuilt are queued by the redundancy left in their group,
+ * queue 0 holds the objects without any redundancy left, the last queue
+ * holds all objects with REBUILD_PRIO_NR - 1 or more failures to spare.
+ */
+#define REBUILD_PRIO_NR		3
+
 /* Per pool structure in TLS to check pool rebuild status
  * per xstream.
  */
 struct rebuild_pool_tls {
 	uuid_t		rebuild_pool_uuid;
-	daos_handle_t	rebuild_tree_hdl; /*hold objects being rebuilt */
+	/* hold objects being rebuilt, one tree per redundancy priority */
+	daos_handle_t	rebuild_tree_hdls[REBUILD_PRIO_NR];
 	d_list_t	rebuild_pool_list;
 	uint64_t	rebuild_pool_obj_count;
 	uint64_t	rebuild_pool_reclaim_obj_count;
+	/* objects without redundancy left, and when the last of them was sent */
+	uint64_t	rebuild_pool_crit_obj_count;
+	uint64_t	rebuild_pool_crit_sent_ts;
+	uint64_t	rebuild_pool_start_ts;
 	unsigned int	rebuild_pool_ver;
 	uint32_t	rebuild_pool_gen;
 	uint64_t	rebuild_pool_leader_term;
@@ -251,6 +273,8 @@ struct rebuild_pool_tls {
 struct rebuild_tls {
 	/* rebuild_pool_tls will link here */
 	d_list_t	rebuild_pool_list;
+	/* time to send all objects without redundancy left in last rebuild (ms) */
+	struct d_tm_node_t	*rebuild_min_redun_time;
 };
 
 struct rebuild_root {
@@ -30,6 +30,7 @@
 #define REBUILD_SEND_LIMIT	4096
 struct rebuild_send_arg {
 	struct rebuild_tgt_pool_tracker *rpt;
+	struct rebuild_pool_tls		*tls;
 	daos_unit_oid_t			*oids;
 	daos_epoch_t			*ephs;
 	daos_epoch_t			*punched_ephs;
@@ -37,6 +38,8 @@ struct rebuild_send_arg {
 	unsigned int			*shards;
 	int				count;
 	unsigned int			tgt_id;
+	/* priority of the object tree being sent */
+	unsigned int			prio;
 };
 
 struct rebuild_obj_val {
@@ -88,6 +91,20 @@ rebuild_obj_fill_buf(daos_handle_t ih, d_iov_t *key_iov,
 	return 0;
 }
 
+/* Objects with less redundancy left have been queued, stop sending current tree */
+static bool
+rebuild_send_preempted(struct rebuild_send_arg *arg)
+{
+	int i;
+
+	for (i = 0; i < arg->prio; i++) {
+		if (!dbtree_is_empty(arg->tls->rebuild_tree_hdls[i]))
+			return true;
+	}
+
+	return false;
+}
+
 static int
 rebuild_obj_send_cb(struct tree_cache_root *root, struct rebuild_send_arg *arg)
 {
@@ -133,6 +150,9 @@ rebuild_obj_send_cb(struct tree_cache_root *root, struct rebuild_send_arg *arg)
 			DP_UUID(rpt->rt_pool_uuid), arg->tgt_id);
 		dss_sleep(daos_rpc_rand_delay(max_delay) << 10);
 	}
+
+	if (rc == 0 && arg->prio == 0)
+		arg->tls->rebuild_pool_crit_sent_ts = daos_getmtime_coarse();
 out:
 	return rc;
 }
@@ -217,6 +237,9 @@ rebuild_tgt_iter_cb(daos_handle_t ih, d_iov_t *key_iov, d_iov_t *val_iov, void *
 				DP_RC(rc));
 			break;
 		}
+
+		if (rebuild_send_preempted(arg))
+			return 1;
 	}
 
 	d_iov_set(&save_key_iov, &tgt_id, sizeof(tgt_id));
@@ -246,6 +269,9 @@ rebuild_cont_iter_cb(daos_handle_t ih, d_iov_t *key_iov,
 				DP_RC(rc));
 			break;
 		}
+
+		if (rebuild_send_preempted(arg))
+			return 1;
 	}
 
 	d_iov_set(&save_key_iov, arg->cont_uuid, sizeof(uuid_t));
@@ -255,6 +281,36 @@ rebuild_cont_iter_cb(daos_handle_t ih, d_iov_t *key_iov,
 	return rc;
 }
 
+/* Return the highest priority non-empty object tree, or -1 if all are empty */
+static int
+rebuild_tree_prio_first(struct rebuild_pool_tls *tls)
+{
+	int i;
+
+	for (i = 0; i < REBUILD_PRIO_NR; i++) {
+		if (!dbtree_is_empty(tls->rebuild_tree_hdls[i]))
+			return i;
+	}
+
+	return -1;
+}
+
+static void
+rebuild_min_redun_report(struct rebuild_tgt_pool_tracker *rpt, struct rebuild_pool_tls *tls)
+{
+	struct rebuild_tls	*rtls = rebuild_tls_get();
+	uint64_t		 elapsed;
+
+	if (tls->rebuild_pool_crit_obj_count == 0)
+		return;
+
+	elapsed = tls->rebuild_pool_crit_sent_ts - tls->rebuild_pool_start_ts;
+	D_INFO(DF_UUID"/%u sent "DF_U64" objects without redundancy left in "DF_U64" ms\n",
+	       DP_UUID(rpt->rt_pool_uuid), rpt->rt_rebuild_ver, tls->rebuild_pool_crit_obj_count,
+	       elapsed);
+	d_tm_set_gauge(rtls->rebuild_min_redun_time, elapsed);
+}
+
 static void
 rebuild_objects_send_ult(void *data)
 {
@@ -265,6 +321,7 @@ rebuild_objects_send_ult(void *data)
 	daos_epoch_t			*ephs = NULL;
 	daos_epoch_t			*punched_ephs = NULL;
 	unsigned int			*shards = NULL;
+	int				prio;
 	int				rc = 0;
 
 	tls = rebuild_pool_tls_lookup(rpt->rt_pool_uuid, rpt->rt_rebuild_ver,
@@ -293,19 +350,22 @@ rebuild_objects_send_ult(void *data)
 	arg.ephs = ephs;
 	arg.punched_ephs = punched_ephs;
 	arg.rpt = rpt;
-	while (!tls->rebuild_pool_scan_done || !dbtree_is_empty(tls->rebuild_tree_hdl)) {
-		if (rpt->rt_stable_epoch == 0) {
-			dss_sleep(0);
-			continue;
-		}
+	arg.tls = tls;
+	while (1) {
+		prio = rebuild_tree_prio_first(tls);
+		if (prio < 0 && tls->rebuild_pool_scan_done)
+			break;
 
-		if (dbtree_is_empty(tls->rebuild_tree_hdl)) {
+		if (rpt->rt_stable_epoch == 0 || prio < 0) {
 			dss_sleep(0);
 			continue;
 		}
 
-		/* walk through the rebuild tree and send the rebuild objects */
-		rc = dbtree_iterate(tls->rebuild_tree_hdl, DAOS_INTENT_MIGRATION,
+		/* walk through the rebuild tree with the least redundancy left and send
+		 * the rebuild objects, it stops once more critical objects are queued.
+		 */
+		arg.prio = prio;
+		rc = dbtree_iterate(tls->rebuild_tree_hdls[prio], DAOS_INTENT_MIGRATION,
 				    false, rebuild_cont_iter_cb, &arg);
 		if (rc < 0) {
 			D_ERROR("dbtree iterate failed: "DF_RC"\n", DP_RC(rc));
@@ -314,6 +374,9 @@ rebuild_objects_send_ult(void *data)
 		dss_sleep(0);
 	}
 
+	if (rc == 0)
+		rebuild_min_redun_report(rpt, tls);
+
 	D_DEBUG(DB_REBUILD, DF_UUID"/%d objects send finish\n",
 		DP_UUID(rpt->rt_pool_uuid), rpt->rt_rebuild_ver);
 out:
@@ -352,7 +415,7 @@ rebuild_scan_done(void *data)
 static int
 rebuild_object_insert(struct rebuild_tgt_pool_tracker *rpt, uuid_t co_uuid,
 		      daos_unit_oid_t oid, unsigned int tgt_id, unsigned int shard,
-		      daos_epoch_t epoch, daos_epoch_t punched_epoch)
+		      unsigned int prio, daos_epoch_t epoch, daos_epoch_t punched_epoch)
 {
 	struct rebuild_pool_tls *tls;
 	struct rebuild_obj_val	val;
@@ -362,15 +425,18 @@ rebuild_object_insert(struct rebuild_tgt_pool_tracker *rpt, uuid_t co_uuid,
 	tls = rebuild_pool_tls_lookup(rpt->rt_pool_uuid, rpt->rt_rebuild_ver,
 				      rpt->rt_rebuild_gen);
 	D_ASSERT(tls != NULL);
-	D_ASSERT(daos_handle_is_valid(tls->rebuild_tree_hdl));
+	D_ASSERT(prio < REBUILD_PRIO_NR);
+	D_ASSERT(daos_handle_is_valid(tls->rebuild_tree_hdls[prio]));
 
 	tls->rebuild_pool_obj_count++;
+	if (prio == 0)
+		tls->rebuild_pool_crit_obj_count++;
 	val.eph = epoch;
 	val.punched_eph = punched_epoch;
 	val.shard = shard;
 	d_iov_set(&val_iov, &val, sizeof(struct rebuild_obj_val));
 	oid.id_shard = shard; /* Convert the OID to rebuilt one */
-	rc = obj_tree_insert(tls->rebuild_tree_hdl, co_uuid, tgt_id, oid, &val_iov);
+	rc = obj_tree_insert(tls->rebuild_tree_hdls[prio], co_uuid, tgt_id, oid, &val_iov);
 	if (rc == -DER_EXIST) {
 		/* If there is reintegrate being restarted due to the failure, then
 		 * it might put multiple shards into the same VOS target, because
@@ -381,8 +447,8 @@ rebuild_object_insert(struct rebuild_tgt_pool_tracker *rpt, uuid_t co_uuid,
 			DP_UUID(co_uuid), DP_UOID(oid), tgt_id);
 		rc = 0;
 	} else {
-		D_DEBUG(DB_REBUILD, "insert "DF_UOID"/"DF_UUID" tgt %u "DF_U64"/"DF_U64": "
-			DF_RC"\n", DP_UOID(oid), DP_UUID(co_uuid), tgt_id, epoch,
+		D_DEBUG(DB_REBUILD, "insert "DF_UOID"/"DF_UUID" tgt %u prio %u "DF_U64"/"DF_U64": "
+			DF_RC"\n", DP_UOID(oid), DP_UUID(co_uuid), tgt_id, prio, epoch,
 			punched_epoch, DP_RC(rc));
 	}
 
@@ -579,8 +645,9 @@ rebuild_obj_ult(void *data)
 
 	ds_migrate_object(rpt->rt_pool, rpt->rt_poh_uuid, rpt->rt_coh_uuid, arg->co_uuid,
 			  rpt->rt_rebuild_ver, rpt->rt_rebuild_gen, rpt->rt_stable_epoch,
-			  rpt->rt_rebuild_op, &arg->oid, &arg->epoch, &arg->punched_epoch,
-			  &arg->shard, 1, arg->tgt_index, rpt->rt_new_layout_ver);
+			  rpt->rt_reint_epoch, rpt->rt_rebuild_op, &arg->oid, &arg->epoch,
+			  &arg->punched_epoch, &arg->shard, 1, arg->tgt_index,
+			  rpt->rt_new_layout_ver);
 	rpt_put(rpt);
 	D_FREE(arg);
 }
@@ -618,7 +685,8 @@ rebuild_object_local(struct rebuild_tgt_pool_tracker *rpt, uuid_t co_uuid,
 
 static int
 rebuild_object(struct rebuild_tgt_pool_tracker *rpt, uuid_t co_uuid, daos_unit_oid_t oid,
-	       unsigned int tgt, uint32_t shard, d_rank_t myrank, vos_iter_entry_t *ent)
+	       unsigned int tgt, uint32_t shard, unsigned int prio, d_rank_t myrank,
+	       vos_iter_entry_t *ent)
 {
 	uint32_t		mytarget = dss_get_module_info()->dmi_tgt_id;
 	struct pool_target	*target;
@@ -649,11 +717,35 @@ rebuild_object(struct rebuild_tgt_pool_tracker *rpt, uuid_t co_uuid, daos_unit_o
 		rc = rebuild_object_local(rpt, co_uuid, oid, target->ta_comp.co_index, shard,
 					  eph, punched_eph);
 	else
-		rc = rebuild_object_insert(rpt, co_uuid, oid, tgt, shard, eph, punched_eph);
+		rc = rebuild_object_insert(rpt, co_uuid, oid, tgt, shard, prio, eph,
+					   punched_eph);
 
 	return rc;
 }
 
+/**
+ * The rebuild priority of the object is the redundancy left in the group of
+ * the scanned shard, i.e. how many more failures the group can tolerate
+ * before losing data, capped by the number of priority queues.
+ */
+static unsigned int
+rebuild_obj_prio(struct daos_oclass_attr *oc_attr, daos_unit_oid_t oid, uint32_t grp_size,
+		 unsigned int *shards, int rebuild_nr)
+{
+	unsigned int	lost = 0;
+	unsigned int	left;
+	int		i;
+
+	for (i = 0; i < rebuild_nr; i++) {
+		if (shards[i] / grp_size == oid.id_shard / grp_size)
+			lost++;
+	}
+
+	left = oc_attr->ca_resil_degree > lost ? oc_attr->ca_resil_degree - lost : 0;
+
+	return min(left, REBUILD_PRIO_NR - 1);
+}
+
 static int
 rebuild_obj_scan_cb(daos_handle_t ch, vos_iter_entry_t *ent,
 		    vos_iter_type_t type, vos_iter_param_t *param,
@@ -670,6 +762,7 @@ rebuild_obj_scan_cb(daos_handle_t ch, vos_iter_entry_t *ent,
 	unsigned int			*shards = NULL;
 	struct daos_oclass_attr		*oc_attr;
 	uint32_t			grp_size;
+	unsigned int			prio;
 	int				rebuild_nr = 0;
 	d_rank_t			myrank;
 	int				i;
@@ -680,8 +773,11 @@ rebuild_obj_scan_cb(daos_handle_t ch, vos_iter_entry_t *ent,
 		return 1;
 	}
 
-	/* If the OID is invisible, then snapshots must be created on the object. */
-	D_ASSERTF(!(ent->ie_vis_flags & VOS_VIS_FLAG_COVERED) || arg->snapshot_cnt > 0,
+	/* If the OID is invisible, then snapshots must be created on the object,
+	 * or incremental reintegration needs to replay the punch.
+	 */
+	D_ASSERTF(!(ent->ie_vis_flags & VOS_VIS_FLAG_COVERED) || arg->snapshot_cnt > 0 ||
+		  rpt->rt_reint_epoch != 0,
 		  "flags %x snapshot_cnt %d\n", ent->ie_vis_flags, arg->snapshot_cnt);
 	map = pl_map_find(rpt->rt_pool_uuid, oid.id_pub);
 	if (map == NULL) {
@@ -697,6 +793,18 @@ rebuild_obj_scan_cb(daos_handle_t ch, vos_iter_entry_t *ent,
 		D_GOTO(out, rc = 0);
 	}
 
+	/* Incremental reintegration: the reintegrating targets still have the replicated
+	 * objects which have not been updated or punched since their exclusion. EC objects
+	 * are always rebuilt, partial updates rewrite the parity shards without updating
+	 * the object on this shard.
+	 */
+	if (rpt->rt_reint_epoch != 0 && !daos_oclass_is_ec(oc_attr) &&
+	    ent->ie_last_update <= rpt->rt_reint_epoch) {
+		D_DEBUG(DB_REBUILD, DF_UOID" skip, last update "DF_X64" reint epoch "DF_X64"\n",
+			DP_UOID(oid), ent->ie_last_update, rpt->rt_reint_epoch);
+		D_GOTO(out, rc = 0);
+	}
+
 	grp_size = daos_oclass_grp_size(oc_attr);
 
 	dc_obj_fetch_md(oid.id_pub, &md);
@@ -746,6 +854,11 @@ rebuild_obj_scan_cb(daos_handle_t ch, vos_iter_entry_t *ent,
 	D_DEBUG(DB_REBUILD, "rebuild obj "DF_UOID" rebuild_nr %d\n", DP_UOID(oid), rc);
 	rebuild_nr = rc;
 	rc = 0;
+	/* Only failure rebuild changes the redundancy, others go to the last queue */
+	if (rpt->rt_rebuild_op == RB_OP_REBUILD)
+		prio = rebuild_obj_prio(oc_attr, oid, grp_size, shards, rebuild_nr);
+	else
+		prio = REBUILD_PRIO_NR - 1;
 	for (i = 0; i < rebuild_nr; i++) {
 		D_DEBUG(DB_REBUILD, "rebuild obj "DF_UOID"/"DF_UUID"/"DF_UUID
 			"on %d for shard %d eph "DF_U64" visible %s\n", DP_UOID(oid),
@@ -760,7 +873,7 @@ rebuild_obj_scan_cb(daos_handle_t ch, vos_iter_entry_t *ent,
 			continue;
 		}
 
-		rc = rebuild_object(rpt, arg->co_uuid, oid, tgts[i], shards[i], myrank, ent);
+		rc = rebuild_object(rpt, arg->co_uuid, oid, tgts[i], shards[i], prio, myrank, ent);
 		if (rc)
 			D_GOTO(out, rc);
 
@@ -890,9 +1003,10 @@ rebuild_container_scan_cb(daos_handle_t ih, vos_iter_entry_t *entry,
 
 	/* If there is no snapshots, then rebuild does not need to migrate
 	 * punched objects at all. Ideally, it should ignore any objects
-	 * whose creation epoch > snapshot epoch.
+	 * whose creation epoch > snapshot epoch. Incremental reintegration
+	 * has to punch the stale objects on the reintegrating targets though.
 	 */
-	if (snapshot_cnt > 0)
+	if (snapshot_cnt > 0 || rpt->rt_reint_epoch != 0)
 		param.ip_flags |= VOS_IT_PUNCHED;
 
 	rc = vos_iterate(&param, VOS_ITER_OBJ, false, &anchor,
@@ -958,6 +1072,7 @@ rebuild_scanner(void *data)
 	struct vos_iter_anchors		anchor = { 0 };
 	ABT_thread			ult_send = ABT_THREAD_NULL;
 	struct umem_attr		uma;
+	int				i;
 	int				rc = 0;
 
 	tls = rebuild_pool_tls_lookup(rpt->rt_pool_uuid, rpt->rt_rebuild_ver,
@@ -978,16 +1093,19 @@ rebuild_scanner(void *data)
 		D_DEBUG(DB_REBUILD, "sleep 2 seconds then retry\n");
 		dss_sleep(2 * 1000);
 	}
-	D_ASSERT(daos_handle_is_inval(tls->rebuild_tree_hdl));
-	/* Create object tree root */
+	/* Create object tree roots */
 	memset(&uma, 0, sizeof(uma));
 	uma.uma_id = UMEM_CLASS_VMEM;
-	rc = dbtree_create(DBTREE_CLASS_UV, 0, 4, &uma, NULL,
-			   &tls->rebuild_tree_hdl);
-	if (rc != 0) {
-		D_ERROR("failed to create rebuild tree: "DF_RC"\n", DP_RC(rc));
-		D_GOTO(out, rc);
+	for (i = 0; i < REBUILD_PRIO_NR; i++) {
+		D_ASSERT(daos_handle_is_inval(tls->rebuild_tree_hdls[i]));
+		rc = dbtree_create(DBTREE_CLASS_UV, 0, 4, &uma, NULL,
+				   &tls->rebuild_tree_hdls[i]);
+		if (rc != 0) {
+			D_ERROR("failed to create rebuild tree: "DF_RC"\n", DP_RC(rc));
+			D_GOTO(out, rc);
+		}
 	}
+	tls->rebuild_pool_start_ts = daos_getmtime_coarse();
 
 	if (rpt->rt_rebuild_op != RB_OP_RECLAIM && rpt->rt_rebuild_op != RB_OP_FAIL_RECLAIM) {
 		rpt_get(rpt);
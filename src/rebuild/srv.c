@@ -73,6 +73,7 @@ rebuild_pool_tls_create(uuid_t pool_uuid, uuid_t poh_uuid, uuid_t coh_uuid,
 {
 	struct rebuild_pool_tls *rebuild_pool_tls;
 	struct rebuild_tls *tls = rebuild_tls_get();
+	int i;
 
 	rebuild_pool_tls = rebuild_pool_tls_lookup(pool_uuid, ver, gen);
 	D_ASSERT(rebuild_pool_tls == NULL);
@@ -88,7 +89,8 @@ rebuild_pool_tls_create(uuid_t pool_uuid, uuid_t poh_uuid, uuid_t coh_uuid,
 	rebuild_pool_tls->rebuild_pool_scan_done = 0;
 	rebuild_pool_tls->rebuild_pool_obj_count = 0;
 	rebuild_pool_tls->rebuild_pool_reclaim_obj_count = 0;
-	rebuild_pool_tls->rebuild_tree_hdl = DAOS_HDL_INVAL;
+	for (i = 0; i < REBUILD_PRIO_NR; i++)
+		rebuild_pool_tls->rebuild_tree_hdls[i] = DAOS_HDL_INVAL;
 	/* Only 1 thread will access the list, no need lock */
 	d_list_add(&rebuild_pool_tls->rebuild_pool_list,
 		   &tls->rebuild_pool_list);
@@ -101,10 +103,14 @@ rebuild_pool_tls_create(uuid_t pool_uuid, uuid_t poh_uuid, uuid_t coh_uuid,
 static void
 rebuild_pool_tls_destroy(struct rebuild_pool_tls *tls)
 {
+	int i;
+
 	D_DEBUG(DB_REBUILD, "TLS destroy for "DF_UUID" ver %d\n",
 		DP_UUID(tls->rebuild_pool_uuid), tls->rebuild_pool_ver);
-	if (daos_handle_is_valid(tls->rebuild_tree_hdl))
-		rebuild_obj_tree_destroy(tls->rebuild_tree_hdl);
+	for (i = 0; i < REBUILD_PRIO_NR; i++) {
+		if (daos_handle_is_valid(tls->rebuild_tree_hdls[i]))
+			rebuild_obj_tree_destroy(tls->rebuild_tree_hdls[i]);
+	}
 	d_list_del(&tls->rebuild_pool_list);
 	D_FREE(tls);
 }
@@ -113,12 +119,22 @@ static void *
 rebuild_tls_init(int tags, int xs_id, int tgt_id)
 {
 	struct rebuild_tls *tls;
+	int		    rc;
 
 	D_ALLOC_PTR(tls);
 	if (tls == NULL)
 		return NULL;
 
 	D_INIT_LIST_HEAD(&tls->rebuild_pool_list);
+	if (tgt_id < 0)
+		return tls;
+
+	rc = d_tm_add_metric(&tls->rebuild_min_redun_time, D_TM_GAUGE,
+			     "time to send all objects without redundancy left in last rebuild",
+			     "ms", "rebuild/min_redundancy_restore/tgt_%u", tgt_id);
+	if (rc)
+		D_WARN("Failed to create min redundancy restore sensor: "DF_RC"\n", DP_RC(rc));
+
 	return tls;
 }
 
@@ -463,6 +479,26 @@ ds_rebuild_running_query(uuid_t pool_uuid, uint32_t opc, uint32_t *upper_ver,
 		rpt_put(rpt);
 }
 
+/*
+ * Incremental reintegration: the epoch up to which the reintegrating targets already have the
+ * data, for the rebuild \a rebuild_ver/\a rebuild_gen of this engine. 0 means a full rebuild.
+ * It comes with the scan request, so the migrate RPC doesn't need to carry it.
+ */
+daos_epoch_t
+ds_rebuild_reint_epoch(uuid_t pool_uuid, uint32_t rebuild_ver, uint32_t rebuild_gen)
+{
+	struct rebuild_tgt_pool_tracker	*rpt;
+	daos_epoch_t			 reint_eph = 0;
+
+	rpt = rpt_lookup(pool_uuid, -1, rebuild_ver, rebuild_gen);
+	if (rpt != NULL) {
+		if (!rpt->rt_abort)
+			reint_eph = rpt->rt_reint_epoch;
+		rpt_put(rpt);
+	}
+	return reint_eph;
+}
+
 /* TODO: Add something about what the current operation is for output status */
 int
 ds_rebuild_query(uuid_t pool_uuid, struct daos_rebuild_status *status)
@@ -972,6 +1008,7 @@ rebuild_scan_broadcast(struct ds_pool *pool, struct rebuild_global_pool_tracker
 		D_ASSERT(rgt->rgt_reclaim_epoch != 0);
 
 	rsi->rsi_reclaim_epoch = rgt->rgt_reclaim_epoch;
+	rsi->rsi_reint_epoch = rgt->rgt_reint_epoch;
 	rsi->rsi_layout_ver = layout_version;
 	rsi->rsi_tgts_num = tgts_failed->pti_number;
 	rsi->rsi_rebuild_op = rebuild_op;
@@ -1153,7 +1190,7 @@ rebuild_task_get_min_version(struct pool_map *map, struct pool_target_id_list *t
  */
 static int
 rebuild_try_merge_tgts(struct ds_pool *pool, uint32_t map_ver,
-		       daos_rebuild_opc_t rebuild_op,
+		       daos_rebuild_opc_t rebuild_op, daos_epoch_t reint_eph,
 		       struct pool_target_id_list *tgts, uint64_t delay_sec)
 {
 	struct rebuild_task *task;
@@ -1223,6 +1260,11 @@ rebuild_try_merge_tgts(struct ds_pool *pool, uint32_t map_ver,
 	if (rc)
 		return rc;
 
+	/* The merged targets are only valid up to the older epoch, and excluded
+	 * targets (reint_eph 0) need the full rebuild.
+	 */
+	merge_task->dst_reint_eph = min(merge_task->dst_reint_eph, reint_eph);
+
 	if (merge_task->dst_map_ver < map_ver) {
 		D_DEBUG(DB_REBUILD, "rebuild task ver %u --> %u\n",
 			merge_task->dst_map_ver, map_ver);
@@ -1280,9 +1322,10 @@ rebuild_leader_start(struct ds_pool *pool, struct rebuild_task *task,
 		return rc;
 
 	D_ASSERT(*p_rgt != NULL);
-	D_INFO("rebuild "DF_UUID", version=%u/%u, op=%s\n",
+	(*p_rgt)->rgt_reint_epoch = task->dst_reint_eph;
+	D_INFO("rebuild "DF_UUID", version=%u/%u, op=%s, reint epoch "DF_X64"\n",
 	       DP_UUID(pool->sp_uuid), task->dst_map_ver, pool->sp_rebuild_gen,
-	       RB_OP_STR(task->dst_rebuild_op));
+	       RB_OP_STR(task->dst_rebuild_op), task->dst_reint_eph);
 
 	/* broadcast scan RPC to all targets */
 	rc = rebuild_scan_broadcast(pool, *p_rgt, &task->dst_tgts,
@@ -1359,7 +1402,7 @@ rebuild_task_complete_schedule(struct rebuild_task *task, struct ds_pool *pool,
 		D_INFO(DF_UUID"retry opc %u/%u: %d\n", DP_UUID(task->dst_pool_uuid),
 		       task->dst_rebuild_op, task->dst_map_ver, ret);
 		rc = ds_rebuild_schedule(pool, task->dst_map_ver, task->dst_reclaim_eph,
-					 task->dst_new_layout_version,
+					 task->dst_reint_eph, task->dst_new_layout_version,
 					 &task->dst_tgts, task->dst_rebuild_op, 5);
 		return rc;
 	}
@@ -1383,7 +1426,7 @@ rebuild_task_complete_schedule(struct rebuild_task *task, struct ds_pool *pool,
 		if (task->dst_rebuild_op == RB_OP_RECLAIM ||
 		    task->dst_rebuild_op == RB_OP_FAIL_RECLAIM) {
 			rc = ds_rebuild_schedule(pool, task->dst_map_ver, rgt->rgt_stable_epoch,
-						 task->dst_new_layout_version, &task->dst_tgts,
+						 0, task->dst_new_layout_version, &task->dst_tgts,
 						 task->dst_rebuild_op, 5);
 			return rc;
 		}
@@ -1397,7 +1440,7 @@ rebuild_task_complete_schedule(struct rebuild_task *task, struct ds_pool *pool,
 			 * (reclaim - 1 see obj_reclaim()), but keep the in-flight I/O data.
 			 */
 			rc = ds_rebuild_schedule(pool, task->dst_reclaim_ver - 1,
-						 rgt->rgt_stable_epoch,
+						 rgt->rgt_stable_epoch, 0,
 						 task->dst_new_layout_version,
 						 &task->dst_tgts, RB_OP_FAIL_RECLAIM, 5);
 			if (rc)
@@ -1410,14 +1453,15 @@ rebuild_task_complete_schedule(struct rebuild_task *task, struct ds_pool *pool,
 		if (retry_opc == RB_OP_NONE)
 			D_GOTO(complete, rc);
 
+		/* The failed attempt has been reclaimed, so retry with the full rebuild */
 		rc = ds_rebuild_schedule(pool, task->dst_map_ver, rgt->rgt_stable_epoch,
-					 task->dst_new_layout_version, &task->dst_tgts,
+					 0, task->dst_new_layout_version, &task->dst_tgts,
 					 retry_opc, 5);
 	} else if (task->dst_rebuild_op == RB_OP_REBUILD || task->dst_rebuild_op == RB_OP_UPGRADE) {
 		/* Otherwise schedule reclaim for reintegrate/extend/upgrade. */
 		rgt->rgt_status.rs_state = DRS_IN_PROGRESS;
 		rc = ds_rebuild_schedule(pool, task->dst_map_ver, rgt->rgt_reclaim_epoch,
-					 task->dst_new_layout_version,
+					 0, task->dst_new_layout_version,
 					 &task->dst_tgts, RB_OP_RECLAIM, 5);
 		if (rc != 0)
 			D_ERROR("reschedule reclaim, "DF_UUID" failed: "DF_RC"\n",
@@ -1854,7 +1898,7 @@ rebuild_print_list_update(const uuid_t uuid, const uint32_t map_ver,
  */
 int
 ds_rebuild_schedule(struct ds_pool *pool, uint32_t map_ver,
-		    daos_epoch_t reclaim_eph, uint32_t layout_version,
+		    daos_epoch_t reclaim_eph, daos_epoch_t reint_eph, uint32_t layout_version,
 		    struct pool_target_id_list *tgts,
 		    daos_rebuild_opc_t rebuild_op, uint64_t delay_sec)
 {
@@ -1875,7 +1919,7 @@ ds_rebuild_schedule(struct ds_pool *pool, uint32_t map_ver,
 	if (tgts != NULL && tgts->pti_number > 0 &&
 	    rebuild_op != RB_OP_RECLAIM && rebuild_op != RB_OP_FAIL_RECLAIM) {
 		/* Check if the pool already in the queue list */
-		rc = rebuild_try_merge_tgts(pool, map_ver, rebuild_op, tgts, delay_sec);
+		rc = rebuild_try_merge_tgts(pool, map_ver, rebuild_op, reint_eph, tgts, delay_sec);
 		if (rc)
 			return rc == 1 ? 0 : rc;
 	}
@@ -1896,6 +1940,7 @@ ds_rebuild_schedule(struct ds_pool *pool, uint32_t map_ver,
 	new_task->dst_reclaim_ver = map_ver;
 	new_task->dst_rebuild_op = rebuild_op;
 	new_task->dst_reclaim_eph = reclaim_eph;
+	new_task->dst_reint_eph = reint_eph;
 	new_task->dst_new_layout_version = layout_version;
 	uuid_copy(new_task->dst_pool_uuid, pool->sp_uuid);
 	D_INIT_LIST_HEAD(&new_task->dst_list);
@@ -1985,12 +2030,12 @@ regenerate_task_internal(struct ds_pool *pool, struct pool_target *tgts,
 		if (tgt->ta_comp.co_status & (PO_COMP_ST_DOWN | PO_COMP_ST_DRAIN)) {
 			rc = ds_rebuild_schedule(pool, tgt->ta_comp.co_fseq,
 						 current_eph == 0 ? eph : current_eph,
-						 0, &id_list, RB_OP_REBUILD, delay);
+						 0, 0, &id_list, RB_OP_REBUILD, delay);
 		} else {
 			D_ASSERT(tgt->ta_comp.co_status == PO_COMP_ST_UP);
 			rc = ds_rebuild_schedule(pool, tgt->ta_comp.co_in_ver,
 						 current_eph == 0 ? eph : current_eph,
-						 0, &id_list, RB_OP_REBUILD, delay);
+						 0, 0, &id_list, RB_OP_REBUILD, delay);
 		}
 		if (rc) {
 			D_ERROR(DF_UUID" schedule ver %d failed: "DF_RC"\n",
@@ -2460,6 +2505,7 @@ rebuild_tgt_prepare(crt_rpc_t *rpc, struct rebuild_tgt_pool_tracker **p_rpt)
 		D_GOTO(out, rc);
 
 	rpt->rt_rebuild_op = rsi->rsi_rebuild_op;
+	rpt->rt_reint_epoch = rsi->rsi_reint_epoch;
 
 	/* Let's add the rpt to the tracker list before IV fetch, which might yield,
 	 * to make sure the new coming request can find the rpt in the list.
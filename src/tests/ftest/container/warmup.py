@@ -0,0 +1,85 @@
+'''
+  (C) Copyright 2024 Intel Corporation.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+'''
+from apricot import TestWithServers
+
+
+class ContainerWarmupTest(TestWithServers):
+    """
+    Test Class Description: Verify the containers of a pool are started in the background
+                            when the engine starts.
+    :avocado: recursive
+    """
+
+    def restart_engines(self, stop_after_start=False):
+        """Stop and start the engines.
+
+        Args:
+            stop_after_start (bool, optional): stop the engines again right after they are
+                started, while the containers are being started. Defaults to False.
+        """
+        dmg = self.server_managers[0].dmg
+        dmg.system_stop(force=True)
+        dmg.system_start()
+        if stop_after_start:
+            dmg.system_stop(force=True)
+            dmg.system_start()
+
+    def verify_warmup(self, started_before, expected):
+        """Verify the container warm-up ran on every target since the given count of logs.
+
+        Args:
+            started_before (int): number of warm-up logs found before the engines were started
+            expected (int): minimal number of new warm-up logs
+
+        Returns:
+            int: number of warm-up logs found
+        """
+        started = self.server_managers[0].search_log(
+            "(All containers started|Container warm-up stopped)")
+        if started - started_before < expected:
+            self.fail(
+                f"Container warm-up ran {started - started_before} times, "
+                f"expected at least {expected}")
+        if self.server_managers[0].search_log("Failed to start all containers"):
+            self.fail("Container warm-up failed")
+        return started
+
+    def test_container_warmup(self):
+        """
+
+        Test Description: Restart the engines of a pool with many containers and use the
+                          containers while they are started in the background.
+        Use Case: Create a pool and many containers, restart the engines and query every
+                  container right away, the query opens a container the warm-up didn't
+                  start yet. Check the warm-up ran on every target. Then stop the engines
+                  right after they are started, while the warm-up is running, and check
+                  the engines stop and the containers are usable after the next start.
+
+        :avocado: tags=all,full_regression
+        :avocado: tags=vm
+        :avocado: tags=container
+        :avocado: tags=ContainerWarmupTest,test_container_warmup
+        """
+        cont_nr = self.params.get("containers", "/run/warmup/*", 256)
+        targets = self.server_managers[0].get_config_value("targets")
+
+        self.log_step(f"Create a pool and {cont_nr} containers")
+        pool = self.get_pool(connect=False)
+        containers = [self.get_container(pool) for _ in range(cont_nr)]
+        started = self.server_managers[0].search_log(
+            "(All containers started|Container warm-up stopped)")
+
+        self.log_step("Restart the engines and query the containers right away")
+        self.restart_engines()
+        for container in reversed(containers):
+            container.query()
+        started = self.verify_warmup(started, targets)
+
+        self.log_step("Stop the engines while the containers are being started")
+        self.restart_engines(stop_after_start=True)
+        for container in containers:
+            container.query()
+        self.verify_warmup(started, 2 * targets)
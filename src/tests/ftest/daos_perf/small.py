@@ -24,7 +24,8 @@ class DaosPerf(DaosPerfBase):
         Use cases:
             Run daos_perf in 'daos'.  Run daos_perf using single value type
             for 'LARGE' and 'R2s' and 'EC2P1' object class. Run this config
-            with multiple server/client configuration.
+            with multiple server/client configuration. Overwrite small ranges
+            of 'EC_8P2G1' array values to exercise partial stripe aggregation.
 
         :avocado: tags=all,full_regression
         :avocado: tags=hw,medium
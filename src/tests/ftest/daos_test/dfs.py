@@ -70,3 +70,37 @@ class DaosCoreTestDfs(DaosCoreBase):
         """
         self.daos_test = os.path.join(self.bin, 'dfs_test')
         self.run_subtest()
+
+    def test_daos_dfs_batch(self):
+        """Jira ID: DAOS-7759.
+
+        Test Description:
+            Run dfs_test -b
+
+        Use cases:
+            DAOS File System batched metadata operations
+
+        :avocado: tags=all,pr,full_regression
+        :avocado: tags=hw,large
+        :avocado: tags=daos_test,dfs_test,dfs
+        :avocado: tags=DaosCoreTestDfs,test_daos_dfs_batch
+        """
+        self.daos_test = os.path.join(self.bin, 'dfs_test')
+        self.run_subtest()
+
+    def test_daos_dfs_ds3(self):
+        """Jira ID: DAOS-7759.
+
+        Test Description:
+            Run dfs_test -d
+
+        Use cases:
+            DAOS S3 multipart uploads written in place
+
+        :avocado: tags=all,pr,full_regression
+        :avocado: tags=hw,large
+        :avocado: tags=daos_test,dfs_test,dfs
+        :avocado: tags=DaosCoreTestDfs,test_daos_dfs_ds3
+        """
+        self.daos_test = os.path.join(self.bin, 'dfs_test')
+        self.run_subtest()
@@ -0,0 +1,48 @@
+'''
+  (C) Copyright 2024 Intel Corporation.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+'''
+import time
+
+from ec_utils import ErasureCodeIor
+
+
+class EcodServerRecov(ErasureCodeIor):
+    # pylint: disable=too-many-ancestors
+    """
+    Test Class Description: To validate Erasure code object degraded reads reconstructed
+                            by the parity shard engines (container ec_recov:server).
+    :avocado: recursive
+    """
+
+    def test_ec_degrade_srv_recov(self):
+        """
+
+        Test Description: Test Erasure code object degraded reads with the data
+                          reconstructed on the engines.
+        Use Case: Create the pool, disable rebuild, run IOR with supported EC object
+                  type class for small and large transfer sizes, in containers with
+                  the ec_recov property set to server. Kill a single server, verify
+                  all IOR read data.
+
+        :avocado: tags=all,full_regression
+        :avocado: tags=hw,large
+        :avocado: tags=ec,ec_array,ec_srv_recov
+        :avocado: tags=EcodServerRecov,test_ec_degrade_srv_recov
+        """
+        # Disabled pool Rebuild
+        self.pool.set_property("self_heal", "exclude")
+
+        # Write the IOR data set with given all the EC object type
+        self.ior_write_dataset()
+
+        # Kill the last server rank and wait for 20 seconds, Rebuild is disabled
+        # so data should not be rebuild
+        self.server_managers[0].stop_ranks([self.server_count - 1], self.d_log,
+                                           force=True)
+        time.sleep(20)
+
+        # Read IOR data and verify for different EC object and different sizes,
+        # the lost cells are rebuilt by the parity shard engines
+        self.ior_read_dataset()
@@ -0,0 +1,82 @@
+'''
+  (C) Copyright 2024 Intel Corporation.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+'''
+from apricot import TestWithServers
+from pydaos import DCont
+
+
+class PydaosKvBuffers(TestWithServers):
+    """
+    Test Class Description: Verify the pydaos DDict values stored from objects supporting
+                            the buffer protocol and read back into a preallocated buffer.
+    :avocado: recursive
+    """
+
+    def test_pydaos_kv_bget_into(self):
+        """
+
+        Test Description: Store values from bytes, bytearray and memoryview objects, read them
+                          back with bget_into() into a preallocated bytearray, then with a
+                          buffer too small for the values.
+        Use Case: Create a pool and a python container, store the values with bput(), read them
+                  with bget_into() waiting and not waiting for the reads, check a missing key
+                  reads as size 0, a value larger than a slot isn't read, and a buffer smaller
+                  than all the slots is rejected.
+
+        :avocado: tags=all,full_regression
+        :avocado: tags=vm
+        :avocado: tags=pydaos
+        :avocado: tags=PydaosKvBuffers,test_pydaos_kv_bget_into
+        """
+        slot_size = self.params.get("slot_size", "/run/kv/*", 4096)
+        pool = self.get_pool()
+        container = self.get_container(pool)
+        dcont = DCont(pool.identifier, container.identifier)
+        ddict = dcont.dict("kv_buffers")
+
+        values = {
+            "bytes": b"a" * 100,
+            "bytearray": bytearray(b"b" * slot_size),
+            "memoryview": memoryview(b"c" * 10),
+        }
+        ddict.bput(values)
+        ddict.bput({"large": b"d" * (slot_size + 1)})
+
+        self.log_step("Read the values into a preallocated bytearray")
+        keys = list(values)
+        buf = bytearray(len(keys) * slot_size)
+        sizes = ddict.bget_into(keys, buf, slot_size)
+        for idx, key in enumerate(keys):
+            expected = bytes(values[key])
+            self.log.info("%s: read %d bytes", key, sizes[idx])
+            if sizes[idx] != len(expected):
+                self.fail(f"{key}: read {sizes[idx]} bytes, expected {len(expected)}")
+            start = idx * slot_size
+            if bytes(buf[start:start + sizes[idx]]) != expected:
+                self.fail(f"{key}: value read into the buffer doesn't match")
+
+        self.log_step("Read without waiting, a missing key and a value larger than a slot")
+        buf = bytearray(3 * slot_size)
+        req = ddict.bget_into(["bytes", "missing", "large"], buf, slot_size, wait=False)
+        sizes = req.wait()
+        if sizes[0] != len(values["bytes"]) or bytes(buf[:sizes[0]]) != values["bytes"]:
+            self.fail("bytes: value read without waiting doesn't match")
+        if sizes[1] != 0:
+            self.fail(f"missing: expected size 0, got {sizes[1]}")
+        if sizes[2] != slot_size + 1:
+            self.fail(f"large: expected size {slot_size + 1}, got {sizes[2]}")
+        if any(buf[2 * slot_size:]):
+            self.fail("large: a value larger than the slot was read into the buffer")
+
+        self.log_step("Read into a buffer too small for the values")
+        buf = bytearray(len(keys) * slot_size - 1)
+        try:
+            ddict.bget_into(keys, buf, slot_size)
+            self.fail("bget_into() accepted a buffer too small for the values")
+        except ValueError as error:
+            self.log.info("Expected error: %s", error)
+
+        del ddict
+        del dcont
@@ -59,11 +59,18 @@ class TelemetryUtils():
         "engine_pool_block_allocator_frags_small",
         "engine_pool_block_allocator_free_blks"]
     ENGINE_POOL_CHECKPOINT_METRICS = [
+        *_gen_stats_metrics("engine_pool_checkpoint_bandwidth"),
         *_gen_stats_metrics("engine_pool_checkpoint_dirty_chunks"),
         *_gen_stats_metrics("engine_pool_checkpoint_dirty_pages"),
         *_gen_stats_metrics("engine_pool_checkpoint_duration"),
         *_gen_stats_metrics("engine_pool_checkpoint_iovs_copied"),
+        "engine_pool_checkpoint_wal_headroom",
         *_gen_stats_metrics("engine_pool_checkpoint_wal_purged")]
+    ENGINE_POOL_EC_AGG_METRICS = [
+        "engine_pool_EC_agg_partial_delta",
+        "engine_pool_EC_agg_partial_recalc",
+        "engine_pool_EC_agg_reclaimable",
+        "engine_pool_EC_agg_xferred_fetch"]
     ENGINE_POOL_EC_UPDATE_METRICS = [
         "engine_pool_EC_update_full_stripe",
         "engine_pool_EC_update_partial"]
@@ -111,11 +118,13 @@ class TelemetryUtils():
         "engine_pool_ops_pool_query_space"]
     ENGINE_POOL_SCRUBBER_METRICS = [
         "engine_pool_scrubber_busy_time",
+        "engine_pool_scrubber_bytes_per_sec",
         "engine_pool_scrubber_bytes_scrubbed_current",
         "engine_pool_scrubber_bytes_scrubbed_prev",
         "engine_pool_scrubber_bytes_scrubbed_total",
         "engine_pool_scrubber_corruption_current",
         "engine_pool_scrubber_corruption_total",
+        "engine_pool_scrubber_coverage",
         "engine_pool_scrubber_csums_current",
         "engine_pool_scrubber_csums_prev",
         "engine_pool_scrubber_csums_total",
@@ -124,6 +133,11 @@ class TelemetryUtils():
         *_gen_stats_metrics("engine_pool_scrubber_prev_duration"),
         "engine_pool_scrubber_scrubber_started",
         "engine_pool_scrubber_scrubs_completed"]
+    ENGINE_POOL_UMEM_CACHE_METRICS = [
+        "engine_pool_umem_cache_evictions",
+        "engine_pool_umem_cache_hits",
+        "engine_pool_umem_cache_mapped",
+        "engine_pool_umem_cache_misses"]
     ENGINE_POOL_VOS_AGGREGATION_METRICS = [
         "engine_pool_vos_aggregation_akey_deleted",
         "engine_pool_vos_aggregation_akey_scanned",
@@ -135,6 +149,7 @@ class TelemetryUtils():
         "engine_pool_vos_aggregation_dkey_scanned",
         "engine_pool_vos_aggregation_dkey_skipped",
         *_gen_stats_metrics("engine_pool_vos_aggregation_epr_duration"),
+        "engine_pool_vos_aggregation_merge_rate",
         "engine_pool_vos_aggregation_merged_recs",
         "engine_pool_vos_aggregation_merged_size",
         "engine_pool_vos_aggregation_obj_deleted",
@@ -144,6 +159,12 @@ class TelemetryUtils():
     ENGINE_POOL_VOS_SPACE_METRICS = [
         "engine_pool_vos_space_nvme_used",
         "engine_pool_vos_space_scm_used"]
+    ENGINE_POOL_VOS_TIER_METRICS = [
+        "engine_pool_vos_tier_demoted",
+        "engine_pool_vos_tier_hot_objs",
+        "engine_pool_vos_tier_nvme_hits",
+        "engine_pool_vos_tier_promoted",
+        "engine_pool_vos_tier_scm_hits"]
     ENGINE_POOL_VOS_WAL_METRICS = [
         *_gen_stats_metrics("engine_pool_vos_wal_wal_sz"),
         *_gen_stats_metrics("engine_pool_vos_wal_wal_qd"),
@@ -157,12 +178,15 @@ class TelemetryUtils():
     ENGINE_POOL_METRICS = ENGINE_POOL_ACTION_METRICS +\
         ENGINE_POOL_BLOCK_ALLOCATOR_METRICS +\
         ENGINE_POOL_CHECKPOINT_METRICS +\
+        ENGINE_POOL_EC_AGG_METRICS +\
         ENGINE_POOL_EC_UPDATE_METRICS +\
         ENGINE_POOL_ENTRIES_METRICS +\
         ENGINE_POOL_OPS_METRICS +\
         ENGINE_POOL_SCRUBBER_METRICS +\
+        ENGINE_POOL_UMEM_CACHE_METRICS +\
         ENGINE_POOL_VOS_AGGREGATION_METRICS +\
         ENGINE_POOL_VOS_SPACE_METRICS + \
+        ENGINE_POOL_VOS_TIER_METRICS + \
         ENGINE_POOL_VOS_WAL_METRICS + \
         ENGINE_POOL_VOS_WAL_REPLAY_METRICS
     ENGINE_EVENT_METRICS = [
@@ -178,6 +202,8 @@ class TelemetryUtils():
         "engine_sched_total_reject",
         *_gen_stats_metrics("engine_sched_cycle_duration"),
         *_gen_stats_metrics("engine_sched_cycle_size")]
+    ENGINE_REBUILD_METRICS = [
+        "engine_rebuild_min_redundancy_restore"]
     ENGINE_DMABUFF_METRICS = [
         "engine_dmabuff_total_chunks",
         "engine_dmabuff_used_chunks_io",
@@ -292,6 +318,23 @@ class TelemetryUtils():
         _gen_stats_metrics("engine_io_ops_tgt_update_active")
     ENGINE_IO_OPS_UPDATE_ACTIVE_METRICS = \
         _gen_stats_metrics("engine_io_ops_update_active")
+    ENGINE_IO_MIGRATE_METRICS = [
+        *_gen_stats_metrics("engine_io_migrate_fg_latency"),
+        "engine_io_migrate_max_inflight_size",
+        "engine_io_migrate_max_ult"]
+    ENGINE_IO_TS_METRICS = [
+        "engine_io_ts_akey_evictions",
+        "engine_io_ts_akey_neg_conflicts",
+        "engine_io_ts_akey_size",
+        "engine_io_ts_container_evictions",
+        "engine_io_ts_container_neg_conflicts",
+        "engine_io_ts_container_size",
+        "engine_io_ts_dkey_evictions",
+        "engine_io_ts_dkey_neg_conflicts",
+        "engine_io_ts_dkey_size",
+        "engine_io_ts_object_evictions",
+        "engine_io_ts_object_neg_conflicts",
+        "engine_io_ts_object_size"]
     ENGINE_IO_METRICS = ENGINE_IO_DTX_COMMITTABLE_METRICS +\
         ENGINE_IO_DTX_COMMITTED_METRICS +\
         ENGINE_IO_LATENCY_FETCH_METRICS +\
@@ -343,7 +386,9 @@ class TelemetryUtils():
         ENGINE_IO_OPS_TGT_PUNCH_ACTIVE_METRICS +\
         ENGINE_IO_OPS_TGT_PUNCH_LATENCY_METRICS +\
         ENGINE_IO_OPS_TGT_UPDATE_ACTIVE_METRICS +\
-        ENGINE_IO_OPS_UPDATE_ACTIVE_METRICS
+        ENGINE_IO_OPS_UPDATE_ACTIVE_METRICS +\
+        ENGINE_IO_MIGRATE_METRICS +\
+        ENGINE_IO_TS_METRICS
     ENGINE_NET_METRICS = [
         "engine_net_glitch",
         "engine_net_failed_addr",
@@ -446,6 +491,7 @@ class TelemetryUtils():
         all_metrics_names.extend(self.ENGINE_NET_METRICS)
         all_metrics_names.extend(self.ENGINE_RANK_METRICS)
         all_metrics_names.extend(self.ENGINE_DMABUFF_METRICS)
+        all_metrics_names.extend(self.ENGINE_REBUILD_METRICS)
         all_metrics_names.extend(self.ENGINE_MEM_USAGE_METRICS)
         all_metrics_names.extend(self.ENGINE_MEM_TOTAL_USAGE_METRICS)
         if with_pools:
@@ -1014,6 +1014,150 @@ strided_array(void **state)
 	par_barrier(PAR_COMM_WORLD);
 } /* End str_mem_str_arr_io */
 
+#define STR_CHUNKS	16
+#define STR_REC		8
+
+/*
+ * N-strided access: NUM ranges of STR_REC bytes spread round robin over STR_CHUNKS chunks,
+ * so consecutive ranges never share a dkey. Timed to compare list I/O with the per range I/O.
+ */
+static void
+n_strided_array(void **state)
+{
+	test_arg_t	*arg = *state;
+	daos_obj_id_t	oid;
+	daos_handle_t	oh;
+	daos_array_iod_t iod;
+	d_sg_list_t	sgl;
+	char		*buf;
+	char		*rbuf;
+	daos_size_t	chunk = (NUM / STR_CHUNKS + 1) * STR_REC * 2;
+	uint64_t	start;
+	daos_size_t	i;
+	int		rc;
+
+	par_barrier(PAR_COMM_WORLD);
+	oid = daos_test_oid_gen(arg->coh, OC_SX, typeb, 0, arg->myrank);
+
+	rc = daos_array_create(arg->coh, oid, DAOS_TX_NONE, 1, chunk, &oh, NULL);
+	assert_rc_equal(rc, 0);
+
+	D_ALLOC(buf, NUM * STR_REC);
+	assert_non_null(buf);
+	D_ALLOC(rbuf, NUM * STR_REC);
+	assert_non_null(rbuf);
+	dts_buf_render(buf, NUM * STR_REC);
+
+	iod.arr_nr = NUM;
+	D_ALLOC_ARRAY(iod.arr_rgs, NUM);
+	assert_non_null(iod.arr_rgs);
+	for (i = 0; i < NUM; i++) {
+		iod.arr_rgs[i].rg_idx = (i % STR_CHUNKS) * chunk + (i / STR_CHUNKS) * STR_REC * 2;
+		iod.arr_rgs[i].rg_len = STR_REC;
+	}
+
+	sgl.sg_nr = 1;
+	D_ALLOC_ARRAY(sgl.sg_iovs, 1);
+	assert_non_null(sgl.sg_iovs);
+
+	d_iov_set(&sgl.sg_iovs[0], buf, NUM * STR_REC);
+	start = daos_get_ntime();
+	rc = daos_array_write(oh, DAOS_TX_NONE, &iod, &sgl, NULL);
+	assert_rc_equal(rc, 0);
+	print_message("%d-strided write of %d ranges: "DF_U64" us\n", STR_CHUNKS, NUM,
+		      (daos_get_ntime() - start) / 1000);
+
+	d_iov_set(&sgl.sg_iovs[0], rbuf, NUM * STR_REC);
+	start = daos_get_ntime();
+	rc = daos_array_read(oh, DAOS_TX_NONE, &iod, &sgl, NULL);
+	assert_rc_equal(rc, 0);
+	print_message("%d-strided read of %d ranges: "DF_U64" us\n", STR_CHUNKS, NUM,
+		      (daos_get_ntime() - start) / 1000);
+	assert_int_equal(iod.arr_nr_short_read, 0);
+	assert_memory_equal(buf, rbuf, NUM * STR_REC);
+
+	/** the gaps between the ranges are holes */
+	iod.arr_nr = 1;
+	iod.arr_rgs[0].rg_idx = STR_REC;
+	iod.arr_rgs[0].rg_len = STR_REC;
+	memset(rbuf, 1, STR_REC);
+	d_iov_set(&sgl.sg_iovs[0], rbuf, STR_REC);
+	rc = daos_array_read(oh, DAOS_TX_NONE, &iod, &sgl, NULL);
+	assert_rc_equal(rc, 0);
+	for (i = 0; i < STR_REC; i++)
+		assert_int_equal(rbuf[i], 0);
+
+	D_FREE(buf);
+	D_FREE(rbuf);
+	D_FREE(iod.arr_rgs);
+	D_FREE(sgl.sg_iovs);
+
+	rc = daos_array_close(oh, NULL);
+	assert_rc_equal(rc, 0);
+	par_barrier(PAR_COMM_WORLD);
+}
+
+#define OVL_CHUNK	64
+
+/*
+ * List I/O with repeated and overlapping ranges, some across a chunk boundary. The data written
+ * at each index is the same in every range, so the overlapping updates agree.
+ */
+static void
+overlap_array(void **state)
+{
+	test_arg_t	*arg = *state;
+	daos_obj_id_t	oid;
+	daos_handle_t	oh;
+	daos_array_iod_t iod;
+	daos_range_t	rgs[] = {
+		{ .rg_idx = 0, .rg_len = 32 },
+		{ .rg_idx = 16, .rg_len = 32 },
+		{ .rg_idx = 16, .rg_len = 32 },
+		{ .rg_idx = 56, .rg_len = 16 },
+		{ .rg_idx = 60, .rg_len = 8 },
+		{ .rg_idx = 0, .rg_len = 8 },
+	};
+	d_sg_list_t	sgl;
+	d_iov_t		iov;
+	char		buf[256];
+	char		rbuf[256];
+	daos_size_t	len = 0;
+	daos_size_t	i;
+	daos_size_t	j;
+	int		rc;
+
+	par_barrier(PAR_COMM_WORLD);
+	oid = daos_test_oid_gen(arg->coh, OC_SX, typeb, 0, arg->myrank);
+
+	rc = daos_array_create(arg->coh, oid, DAOS_TX_NONE, 1, OVL_CHUNK, &oh, NULL);
+	assert_rc_equal(rc, 0);
+
+	for (i = 0; i < ARRAY_SIZE(rgs); i++)
+		for (j = 0; j < rgs[i].rg_len; j++)
+			buf[len++] = (char)((rgs[i].rg_idx + j) * 7 + 3);
+
+	iod.arr_nr = ARRAY_SIZE(rgs);
+	iod.arr_rgs = rgs;
+	sgl.sg_nr = 1;
+	sgl.sg_iovs = &iov;
+
+	d_iov_set(&iov, buf, len);
+	rc = daos_array_write(oh, DAOS_TX_NONE, &iod, &sgl, NULL);
+	assert_rc_equal(rc, 0);
+
+	memset(rbuf, 0, sizeof(rbuf));
+	d_iov_set(&iov, rbuf, len);
+	rc = daos_array_read(oh, DAOS_TX_NONE, &iod, &sgl, NULL);
+	assert_rc_equal(rc, 0);
+	assert_int_equal(iod.arr_nr_short_read, 0);
+	assert_memory_equal(buf, rbuf, len);
+
+	rc = daos_array_close(oh, NULL);
+	assert_rc_equal(rc, 0);
+	par_barrier(PAR_COMM_WORLD);
+}
+
 static void
 truncate_array(void **state)
 {
@@ -1235,6 +1379,10 @@ static const struct CMUnitTest array_api_tests[] = {
 	 truncate_array, async_disable, NULL},
 	{"Array 11: EC Array Key Query",
 	 ec_array_key_query, async_disable, NULL},
+	{"Array 12 API: N-strided list I/O (blocking)",
+	 n_strided_array, async_disable, NULL},
+	{"Array 13 API: Overlapping list I/O (blocking)",
+	 overlap_array, async_disable, NULL},
 };
 
 static int
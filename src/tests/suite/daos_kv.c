@@ -352,6 +352,95 @@ kv_cond_ops(void **state)
 	print_message("all good\n");
 } /* End simple_put_get */
 
+#define MULTI_KEYS	64
+#define MULTI_VAL_SIZE	128
+
+static void
+kv_multi_ops(void **state)
+{
+	test_arg_t	*arg = *state;
+	daos_obj_id_t	oid;
+	daos_handle_t	oh;
+	daos_kv_req_t	reqs[MULTI_KEYS + 1];
+	char		keys[MULTI_KEYS + 1][32];
+	char		*vals;
+	char		*vals_out;
+	daos_event_t	ev;
+	daos_event_t	*evp;
+	int		i;
+	int		rc;
+
+	D_ALLOC(vals, MULTI_KEYS * MULTI_VAL_SIZE);
+	assert_non_null(vals);
+	D_ALLOC(vals_out, MULTI_KEYS * MULTI_VAL_SIZE);
+	assert_non_null(vals_out);
+	dts_buf_render(vals, MULTI_KEYS * MULTI_VAL_SIZE);
+
+	oid = daos_test_oid_gen(arg->coh, OC_SX, type, 0, arg->myrank);
+	rc = daos_kv_open(arg->coh, oid, DAOS_OO_RW, &oh, NULL);
+	assert_rc_equal(rc, 0);
+
+	rc = daos_kv_multi_put(oh, DAOS_TX_NONE, 0, 0, reqs, NULL);
+	assert_rc_equal(rc, -DER_INVAL);
+
+	print_message("Inserting %d keys in one batch\n", MULTI_KEYS);
+	for (i = 0; i < MULTI_KEYS; i++) {
+		sprintf(keys[i], "multi_key%d", i);
+		reqs[i].kvr_key = keys[i];
+		reqs[i].kvr_size = MULTI_VAL_SIZE;
+		reqs[i].kvr_buf = vals + i * MULTI_VAL_SIZE;
+	}
+	if (arg->async) {
+		rc = daos_event_init(&ev, arg->eq, NULL);
+		assert_rc_equal(rc, 0);
+		rc = daos_kv_multi_put(oh, DAOS_TX_NONE, 0, MULTI_KEYS, reqs, &ev);
+		assert_rc_equal(rc, 0);
+		rc = daos_eq_poll(arg->eq, 1, DAOS_EQ_WAIT, 1, &evp);
+		assert_int_equal(rc, 1);
+		assert_ptr_equal(evp, &ev);
+		assert_rc_equal(ev.ev_error, 0);
+		daos_event_fini(&ev);
+	} else {
+		rc = daos_kv_multi_put(oh, DAOS_TX_NONE, 0, MULTI_KEYS, reqs, NULL);
+		assert_rc_equal(rc, 0);
+	}
+	for (i = 0; i < MULTI_KEYS; i++)
+		assert_rc_equal(reqs[i].kvr_rc, 0);
+
+	print_message("Fetching them back with a missing key and a small buffer\n");
+	for (i = 0; i < MULTI_KEYS; i++) {
+		reqs[i].kvr_size = MULTI_VAL_SIZE;
+		reqs[i].kvr_buf = vals_out + i * MULTI_VAL_SIZE;
+	}
+	reqs[0].kvr_size = MULTI_VAL_SIZE / 2;
+	strcpy(keys[MULTI_KEYS], "multi_key_none");
+	reqs[MULTI_KEYS].kvr_key = keys[MULTI_KEYS];
+	reqs[MULTI_KEYS].kvr_size = MULTI_VAL_SIZE;
+	reqs[MULTI_KEYS].kvr_buf = NULL;
+
+	rc = daos_kv_multi_get(oh, DAOS_TX_NONE, 0, MULTI_KEYS + 1, reqs, NULL);
+	assert_rc_equal(rc, -DER_REC2BIG);
+	assert_rc_equal(reqs[0].kvr_rc, -DER_REC2BIG);
+	assert_int_equal(reqs[0].kvr_size, MULTI_VAL_SIZE);
+	for (i = 1; i < MULTI_KEYS; i++) {
+		assert_rc_equal(reqs[i].kvr_rc, 0);
+		assert_int_equal(reqs[i].kvr_size, MULTI_VAL_SIZE);
+		assert_memory_equal(vals + i * MULTI_VAL_SIZE, vals_out + i * MULTI_VAL_SIZE,
+				    MULTI_VAL_SIZE);
+	}
+	assert_rc_equal(reqs[MULTI_KEYS].kvr_rc, 0);
+	assert_int_equal(reqs[MULTI_KEYS].kvr_size, 0);
+
+	rc = daos_kv_destroy(oh, DAOS_TX_NONE, NULL);
+	assert_rc_equal(rc, 0);
+	rc = daos_kv_close(oh, NULL);
+	assert_rc_equal(rc, 0);
+
+	D_FREE(vals);
+	D_FREE(vals_out);
+	print_message("all good\n");
+}
+
 static const struct CMUnitTest kv_tests[] = {
 	{"KV: Object Put/GET (blocking)",
 	 simple_put_get, async_disable, NULL},
@@ -361,6 +450,10 @@ static const struct CMUnitTest kv_tests[] = {
 	 simple_put_get, async_enable, NULL},
 	{"KV: Object Conditional Ops (blocking)",
 	 kv_cond_ops, async_disable, NULL},
+	{"KV: Multi Put/GET (blocking)",
+	 kv_multi_ops, async_disable, NULL},
+	{"KV: Multi Put/GET (non-blocking)",
+	 kv_multi_ops, async_enable, NULL},
 };
 
 int
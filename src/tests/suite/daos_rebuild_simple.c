@@ -830,7 +830,7 @@ rebuild_sx_object_no_data_sync(void **state)
 }
 
 static int
-reintegration_no_data_sync_teardown(void **state)
+reintegration_mode_teardown(void **state)
 {
 	test_arg_t	*arg = *state;
 	int		 rc;
@@ -1345,6 +1345,146 @@ rebuild_many_objects_with_failure(void **state)
 	D_FREE(oids);
 }
 
+static void
+rebuild_many_small_objects(void **state)
+{
+	test_arg_t	*arg = *state;
+	daos_obj_id_t	*oids;
+	d_rank_t	rank = 3;
+	int		obj_nr = 2000;
+	int		rc;
+	int		i;
+	int		j;
+
+	if (!test_runable(arg, 6))
+		return;
+
+	/* Small records are migrated inline with the enumeration, and several
+	 * dkeys of the same object are applied by one migration ULT.
+	 */
+	D_ALLOC_ARRAY(oids, obj_nr);
+	assert_non_null(oids);
+	for (i = 0; i < obj_nr; i++) {
+		char buffer[256];
+		daos_recx_t recx;
+		struct ioreq req;
+
+		oids[i] = daos_test_oid_gen(arg->coh, OC_RP_3G1, 0, 0, arg->myrank);
+		ioreq_init(&req, arg->coh, oids[i], DAOS_IOD_ARRAY, arg);
+		for (j = 0; j < KEY_NR; j++) {
+			char dkey[32];
+
+			sprintf(dkey, "dkey_%d", j);
+			memset(buffer, 'a' + j, sizeof(buffer));
+			recx.rx_idx = 0;
+			recx.rx_nr = sizeof(buffer);
+			insert_recxs(dkey, "a_key", 1, DAOS_TX_NONE, &recx, 1, buffer,
+				     sizeof(buffer), &req);
+		}
+		ioreq_fini(&req);
+	}
+
+	rebuild_single_pool_target(arg, rank, -1, false);
+	for (i = 0; i < obj_nr; i++) {
+		rc = daos_obj_verify(arg->coh, oids[i], DAOS_EPOCH_MAX);
+		if (rc != 0)
+			assert_rc_equal(rc, -DER_NOSYS);
+	}
+
+	reintegrate_single_pool_target(arg, rank, -1);
+	for (i = 0; i < obj_nr; i++) {
+		rc = daos_obj_verify(arg->coh, oids[i], DAOS_EPOCH_MAX);
+		if (rc != 0)
+			assert_rc_equal(rc, -DER_NOSYS);
+	}
+	D_FREE(oids);
+}
+
+/* Check on every replica that \a req has \a dkey_nr dkeys */
+static void
+rebuild_check_dkey_nr(struct ioreq *req, uint32_t dkey_nr)
+{
+	daos_key_desc_t	kds[10];
+	daos_anchor_t	anchor;
+	char		buf[256];
+	uint32_t	number;
+	int		i;
+
+	daos_fail_loc_set(DAOS_OBJ_SPECIAL_SHARD);
+	for (i = 0; i < OBJ_REPLICAS; i++) {
+		daos_fail_value_set(i);
+		number = 10;
+		memset(&anchor, 0, sizeof(anchor));
+		enumerate_dkey(DAOS_TX_NONE, &number, kds, &anchor, buf, sizeof(buf), req);
+		assert_int_equal(number, dkey_nr);
+	}
+	daos_fail_loc_set(0);
+	daos_fail_value_set(0);
+}
+
+static void
+rebuild_incremental_punch(void **state)
+{
+	test_arg_t	*arg = *state;
+	daos_obj_id_t	oids[2];
+	struct ioreq	req;
+	int		tgt = DEFAULT_FAIL_TGT;
+	int		rc;
+	int		i;
+
+	if (!test_runable(arg, 4))
+		return;
+
+	rc = daos_pool_set_prop(arg->pool.pool_uuid, "reintegration", "incremental");
+	assert_success(rc);
+
+	for (i = 0; i < 2; i++) {
+		oids[i] = daos_test_oid_gen(arg->coh, DAOS_OC_R3S_SPEC_RANK, 0, 0, arg->myrank);
+		oids[i] = dts_oid_set_rank(oids[i], ranks_to_kill[0]);
+		oids[i] = dts_oid_set_tgt(oids[i], tgt);
+		ioreq_init(&req, arg->coh, oids[i], DAOS_IOD_ARRAY, arg);
+		insert_single("d_key", "a_key", 0, "data", 1, DAOS_TX_NONE, &req);
+		insert_single("punched_d_key", "a_key", 0, "data", 1, DAOS_TX_NONE, &req);
+		ioreq_fini(&req);
+	}
+
+	rebuild_single_pool_target(arg, ranks_to_kill[0], tgt, false);
+
+	print_message("punch a dkey and an object while the target is excluded\n");
+	ioreq_init(&req, arg->coh, oids[0], DAOS_IOD_ARRAY, arg);
+	punch_dkey("punched_d_key", DAOS_TX_NONE, &req);
+	ioreq_fini(&req);
+	ioreq_init(&req, arg->coh, oids[1], DAOS_IOD_ARRAY, arg);
+	punch_obj(DAOS_TX_NONE, &req);
+	ioreq_fini(&req);
+
+	/* Let aggregation run up to now, it must not remove the punches */
+	if (arg->myrank == 0)
+		daos_debug_set_params(arg->group, -1, DMG_KEY_FAIL_LOC,
+				      DAOS_FORCE_EC_AGG | DAOS_FAIL_ALWAYS, 0, NULL);
+	print_message("sleep 10 seconds for aggregation ...\n");
+	sleep(10);
+	if (arg->myrank == 0)
+		daos_debug_set_params(arg->group, -1, DMG_KEY_FAIL_LOC, 0, 0, NULL);
+	par_barrier(PAR_COMM_WORLD);
+
+	reintegrate_single_pool_target(arg, ranks_to_kill[0], tgt);
+
+	print_message("check the punched dkey and object are gone on all replicas\n");
+	ioreq_init(&req, arg->coh, oids[0], DAOS_IOD_ARRAY, arg);
+	rebuild_check_dkey_nr(&req, 1);
+	ioreq_fini(&req);
+	ioreq_init(&req, arg->coh, oids[1], DAOS_IOD_ARRAY, arg);
+	rebuild_check_dkey_nr(&req, 0);
+	ioreq_fini(&req);
+
+	for (i = 0; i < 2; i++) {
+		rc = daos_obj_verify(arg->coh, oids[i], DAOS_EPOCH_MAX);
+		if (rc != 0)
+			assert_rc_equal(rc, -DER_NOSYS);
+	}
+}
+
 #define KB 1024
 #define MB (KB * 1024)
 #define GB (MB * 1024)
@@ -1974,7 +2114,12 @@ static const struct CMUnitTest rebuild_tests[] = {
 	 rebuild_with_dfs_inflight_punch_create, rebuild_small_sub_rf1_setup, test_teardown},
 	{"REBUILD28: rebuild sx object with reintegration mode no_data_sync",
 	 rebuild_sx_object_no_data_sync, rebuild_small_sub_rf0_setup,
-	 reintegration_no_data_sync_teardown},
+	 reintegration_mode_teardown},
+	{"REBUILD29: rebuild lot of small objects",
+	 rebuild_many_small_objects, rebuild_sub_setup, test_teardown},
+	{"REBUILD30: incremental reintegration with punches during the exclusion",
+	 rebuild_incremental_punch, rebuild_small_sub_setup,
+	 reintegration_mode_teardown},
 };
 
 int
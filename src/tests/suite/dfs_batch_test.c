@@ -0,0 +1,368 @@
+/**
+ * (C) Copyright 2024 Intel Corporation.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause-Patent
+ */
+/**
+ * This file is part of DAOS
+ * src/tests/suite/dfs_batch_test.c
+ */
+#define D_LOGFAC	DD_FAC(tests)
+
+#include "dfs_test.h"
+
+/** global DFS mount used for all tests */
+static uuid_t		co_uuid;
+static daos_handle_t	co_hdl;
+static dfs_t		*dfs_mt;
+
+#define BATCH_NR	1024
+#define BATCH_RATE_NR	(16 * BATCH_NR)
+
+static char **
+names_alloc(const char *prefix, int nr)
+{
+	char	**names;
+	int	i;
+
+	D_ALLOC_ARRAY(names, nr);
+	assert_non_null(names);
+	for (i = 0; i < nr; i++) {
+		D_ASPRINTF(names[i], "%s.%d", prefix, i);
+		assert_non_null(names[i]);
+	}
+	return names;
+}
+
+static void
+names_free(char **names, int nr)
+{
+	int	i;
+
+	for (i = 0; i < nr; i++)
+		D_FREE(names[i]);
+	D_FREE(names);
+}
+
+static void
+batch_check_rcs(int *rcs, int nr, int expected)
+{
+	int	i;
+
+	for (i = 0; i < nr; i++)
+		assert_int_equal(rcs[i], expected);
+}
+
+static void
+dfs_batch_test_basic(void **state)
+{
+	test_arg_t	*arg = *state;
+	dfs_obj_t	*dir, *obj;
+	const char	*dir_name = "batch_basic";
+	struct stat	*stbufs;
+	char		**names;
+	int		*rcs;
+	int		rc;
+
+	if (arg->myrank != 0)
+		return;
+
+	names = names_alloc("basic", BATCH_NR);
+	D_ALLOC_ARRAY(rcs, BATCH_NR);
+	assert_non_null(rcs);
+	D_ALLOC_ARRAY(stbufs, BATCH_NR);
+	assert_non_null(stbufs);
+
+	rc = dfs_mkdir(dfs_mt, NULL, dir_name, S_IWUSR | S_IRUSR | S_IXUSR, 0);
+	assert_int_equal(rc, 0);
+	rc = dfs_lookup_rel(dfs_mt, NULL, dir_name, O_RDWR, &dir, NULL, NULL);
+	assert_int_equal(rc, 0);
+
+	/** names the batch can't create */
+	rc = dfs_open(dfs_mt, dir, names[1], S_IFREG | S_IWUSR | S_IRUSR, O_RDWR | O_CREAT, 0, 0,
+		      NULL, &obj);
+	assert_int_equal(rc, 0);
+	rc = dfs_release(obj);
+	assert_int_equal(rc, 0);
+	D_FREE(names[2]);
+	D_STRNDUP_S(names[2], "bad/name");
+	assert_non_null(names[2]);
+
+	rc = dfs_create_batch(dfs_mt, dir, BATCH_NR, (const char **)names, S_IWUSR | S_IRUSR, 0, 0,
+			      rcs, NULL);
+	assert_int_equal(rc, 0);
+	assert_int_equal(rcs[0], 0);
+	assert_int_equal(rcs[1], EEXIST);
+	assert_int_equal(rcs[2], EINVAL);
+	batch_check_rcs(rcs + 3, BATCH_NR - 3, 0);
+
+	rc = dfs_stat_batch(dfs_mt, dir, BATCH_NR, (const char **)names, stbufs, rcs, NULL);
+	assert_int_equal(rc, 0);
+	assert_int_equal(rcs[2], EINVAL);
+	assert_true(S_ISREG(stbufs[0].st_mode));
+	assert_int_equal(stbufs[0].st_size, 0);
+	assert_int_equal(stbufs[0].st_uid, geteuid());
+	assert_true(S_ISREG(stbufs[BATCH_NR - 1].st_mode));
+
+	/** created files are regular files that can be opened and written */
+	rc = dfs_lookup_rel(dfs_mt, dir, names[BATCH_NR - 1], O_RDWR, &obj, NULL, NULL);
+	assert_int_equal(rc, 0);
+	rc = dfs_release(obj);
+	assert_int_equal(rc, 0);
+
+	rc = dfs_remove_batch(dfs_mt, dir, BATCH_NR, (const char **)names, rcs, NULL);
+	assert_int_equal(rc, 0);
+	assert_int_equal(rcs[2], EINVAL);
+	batch_check_rcs(rcs, 2, 0);
+	batch_check_rcs(rcs + 3, BATCH_NR - 3, 0);
+
+	rc = dfs_stat_batch(dfs_mt, dir, BATCH_NR, (const char **)names, stbufs, rcs, NULL);
+	assert_int_equal(rc, 0);
+	batch_check_rcs(rcs, 2, ENOENT);
+	batch_check_rcs(rcs + 3, BATCH_NR - 3, ENOENT);
+
+	rc = dfs_remove_batch(dfs_mt, NULL, 1, &dir_name, rcs, NULL);
+	assert_int_equal(rc, 0);
+	assert_int_equal(rcs[0], EISDIR);
+
+	rc = dfs_release(dir);
+	assert_int_equal(rc, 0);
+	rc = dfs_remove(dfs_mt, NULL, dir_name, false, NULL);
+	assert_int_equal(rc, 0);
+
+	names_free(names, BATCH_NR);
+	D_FREE(rcs);
+	D_FREE(stbufs);
+}
+
+static void
+batch_wait(test_arg_t *arg, daos_event_t *ev)
+{
+	daos_event_t	*evp;
+	int		rc;
+
+	rc = daos_eq_poll(arg->eq, 0, DAOS_EQ_WAIT, 1, &evp);
+	assert_rc_equal(rc, 1);
+	assert_ptr_equal(evp, ev);
+	assert_int_equal(evp->ev_error, 0);
+	rc = daos_event_fini(ev);
+	assert_rc_equal(rc, 0);
+}
+
+static void
+dfs_batch_test_async(void **state)
+{
+	test_arg_t	*arg = *state;
+	daos_event_t	ev;
+	struct stat	*stbufs;
+	char		**names;
+	int		*rcs;
+	int		rc;
+
+	if (arg->myrank != 0)
+		return;
+
+	names = names_alloc("async", BATCH_NR);
+	D_ALLOC_ARRAY(rcs, BATCH_NR);
+	assert_non_null(rcs);
+	D_ALLOC_ARRAY(stbufs, BATCH_NR);
+	assert_non_null(stbufs);
+
+	rc = daos_event_init(&ev, arg->eq, NULL);
+	assert_rc_equal(rc, 0);
+	rc = dfs_create_batch(dfs_mt, NULL, BATCH_NR, (const char **)names, S_IWUSR | S_IRUSR, 0,
+			      0, rcs, &ev);
+	assert_int_equal(rc, 0);
+	batch_wait(arg, &ev);
+	batch_check_rcs(rcs, BATCH_NR, 0);
+
+	rc = daos_event_init(&ev, arg->eq, NULL);
+	assert_rc_equal(rc, 0);
+	rc = dfs_stat_batch(dfs_mt, NULL, BATCH_NR, (const char **)names, stbufs, rcs, &ev);
+	assert_int_equal(rc, 0);
+	batch_wait(arg, &ev);
+	batch_check_rcs(rcs, BATCH_NR, 0);
+
+	rc = daos_event_init(&ev, arg->eq, NULL);
+	assert_rc_equal(rc, 0);
+	rc = dfs_remove_batch(dfs_mt, NULL, BATCH_NR, (const char **)names, rcs, &ev);
+	assert_int_equal(rc, 0);
+	batch_wait(arg, &ev);
+	batch_check_rcs(rcs, BATCH_NR, 0);
+
+	names_free(names, BATCH_NR);
+	D_FREE(rcs);
+	D_FREE(stbufs);
+}
+
+static void
+print_rate(const char *op, const char *how, int nr, double start)
+{
+	print_message("   File %-9s %-8s: %12.3f ops/sec\n", op, how,
+		      nr / (dts_time_now() - start));
+}
+
+/**
+ * mdtest style create / stat / remove rates of files in a single directory, one entry at a time
+ * with the synchronous API, then with the batch API.
+ */
+static void
+dfs_batch_test_rate(void **state)
+{
+	test_arg_t	*arg = *state;
+	dfs_obj_t	*dir, *obj;
+	struct stat	*stbufs;
+	char		**names;
+	int		*rcs;
+	double		start;
+	int		i;
+	int		rc;
+
+	if (arg->myrank != 0)
+		return;
+
+	names = names_alloc("file.mdtest", BATCH_RATE_NR);
+	D_ALLOC_ARRAY(rcs, BATCH_NR);
+	assert_non_null(rcs);
+	D_ALLOC_ARRAY(stbufs, BATCH_NR);
+	assert_non_null(stbufs);
+
+	rc = dfs_mkdir(dfs_mt, NULL, "batch_rate", S_IWUSR | S_IRUSR | S_IXUSR, 0);
+	assert_int_equal(rc, 0);
+	rc = dfs_lookup_rel(dfs_mt, NULL, "batch_rate", O_RDWR, &dir, NULL, NULL);
+	assert_int_equal(rc, 0);
+
+	print_message("%d files, batches of %d\n", BATCH_RATE_NR, BATCH_NR);
+
+	start = dts_time_now();
+	for (i = 0; i < BATCH_RATE_NR; i++) {
+		rc = dfs_open(dfs_mt, dir, names[i], S_IFREG | S_IWUSR | S_IRUSR,
+			      O_RDWR | O_CREAT | O_EXCL, 0, 0, NULL, &obj);
+		assert_int_equal(rc, 0);
+		rc = dfs_release(obj);
+		assert_int_equal(rc, 0);
+	}
+	print_rate("creation", "single", BATCH_RATE_NR, start);
+
+	start = dts_time_now();
+	for (i = 0; i < BATCH_RATE_NR; i++) {
+		rc = dfs_stat(dfs_mt, dir, names[i], &stbufs[0]);
+		assert_int_equal(rc, 0);
+	}
+	print_rate("stat", "single", BATCH_RATE_NR, start);
+
+	start = dts_time_now();
+	for (i = 0; i < BATCH_RATE_NR; i++) {
+		rc = dfs_remove(dfs_mt, dir, names[i], false, NULL);
+		assert_int_equal(rc, 0);
+	}
+	print_rate("removal", "single", BATCH_RATE_NR, start);
+
+	start = dts_time_now();
+	for (i = 0; i < BATCH_RATE_NR; i += BATCH_NR) {
+		rc = dfs_create_batch(dfs_mt, dir, BATCH_NR, (const char **)&names[i],
+				      S_IWUSR | S_IRUSR, 0, 0, rcs, NULL);
+		assert_int_equal(rc, 0);
+		batch_check_rcs(rcs, BATCH_NR, 0);
+	}
+	print_rate("creation", "batch", BATCH_RATE_NR, start);
+
+	start = dts_time_now();
+	for (i = 0; i < BATCH_RATE_NR; i += BATCH_NR) {
+		rc = dfs_stat_batch(dfs_mt, dir, BATCH_NR, (const char **)&names[i], stbufs, rcs,
+				    NULL);
+		assert_int_equal(rc, 0);
+		batch_check_rcs(rcs, BATCH_NR, 0);
+	}
+	print_rate("stat", "batch", BATCH_RATE_NR, start);
+
+	start = dts_time_now();
+	for (i = 0; i < BATCH_RATE_NR; i += BATCH_NR) {
+		rc = dfs_remove_batch(dfs_mt, dir, BATCH_NR, (const char **)&names[i], rcs, NULL);
+		assert_int_equal(rc, 0);
+		batch_check_rcs(rcs, BATCH_NR, 0);
+	}
+	print_rate("removal", "batch", BATCH_RATE_NR, start);
+
+	rc = dfs_release(dir);
+	assert_int_equal(rc, 0);
+	rc = dfs_remove(dfs_mt, NULL, "batch_rate", false, NULL);
+	assert_int_equal(rc, 0);
+
+	names_free(names, BATCH_RATE_NR);
+	D_FREE(rcs);
+	D_FREE(stbufs);
+}
+
+static const struct CMUnitTest dfs_batch_tests[] = {
+	{ "DFS_BATCH_TEST1: DFS batch create/stat/remove",
+	  dfs_batch_test_basic, async_disable, test_case_teardown},
+	{ "DFS_BATCH_TEST2: DFS batch with completion event",
+	  dfs_batch_test_async, async_enable, test_case_teardown},
+	{ "DFS_BATCH_TEST3: DFS batch vs single entry rates",
+	  dfs_batch_test_rate, async_disable, test_case_teardown},
+};
+
+static int
+dfs_batch_setup(void **state)
+{
+	test_arg_t		*arg;
+	int			rc = 0;
+
+	rc = test_setup(state, SETUP_POOL_CONNECT, true, DEFAULT_POOL_SIZE,
+			0, NULL);
+	if (rc != 0)
+		return rc;
+
+	arg = *state;
+
+	if (arg->myrank == 0) {
+		rc = dfs_cont_create(arg->pool.poh, &co_uuid, NULL, &co_hdl, &dfs_mt);
+		assert_int_equal(rc, 0);
+		printf("Created DFS Container "DF_UUIDF"\n", DP_UUID(co_uuid));
+	}
+
+	handle_share(&co_hdl, HANDLE_CO, arg->myrank, arg->pool.poh, 0);
+	dfs_test_share(arg->pool.poh, co_hdl, arg->myrank, &dfs_mt);
+
+	return rc;
+}
+
+static int
+dfs_batch_teardown(void **state)
+{
+	test_arg_t	*arg = *state;
+	int		rc;
+
+	rc = dfs_umount(dfs_mt);
+	assert_int_equal(rc, 0);
+	rc = daos_cont_close(co_hdl, NULL);
+	assert_rc_equal(rc, 0);
+
+	par_barrier(PAR_COMM_WORLD);
+	if (arg->myrank == 0) {
+		char str[37];
+
+		uuid_unparse(co_uuid, str);
+		rc = daos_cont_destroy(arg->pool.poh, str, 1, NULL);
+		assert_rc_equal(rc, 0);
+		print_message("Destroyed DFS Container "DF_UUIDF"\n",
+			      DP_UUID(co_uuid));
+	}
+	par_barrier(PAR_COMM_WORLD);
+
+	return test_teardown(state);
+}
+
+int
+run_dfs_batch_test(int rank, int size)
+{
+	int rc = 0;
+
+	par_barrier(PAR_COMM_WORLD);
+	rc = cmocka_run_group_tests_name("DAOS_FileSystem_DFS_Batch",
+					 dfs_batch_tests, dfs_batch_setup,
+					 dfs_batch_teardown);
+	par_barrier(PAR_COMM_WORLD);
+	return rc;
+}
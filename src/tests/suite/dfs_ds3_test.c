@@ -0,0 +1,253 @@
+/**
+ * (C) Copyright 2024 Intel Corporation.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause-Patent
+ */
+/**
+ * This file is part of DAOS
+ * src/tests/suite/dfs_ds3_test.c
+ */
+#define D_LOGFAC	DD_FAC(tests)
+
+#include <daos_s3.h>
+#include "dfs_test.h"
+
+#define DS3_TEST_BUCKET	"ds3_test_bucket"
+#define DS3_PART_SIZE	4096
+
+/** global DS3 pool and bucket handles used for all tests, on rank 0 only */
+static ds3_t		*ds3;
+static ds3_bucket_t	*ds3b;
+
+static void
+ds3_upload_start(const char *upload_id, const char *key)
+{
+	struct ds3_multipart_upload_info	info = { 0 };
+	char					encoded[] = "upload";
+	int					rc;
+
+	strncpy(info.upload_id, upload_id, sizeof(info.upload_id) - 1);
+	strncpy(info.key, key, sizeof(info.key) - 1);
+	info.encoded        = encoded;
+	info.encoded_length = sizeof(encoded);
+	rc = ds3_upload_init(&info, DS3_TEST_BUCKET, ds3);
+	assert_int_equal(rc, 0);
+}
+
+static void
+ds3_upload_write_part(const char *upload_id, uint64_t part_num, char c)
+{
+	ds3_part_t	*ds3p;
+	char		buf[DS3_PART_SIZE];
+	daos_size_t	size = sizeof(buf);
+	int		rc;
+
+	memset(buf, c, sizeof(buf));
+	rc = ds3_upload_part_open(DS3_TEST_BUCKET, upload_id, part_num, true, &ds3p, ds3b, ds3);
+	assert_int_equal(rc, 0);
+	rc = ds3_part_write(buf, 0, &size, ds3p, ds3, NULL);
+	assert_int_equal(rc, 0);
+	rc = ds3_part_close(ds3p);
+	assert_int_equal(rc, 0);
+}
+
+static void
+ds3_obj_put(const char *key, char c, daos_size_t len)
+{
+	ds3_obj_t	*ds3o;
+	char		*buf;
+	daos_size_t	size = len;
+	int		rc;
+
+	D_ALLOC(buf, len);
+	assert_non_null(buf);
+	memset(buf, c, len);
+	rc = ds3_obj_create(key, &ds3o, ds3b);
+	assert_int_equal(rc, 0);
+	rc = ds3_obj_write(buf, 0, &size, ds3b, ds3o, NULL);
+	assert_int_equal(rc, 0);
+	rc = ds3_obj_close(ds3o);
+	assert_int_equal(rc, 0);
+	D_FREE(buf);
+}
+
+/* Read the whole object \a key and check it is made of \a nr runs of \a len bytes of \a cs[i] */
+static void
+ds3_obj_check(const char *key, const char *cs, int nr, daos_size_t len)
+{
+	ds3_obj_t	*ds3o;
+	char		*buf;
+	daos_size_t	size = (nr + 1) * len;
+	int		rc;
+	int		i;
+	int		j;
+
+	D_ALLOC(buf, size);
+	assert_non_null(buf);
+	rc = ds3_obj_open(key, &ds3o, ds3b);
+	assert_int_equal(rc, 0);
+	rc = ds3_obj_read(buf, 0, &size, ds3b, ds3o, NULL);
+	assert_int_equal(rc, 0);
+	assert_int_equal(size, nr * len);
+	for (i = 0; i < nr; i++)
+		for (j = 0; j < len; j++)
+			assert_int_equal(buf[i * len + j], cs[i]);
+	rc = ds3_obj_close(ds3o);
+	assert_int_equal(rc, 0);
+	D_FREE(buf);
+}
+
+static void
+ds3_test_upload_overwrite(void **state)
+{
+	test_arg_t	*arg = *state;
+	const char	*key = "dir/upload_overwrite";
+	uint64_t	part_nums[2] = { 1, 2 };
+	daos_size_t	part_sizes[2] = { DS3_PART_SIZE, DS3_PART_SIZE };
+	int		rc;
+
+	if (arg->myrank != 0)
+		return;
+
+	ds3_upload_start("upload_overwrite", key);
+	ds3_upload_write_part("upload_overwrite", 1, 'a');
+	ds3_upload_write_part("upload_overwrite", 2, 'b');
+	rc = ds3_upload_complete("upload_overwrite", key, 2, part_nums, part_sizes, NULL, ds3b);
+	assert_int_equal(rc, 0);
+	rc = ds3_upload_remove(DS3_TEST_BUCKET, "upload_overwrite", ds3);
+	assert_int_equal(rc, 0);
+
+	print_message("Read the object completed in place\n");
+	ds3_obj_check(key, "ab", 2, DS3_PART_SIZE);
+
+	/** The part layout of the completed object must not be applied to the new data */
+	print_message("Overwrite the object and read it back\n");
+	ds3_obj_put(key, 'c', 100);
+	ds3_obj_check(key, "c", 1, 100);
+
+	rc = ds3_obj_destroy(key, ds3b);
+	assert_int_equal(rc, 0);
+}
+
+static void
+ds3_test_upload_abort(void **state)
+{
+	test_arg_t	*arg = *state;
+	const char	*key = "upload_abort";
+	ds3_part_t	*ds3p;
+	char		buf[DS3_PART_SIZE];
+	daos_size_t	size = sizeof(buf);
+	int		rc;
+
+	if (arg->myrank != 0)
+		return;
+
+	ds3_obj_put(key, 'x', 100);
+
+	ds3_upload_start("upload_abort", key);
+	ds3_upload_write_part("upload_abort", 1, 'y');
+	rc = ds3_upload_remove_data("upload_abort", ds3b);
+	assert_int_equal(rc, 0);
+	rc = ds3_upload_remove(DS3_TEST_BUCKET, "upload_abort", ds3);
+	assert_int_equal(rc, 0);
+
+	print_message("The aborted upload leaves the object as it was\n");
+	ds3_obj_check(key, "x", 1, 100);
+
+	print_message("An upload with the same id starts with no data\n");
+	ds3_upload_start("upload_abort", key);
+	rc = ds3_upload_part_open(DS3_TEST_BUCKET, "upload_abort", 1, false, &ds3p, ds3b, ds3);
+	assert_int_equal(rc, 0);
+	rc = ds3_part_read(buf, 0, &size, ds3p, ds3, NULL);
+	assert_int_equal(rc, 0);
+	assert_int_equal(size, 0);
+	rc = ds3_part_close(ds3p);
+	assert_int_equal(rc, 0);
+	rc = ds3_upload_remove_data("upload_abort", ds3b);
+	assert_int_equal(rc, 0);
+	rc = ds3_upload_remove(DS3_TEST_BUCKET, "upload_abort", ds3);
+	assert_int_equal(rc, 0);
+
+	rc = ds3_obj_destroy(key, ds3b);
+	assert_int_equal(rc, 0);
+}
+
+static const struct CMUnitTest dfs_ds3_tests[] = {
+	{ "DFS_DS3_TEST1: Overwrite an object completed in place",
+	  ds3_test_upload_overwrite, async_disable, test_case_teardown},
+	{ "DFS_DS3_TEST2: Abort an upload written in place",
+	  ds3_test_upload_abort, async_disable, test_case_teardown},
+};
+
+static int
+dfs_ds3_setup(void **state)
+{
+	test_arg_t		*arg;
+	struct ds3_bucket_info	info = { 0 };
+	char			encoded[] = "bucket";
+	char			pool[37];
+	int			rc = 0;
+
+	rc = test_setup(state, SETUP_POOL_CONNECT, true, DEFAULT_POOL_SIZE,
+			0, NULL);
+	if (rc != 0)
+		return rc;
+
+	arg = *state;
+
+	if (arg->myrank == 0) {
+		rc = ds3_init();
+		assert_int_equal(rc, 0);
+		uuid_unparse(arg->pool.pool_uuid, pool);
+		rc = ds3_connect(pool, arg->group, &ds3, NULL);
+		assert_int_equal(rc, 0);
+
+		strncpy(info.name, DS3_TEST_BUCKET, sizeof(info.name) - 1);
+		info.encoded        = encoded;
+		info.encoded_length = sizeof(encoded);
+		rc = ds3_bucket_create(DS3_TEST_BUCKET, &info, NULL, ds3, NULL);
+		assert_int_equal(rc, 0);
+		rc = ds3_bucket_open(DS3_TEST_BUCKET, &ds3b, ds3, NULL);
+		assert_int_equal(rc, 0);
+		print_message("Created DS3 bucket %s\n", DS3_TEST_BUCKET);
+	}
+	par_barrier(PAR_COMM_WORLD);
+
+	return rc;
+}
+
+static int
+dfs_ds3_teardown(void **state)
+{
+	test_arg_t	*arg = *state;
+	int		rc;
+
+	par_barrier(PAR_COMM_WORLD);
+	if (arg->myrank == 0) {
+		rc = ds3_bucket_close(ds3b, NULL);
+		assert_int_equal(rc, 0);
+		rc = ds3_bucket_destroy(DS3_TEST_BUCKET, true, ds3, NULL);
+		assert_int_equal(rc, 0);
+		rc = ds3_disconnect(ds3, NULL);
+		assert_int_equal(rc, 0);
+		rc = ds3_fini();
+		assert_int_equal(rc, 0);
+		print_message("Destroyed DS3 bucket %s\n", DS3_TEST_BUCKET);
+	}
+	par_barrier(PAR_COMM_WORLD);
+
+	return test_teardown(state);
+}
+
+int
+run_dfs_ds3_test(int rank, int size)
+{
+	int rc = 0;
+
+	par_barrier(PAR_COMM_WORLD);
+	rc = cmocka_run_group_tests_name("DAOS_FileSystem_DFS_DS3",
+					 dfs_ds3_tests, dfs_ds3_setup,
+					 dfs_ds3_teardown);
+	par_barrier(PAR_COMM_WORLD);
+	return rc;
+}
@@ -19,6 +19,8 @@
 int run_dfs_unit_test(int rank, int size);
 int run_dfs_par_test(int rank, int size);
 int run_dfs_sys_unit_test(int rank, int size);
+int run_dfs_batch_test(int rank, int size);
+int run_dfs_ds3_test(int rank, int size);
 
 static inline void
 dfs_test_share(daos_handle_t poh, daos_handle_t coh, int rank, dfs_t **dfs)
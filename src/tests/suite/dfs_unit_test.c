@@ -3114,6 +3114,175 @@ dfs_test_fix_chunk_size(void **state)
 	D_FREE(buf);
 }
 
+static void
+dfs_test_copy_range(void **state)
+{
+	test_arg_t	*arg = *state;
+	dfs_obj_t	*src, *dst;
+	daos_size_t	chunk_size = 64 * 1024;
+	daos_size_t	size = 10 * chunk_size + 123;
+	daos_size_t	copied, read_size;
+	d_sg_list_t	sgl;
+	d_iov_t		iov;
+	char		*buf, *rbuf;
+	int		rc;
+
+	if (arg->myrank != 0)
+		return;
+
+	D_ALLOC(buf, size);
+	assert_non_null(buf);
+	D_ALLOC(rbuf, size);
+	assert_non_null(rbuf);
+	dts_buf_render(buf, size);
+
+	rc = dfs_open(dfs_mt, NULL, "copy_src", S_IFREG | S_IWUSR | S_IRUSR, O_RDWR | O_CREAT,
+		      0, chunk_size, NULL, &src);
+	assert_int_equal(rc, 0);
+	rc = dfs_open(dfs_mt, NULL, "copy_dst", S_IFREG | S_IWUSR | S_IRUSR, O_RDWR | O_CREAT,
+		      0, 0, NULL, &dst);
+	assert_int_equal(rc, 0);
+
+	d_iov_set(&iov, buf, size);
+	sgl.sg_nr = 1;
+	sgl.sg_nr_out = 1;
+	sgl.sg_iovs = &iov;
+	rc = dfs_write(dfs_mt, src, &sgl, 0, NULL);
+	assert_int_equal(rc, 0);
+
+	/** whole file, more chunks than copies in flight and a partial last chunk */
+	rc = dfs_copy_range(dfs_mt, src, 0, dfs_mt, dst, 0, DFS_MAX_FSIZE, &copied);
+	assert_int_equal(rc, 0);
+	assert_int_equal(copied, size);
+
+	d_iov_set(&iov, rbuf, size);
+	rc = dfs_read(dfs_mt, dst, &sgl, 0, &read_size, NULL);
+	assert_int_equal(rc, 0);
+	assert_int_equal(read_size, size);
+	assert_memory_equal(buf, rbuf, size);
+
+	/** unaligned range, to an unaligned offset */
+	rc = dfs_copy_range(dfs_mt, src, 1000, dfs_mt, dst, 7, 3 * chunk_size, &copied);
+	assert_int_equal(rc, 0);
+	assert_int_equal(copied, 3 * chunk_size);
+
+	d_iov_set(&iov, rbuf, 3 * chunk_size);
+	rc = dfs_read(dfs_mt, dst, &sgl, 7, &read_size, NULL);
+	assert_int_equal(rc, 0);
+	assert_memory_equal(buf + 1000, rbuf, 3 * chunk_size);
+
+	/** past the end of the source */
+	rc = dfs_copy_range(dfs_mt, src, size, dfs_mt, dst, 0, chunk_size, &copied);
+	assert_int_equal(rc, 0);
+	assert_int_equal(copied, 0);
+
+	/** overlapping ranges of the same file */
+	rc = dfs_copy_range(dfs_mt, src, 0, dfs_mt, src, 10, chunk_size, &copied);
+	assert_int_equal(rc, EINVAL);
+
+	rc = dfs_release(src);
+	assert_int_equal(rc, 0);
+	rc = dfs_release(dst);
+	assert_int_equal(rc, 0);
+	rc = dfs_remove(dfs_mt, NULL, "copy_src", 0, NULL);
+	assert_int_equal(rc, 0);
+	rc = dfs_remove(dfs_mt, NULL, "copy_dst", 0, NULL);
+	assert_int_equal(rc, 0);
+	D_FREE(buf);
+	D_FREE(rbuf);
+}
+
+static void
+dfs_test_neg_cache(void **state)
+{
+	test_arg_t	*arg = *state;
+	dfs_t		*dfs;
+	dfs_obj_t	*dir, *dir2, *obj;
+	int		rc;
+
+	if (arg->myrank != 0)
+		return;
+
+	d_setenv("DFS_NEG_CACHE_TIMEOUT", "600", 1);
+	rc = dfs_mount(arg->pool.poh, co_hdl, O_RDWR, &dfs);
+	d_unsetenv("DFS_NEG_CACHE_TIMEOUT");
+	assert_int_equal(rc, 0);
+
+	rc = dfs_mkdir(dfs, NULL, "ncache_dir", S_IWUSR | S_IRUSR | S_IXUSR, 0);
+	assert_int_equal(rc, 0);
+	rc = dfs_lookup_rel(dfs, NULL, "ncache_dir", O_RDWR, &dir, NULL, NULL);
+	assert_int_equal(rc, 0);
+
+	/** cache the missing names */
+	rc = dfs_lookup_rel(dfs, dir, "file", O_RDONLY, &obj, NULL, NULL);
+	assert_int_equal(rc, ENOENT);
+	rc = dfs_lookup(dfs, "/ncache_dir/other", O_RDONLY, &obj, NULL, NULL);
+	assert_int_equal(rc, ENOENT);
+
+	/** created through this mount, visible right away */
+	rc = dfs_open(dfs, dir, "file", S_IFREG | S_IWUSR | S_IRUSR, O_RDWR | O_CREAT, 0, 0,
+		      NULL, &obj);
+	assert_int_equal(rc, 0);
+	rc = dfs_release(obj);
+	assert_int_equal(rc, 0);
+	rc = dfs_lookup_rel(dfs, dir, "file", O_RDONLY, &obj, NULL, NULL);
+	assert_int_equal(rc, 0);
+	rc = dfs_release(obj);
+	assert_int_equal(rc, 0);
+
+	/** created through another mount, hidden until the entry expires */
+	rc = dfs_lookup_rel(dfs_mt, NULL, "ncache_dir", O_RDWR, &obj, NULL, NULL);
+	assert_int_equal(rc, 0);
+	rc = dfs_mkdir(dfs_mt, obj, "other", S_IWUSR | S_IRUSR | S_IXUSR, 0);
+	assert_int_equal(rc, 0);
+	rc = dfs_release(obj);
+	assert_int_equal(rc, 0);
+	rc = dfs_lookup(dfs, "/ncache_dir/other", O_RDONLY, &obj, NULL, NULL);
+	assert_int_equal(rc, ENOENT);
+
+	/** the cache is per mount */
+	rc = dfs_lookup(dfs_mt, "/ncache_dir/other", O_RDONLY, &obj, NULL, NULL);
+	assert_int_equal(rc, 0);
+	rc = dfs_release(obj);
+	assert_int_equal(rc, 0);
+
+	/** exchanged in through this mount, visible right away in both parents */
+	rc = dfs_mkdir(dfs, NULL, "ncache_dir2", S_IWUSR | S_IRUSR | S_IXUSR, 0);
+	assert_int_equal(rc, 0);
+	rc = dfs_lookup_rel(dfs, NULL, "ncache_dir2", O_RDWR, &dir2, NULL, NULL);
+	assert_int_equal(rc, 0);
+	rc = dfs_open(dfs, dir2, "xchg", S_IFREG | S_IWUSR | S_IRUSR, O_RDWR | O_CREAT, 0, 0,
+		      NULL, &obj);
+	assert_int_equal(rc, 0);
+	rc = dfs_release(obj);
+	assert_int_equal(rc, 0);
+	rc = dfs_lookup_rel(dfs, dir, "xchg", O_RDONLY, &obj, NULL, NULL);
+	assert_int_equal(rc, ENOENT);
+	rc = dfs_lookup_rel(dfs, dir2, "file", O_RDONLY, &obj, NULL, NULL);
+	assert_int_equal(rc, ENOENT);
+	rc = dfs_exchange(dfs, dir2, "xchg", dir, "file");
+	assert_int_equal(rc, 0);
+	rc = dfs_lookup_rel(dfs, dir, "xchg", O_RDONLY, &obj, NULL, NULL);
+	assert_int_equal(rc, 0);
+	rc = dfs_release(obj);
+	assert_int_equal(rc, 0);
+	rc = dfs_lookup_rel(dfs, dir2, "file", O_RDONLY, &obj, NULL, NULL);
+	assert_int_equal(rc, 0);
+	rc = dfs_release(obj);
+	assert_int_equal(rc, 0);
+	rc = dfs_release(dir2);
+	assert_int_equal(rc, 0);
+	rc = dfs_remove(dfs, NULL, "ncache_dir2", true, NULL);
+	assert_int_equal(rc, 0);
+
+	rc = dfs_release(dir);
+	assert_int_equal(rc, 0);
+	rc = dfs_remove(dfs, NULL, "ncache_dir", true, NULL);
+	assert_int_equal(rc, 0);
+	rc = dfs_umount(dfs);
+	assert_int_equal(rc, 0);
+}
+
 static void
 dfs_test_oflags(void **state)
 {
@@ -3366,6 +3535,10 @@ static const struct CMUnitTest dfs_unit_tests[] = {
 	  dfs_test_pipeline_find, async_disable, test_case_teardown},
 	{ "DFS_UNIT_TEST28: dfs open/lookup flags",
 	  dfs_test_oflags, async_disable, test_case_teardown},
+	{ "DFS_UNIT_TEST29: dfs copy range",
+	  dfs_test_copy_range, async_disable, test_case_teardown},
+	{ "DFS_UNIT_TEST30: dfs negative entry cache",
+	  dfs_test_neg_cache, async_disable, test_case_teardown},
 };
 
 static int
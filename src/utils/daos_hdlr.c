@@ -14,7 +14,7 @@
 #define ENUM_DESC_NR		5 /* number of keys/records returned by enum */
 #define ENUM_DESC_BUF		512 /* all keys/records returned by enum */
 #define LIBSERIALIZE		"libdaos_serialize.so"
-#define NUM_SERIALIZE_PROPS	19
+#define NUM_SERIALIZE_PROPS	20
 
 #include <stdio.h>
 #include <dirent.h>
@@ -578,6 +578,26 @@ fs_copy_file(struct cmd_args_s *ap, struct file_dfs *src_file_dfs, struct file_d
 	if (rc != 0)
 		D_GOTO(out_src_file, rc = daos_errno2der(rc));
 
+	/* DAOS to DAOS, let libdfs keep several chunks in flight, still through this client */
+	if (src_file_dfs->type == DAOS && dst_file_dfs->type == DAOS) {
+		dfs_t		*src_dfs;
+		dfs_t		*dst_dfs;
+		daos_size_t	copied;
+
+		rc = dfs_sys_get_dfs(src_file_dfs->dfs_sys, &src_dfs);
+		if (rc == 0)
+			rc = dfs_sys_get_dfs(dst_file_dfs->dfs_sys, &dst_dfs);
+		if (rc == 0)
+			rc = dfs_copy_range(src_dfs, src_file_dfs->obj, 0, dst_dfs,
+					    dst_file_dfs->obj, 0, file_length, &copied);
+		if (rc != 0) {
+			rc = daos_errno2der(rc);
+			DH_PERROR_DER(ap, rc, "File copy failed");
+			D_GOTO(out_dst_file, rc);
+		}
+		goto set_perms;
+	}
+
 	/* Allocate read/write buffer */
 	D_ALLOC(buf, buf_size);
 	if (buf == NULL)
@@ -607,6 +627,7 @@ fs_copy_file(struct cmd_args_s *ap, struct file_dfs *src_file_dfs, struct file_d
 		total_bytes += left_to_read;
 	}
 
+set_perms:
 	/* set perms on destination to original source perms */
 	rc = file_chmod(ap, dst_file_dfs, dst_path, src_stat->st_mode, ignore_unsup,
 			num_chmod_enotsup);
@@ -1175,6 +1196,7 @@ dm_cont_get_all_props(struct cmd_args_s *ap, daos_handle_t coh, daos_prop_t **_p
 	props->dpp_entries[16].dpe_type = DAOS_PROP_CO_RP_PDA;
 	props->dpp_entries[17].dpe_type = DAOS_PROP_CO_SCRUBBER_DISABLED;
 	props->dpp_entries[18].dpe_type = DAOS_PROP_CO_PERF_DOMAIN;
+	props->dpp_entries[19].dpe_type = DAOS_PROP_CO_EC_RECOV;
 
 	/* Conditionally get the OID. Should always be true for serialization. */
 	if (get_oid) {
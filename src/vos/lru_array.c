@@ -361,6 +361,85 @@ lrua_array_free(struct lru_array *array)
 	D_FREE(array);
 }
 
+int
+lrua_array_resize(struct lru_array *array, uint32_t nr_ent)
+{
+	struct lru_sub		*sub = &array->la_sub[0];
+	struct lru_entry	*old_table = sub->ls_table;
+	struct lru_entry	*entry;
+	char			*payload;
+	size_t			 rec_size;
+	uint32_t		 old_nr = array->la_count;
+	uint32_t		 lru = sub->ls_lru;
+	uint32_t		 idx;
+
+	D_ASSERT(array->la_array_nr == 1);
+	D_ASSERT((array->la_flags & LRU_FLAG_EVICT_MANUAL) == 0);
+	D_ASSERT(nr_ent > 2 && (nr_ent & (nr_ent - 1)) == 0);
+
+	if (nr_ent == old_nr)
+		return 0;
+
+	rec_size = sizeof(*entry) + array->la_payload_size;
+	D_ALLOC(sub->ls_table, rec_size * nr_ent);
+	if (sub->ls_table == NULL) {
+		sub->ls_table = old_table;
+		return -DER_NOMEM;
+	}
+	alloc_cb(array, rec_size * nr_ent);
+
+	/** Evict the entries which don't fit, before anything moves */
+	for (idx = nr_ent; idx < old_nr; idx++) {
+		entry = &old_table[idx];
+		if (entry->le_key == 0)
+			continue;
+		evict_cb(array, sub, entry, idx);
+		entry->le_key = 0;
+	}
+
+	payload = sub->ls_payload = &sub->ls_table[nr_ent];
+	for (idx = 0; idx < nr_ent; idx++) {
+		entry = &sub->ls_table[idx];
+		entry->le_payload = payload;
+		if (idx < old_nr) {
+			entry->le_key = old_table[idx].le_key;
+			memcpy(payload, old_table[idx].le_payload, array->la_payload_size);
+		}
+		payload += array->la_payload_size;
+	}
+
+	array->la_count = nr_ent;
+	array->la_idx_mask = nr_ent - 1;
+	array->la_array_shift = 1;
+	while ((1 << array->la_array_shift) < array->la_idx_mask)
+		array->la_array_shift++;
+
+	for (idx = old_nr; idx < nr_ent; idx++)
+		init_cb(array, sub, &sub->ls_table[idx], idx);
+
+	/** Rebuild the LRU in the same order, from the least recently used */
+	sub->ls_lru = LRU_NO_IDX;
+	if (lru != LRU_NO_IDX) {
+		idx = lru;
+		do {
+			if (idx < nr_ent && old_table[idx].le_key != 0)
+				lrua_insert(sub, &sub->ls_lru, &sub->ls_table[idx], idx, true);
+			idx = old_table[idx].le_next_idx;
+		} while (idx != lru);
+	}
+
+	sub->ls_free = LRU_NO_IDX;
+	for (idx = 0; idx < nr_ent; idx++) {
+		if (sub->ls_table[idx].le_key == 0)
+			lrua_insert(sub, &sub->ls_free, &sub->ls_table[idx], idx, true);
+	}
+
+	D_FREE(old_table);
+	free_cb(array, rec_size * old_nr);
+
+	return 0;
+}
+
 void
 lrua_array_aggregate(struct lru_array *array)
 {
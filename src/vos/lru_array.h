@@ -499,6 +499,26 @@ lrua_array_free(struct lru_array *array);
 void
 lrua_array_aggregate(struct lru_array *array);
 
+/** Resize an LRU array with automatic eviction.  The entries with an index beyond the new size
+ *  are evicted, the others keep their index and their place in the LRU.  Payload addresses
+ *  change so no pointer to an entry may be held across the call.
+ *
+ * \param	array[in]	The LRU array, must have a single sub array
+ * \param	nr_ent[in]	New number of records, a power of two
+ *
+ * \return	-DER_NOMEM	Not enough memory available, the array is unchanged
+ *		0		Success
+ */
+int
+lrua_array_resize(struct lru_array *array, uint32_t nr_ent);
+
+/** Returns true if the next allocation in an array with automatic eviction evicts the LRU */
+static inline bool
+lrua_array_full(struct lru_array *array)
+{
+	return array->la_sub[0].ls_free == LRU_NO_IDX;
+}
+
 static inline void
 lrua_refresh_key(struct lru_entry *entry, uint64_t key)
 {
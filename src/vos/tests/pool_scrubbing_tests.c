@@ -15,6 +15,7 @@
 #include <daos_srv/vos_types.h>
 #include <daos_srv/vos.h>
 #include <fcntl.h>
+#include <unistd.h>
 #include <daos/tests_lib.h>
 
 /*
@@ -959,6 +960,103 @@ scrubber_doesnot_get_stuck_in_lazy_mode(void **state)
 		fail();
 }
 
+static int is_idle_call_count;
+static bool
+counting_is_idle()
+{
+	is_idle_call_count++;
+	return true;
+}
+
+static void
+small_values_are_verified_in_batches(void **state)
+{
+	struct sts_context	*ctx = *state;
+	char			 akey[16];
+	int			 i;
+
+	/* many small values, all together still well under one scrub batch */
+	for (i = 0; i < 32; i++) {
+		sprintf(akey, "akey%d", i);
+		sts_ctx_update(ctx, 1, TEST_IOD_ARRAY_1, "dkey", akey, 1, i == 31);
+	}
+
+	ctx->tsc_pool.sp_scrub_mode = DAOS_SCRUB_MODE_LAZY;
+	ctx->tsc_is_idle_fn = counting_is_idle;
+	is_idle_call_count = 0;
+	sts_ctx_do_scrub(ctx);
+
+	/* load isn't sampled per value, only when starting and at batch boundaries */
+	assert_true(is_idle_call_count < 32);
+	assert_success(sts_ctx_fetch(ctx, 1, TEST_IOD_ARRAY_1, "dkey", "akey0", 1));
+	assert_csum_error(sts_ctx_fetch(ctx, 1, TEST_IOD_ARRAY_1, "dkey", "akey31", 1));
+}
+
+/* mirror the scrubber's pacing, the smallest batch and the first back off when busy */
+#define RATE_BATCH_MIN		(64 << 10)
+#define RATE_BUSY_SLEEP_MS	10
+
+static bool	rate_idle_once;
+static uint64_t	rate_slept_ms;
+
+/* busy, except right after the scrubber backed off */
+static bool
+rate_is_idle()
+{
+	bool idle = rate_idle_once;
+
+	rate_idle_once = false;
+	return idle;
+}
+
+static int
+rate_sleep(void *arg, uint32_t msec)
+{
+	usleep(msec * 1000);
+	rate_slept_ms += msec;
+	rate_idle_once = true;
+	return 0;
+}
+
+static void
+scrub_rate_is_limited_when_busy(void **state)
+{
+	struct sts_context	*ctx = *state;
+	struct timespec		 start;
+	struct timespec		 end;
+	uint64_t		 bytes;
+	uint64_t		 ms;
+	char			 akey[16];
+	int			 i;
+
+	/* 1MiB in total, several batches */
+	ctx->tsc_data_len = 16 << 10;
+	for (i = 0; i < 64; i++) {
+		sprintf(akey, "akey%d", i);
+		sts_ctx_update(ctx, 1, TEST_IOD_ARRAY_1, "dkey", akey, 1, false);
+	}
+
+	ctx->tsc_pool.sp_scrub_mode = DAOS_SCRUB_MODE_LAZY;
+	ctx->tsc_is_idle_fn = rate_is_idle;
+	ctx->tsc_sleep_fn = rate_sleep;
+	rate_idle_once = true; /* idle to start scrubbing */
+	rate_slept_ms = 0;
+
+	d_gettime(&start);
+	sts_ctx_do_scrub(ctx);
+	d_gettime(&end);
+
+	bytes = ctx->tsc_scrub_ctx.sc_bytes_scrubbed;
+	ms = d_timediff_ns(&start, &end) / NSEC_PER_MSEC;
+	assert_int_equal(64 * ctx->tsc_data_len, bytes);
+	assert_true(rate_slept_ms > 0);
+	assert_true(ms > 0);
+
+	/* at most a batch (plus the value that closed it) between two back offs */
+	assert_true(bytes * 1000 / ms <=
+		    (RATE_BATCH_MIN + ctx->tsc_data_len) * 1000 / RATE_BUSY_SLEEP_MS);
+}
+
 static int
 sts_setup(void **state)
 {
@@ -1035,6 +1133,10 @@ static const struct CMUnitTest scrubbing_tests[] = {
 	   drain_target),
 	TS("CSUM_SCRUBBING_14: Scrubber doesn't get stuck in lazy mode when system is busy and "
 	   "mode is changed to TIMED", scrubber_doesnot_get_stuck_in_lazy_mode),
+	TS("CSUM_SCRUBBING_15: Small values are verified in batches, pacing is per batch",
+	   small_values_are_verified_in_batches),
+	TS("CSUM_SCRUBBING_16: Measured scrub rate is limited while the target is busy",
+	   scrub_rate_is_limited_when_busy),
 };
 
 int
@@ -228,6 +228,8 @@ struct agg_tst_dataset {
 	int				 td_expected_recs;
 	bool				 td_discard;
 	bool				 td_delete;
+	/* Aggregate by vos_aggregate_part() over this many partitions */
+	unsigned int			 td_agg_parts;
 };
 
 #define PARITY_BIT (1ULL << 63)
@@ -504,6 +506,32 @@ multi_view(struct io_test_args *arg, daos_unit_oid_t oids[],
 	}
 }
 
+/* Aggregate the partitions one after another, the engine runs them concurrently */
+static int
+aggregate_parts(daos_handle_t coh, daos_epoch_range_t *epr, unsigned int part_nr)
+{
+	bool		incomplete = false;
+	bool		part_incomplete;
+	unsigned int	part;
+	int		rc;
+
+	rc = vos_aggregate_enter(coh, epr);
+	if (rc)
+		return rc;
+
+	for (part = 0; part <= part_nr && rc == 0 && !incomplete; part++) {
+		rc = vos_aggregate_part(coh, epr, part, part_nr, NULL, NULL, 0,
+					&part_incomplete);
+		incomplete |= part_incomplete;
+	}
+
+	if (rc == 0 && !incomplete)
+		vos_aggregate_hae_update(coh, epr);
+	vos_aggregate_exit(coh);
+
+	return rc;
+}
+
 #define AT_SV_IOD_SIZE_SMALL	32			/* SCM record */
 #define AT_SV_IOD_SIZE_LARGE	(VOS_BLK_SZ + 500)	/* NVMe record */
 #define AT_OBJ_KEY_NR		3
@@ -625,6 +653,8 @@ aggregate_multi(struct io_test_args *arg, struct agg_tst_dataset *ds_sample, boo
 
 	if (ds_sample->td_discard)
 		rc = vos_discard(arg->ctx.tc_co_hdl, NULL /* objp */, epr_a, NULL, NULL);
+	else if (ds_sample->td_agg_parts != 0)
+		rc = aggregate_parts(arg->ctx.tc_co_hdl, epr_a, ds_sample->td_agg_parts);
 	else
 		rc = vos_aggregate(arg->ctx.tc_co_hdl, epr_a, NULL, NULL, 0);
 	assert_rc_equal(rc, 0);
@@ -1942,6 +1972,175 @@ aggregate_37(void **state)
 	cleanup();
 }
 
+/*
+ * Aggregate SV on multiple objects, keys, by partitions.
+ */
+static void
+aggregate_38(void **state)
+{
+	struct io_test_args	*arg = *state;
+	struct agg_tst_dataset	 ds = { 0 };
+
+	ds.td_type = DAOS_IOD_SINGLE;
+	ds.td_iod_size = 0;	/* random iod_size */
+	ds.td_recx_nr = 0;
+	ds.td_expected_recs = 1;
+	ds.td_upd_epr.epr_lo = 1;
+	ds.td_upd_epr.epr_hi = 1000;
+	ds.td_agg_epr.epr_lo = 850;
+	ds.td_agg_epr.epr_hi = 999;
+	ds.td_discard = false;
+	ds.td_agg_parts = 3;
+
+	aggregate_multi(arg, &ds, false);
+	cleanup();
+}
+
+/*
+ * Aggregate EV on multiple objects, keys, by partitions.
+ */
+static void
+aggregate_39(void **state)
+{
+	struct io_test_args	*arg = *state;
+	struct agg_tst_dataset	 ds = { 0 };
+	daos_recx_t		 recx_tot;
+
+	recx_tot.rx_idx = 0;
+	recx_tot.rx_nr = 20;
+
+	ds.td_type = DAOS_IOD_ARRAY;
+	ds.td_iod_size = 1024;
+	ds.td_expected_recs = -1;
+	ds.td_recx_nr = 1;
+	ds.td_recx = &recx_tot;
+	ds.td_upd_epr.epr_lo = 1;
+	ds.td_upd_epr.epr_hi = 1000;
+	ds.td_agg_epr.epr_lo = 750;
+	ds.td_agg_epr.epr_hi = 1000;
+	ds.td_discard = false;
+	ds.td_agg_parts = 3;
+
+	aggregate_multi(arg, &ds, false);
+	cleanup();
+}
+
+static int
+tier_media_cb(daos_handle_t ih, vos_iter_entry_t *entry, vos_iter_type_t type,
+	      vos_iter_param_t *param, void *cb_arg, unsigned int *acts)
+{
+	uint16_t	*media = cb_arg;
+
+	if (type == VOS_ITER_RECX && !bio_addr_is_hole(&entry->ie_biov.bi_addr))
+		*media = entry->ie_biov.bi_addr.ba_type;
+
+	return 0;
+}
+
+/* Media of the (single) extent under the akey */
+static uint16_t
+tier_media(struct io_test_args *arg, daos_unit_oid_t oid, char *dkey, char *akey)
+{
+	vos_iter_param_t	param = { 0 };
+	struct vos_iter_anchors	anchors = { 0 };
+	uint16_t		media = DAOS_MEDIA_MAX;
+	int			rc;
+
+	param.ip_hdl = arg->ctx.tc_co_hdl;
+	param.ip_ih = DAOS_HDL_INVAL;
+	param.ip_oid = oid;
+	d_iov_set(&param.ip_dkey, dkey, strlen(dkey));
+	d_iov_set(&param.ip_akey, akey, strlen(akey));
+	param.ip_epr.epr_hi = DAOS_EPOCH_MAX;
+	param.ip_epc_expr = VOS_IT_EPC_RE;
+
+	rc = vos_iterate(&param, VOS_ITER_RECX, false, &anchors, tier_media_cb, NULL, &media,
+			 NULL);
+	assert_rc_equal(rc, 0);
+
+	return media;
+}
+
+#define AT_TIER_REC_SZ	(8 * VOS_BLK_SZ)
+
+/*
+ * An extent above the data threshold is moved to SCM by aggregation once the object is hot,
+ * though it wasn't written since the previous aggregation, and back to NVMe once it cooled.
+ * Such an extent written while the object is hot goes to SCM straight away.
+ */
+static void
+aggregate_40(void **state)
+{
+	struct io_test_args	*arg = *state;
+	struct vos_container	*cont = vos_hdl2cont(arg->ctx.tc_co_hdl);
+	struct vos_pool		*pool = cont->vc_pool;
+	daos_size_t		 budget = pool->vp_tier_budget;
+	daos_epoch_range_t	 epr = { 0 };
+	daos_unit_oid_t		 oid;
+	daos_recx_t		 recx = { 0, AT_TIER_REC_SZ };
+	char			 dkey[] = "tier_dkey";
+	char			 akey[] = "tier_akey";
+	char			 akey_hot[] = "tier_akey_hot";
+	char			*buf, *buf_u;
+	int			 i, rc;
+
+	/* NVMe isn't enabled */
+	if (pool->vp_vea_info == NULL) {
+		print_message("NVMe isn't enabled, skip test\n");
+		skip();
+	}
+
+	D_ALLOC(buf, AT_TIER_REC_SZ);
+	D_ALLOC(buf_u, AT_TIER_REC_SZ);
+	assert_non_null(buf);
+	assert_non_null(buf_u);
+
+	pool->vp_tier_budget = pool->vp_pool_df->pd_scm_sz;
+	pool->vp_tier_room_ts = 0;
+	oid = dts_unit_oid_gen(0, 0);
+
+	update_value(arg, oid, 1, 0, dkey, akey, DAOS_IOD_ARRAY, 1, &recx, buf_u);
+	assert_int_equal(tier_media(arg, oid, dkey, akey), DAOS_MEDIA_NVME);
+
+	/* Cold, a single record stays where it is */
+	epr.epr_hi = 2;
+	rc = vos_aggregate(arg->ctx.tc_co_hdl, &epr, NULL, NULL, 0);
+	assert_rc_equal(rc, 0);
+	assert_int_equal(tier_media(arg, oid, dkey, akey), DAOS_MEDIA_NVME);
+
+	for (i = 0; i < 128; i++)
+		fetch_value(arg, oid, 2, 0, dkey, akey, DAOS_IOD_ARRAY, 1, &recx, buf);
+	assert_true(vos_tier_hot(cont, oid));
+
+	update_value(arg, oid, 3, 0, dkey, akey_hot, DAOS_IOD_ARRAY, 1, &recx, buf_u);
+	assert_int_equal(tier_media(arg, oid, dkey, akey_hot), DAOS_MEDIA_SCM);
+
+	epr.epr_hi = 3;
+	rc = vos_aggregate(arg->ctx.tc_co_hdl, &epr, NULL, NULL, 0);
+	assert_rc_equal(rc, 0);
+	assert_int_equal(tier_media(arg, oid, dkey, akey), DAOS_MEDIA_SCM);
+	fetch_value(arg, oid, 3, 0, dkey, akey, DAOS_IOD_ARRAY, 1, &recx, buf);
+	assert_memory_equal(buf, buf_u, AT_TIER_REC_SZ);
+
+	/* Cool the object down, as it would be after a while without access */
+	for (i = 0; i < cont->vc_tier_nr; i++)
+		cont->vc_tier_objs[i].vto_heat = 0;
+	assert_false(vos_tier_hot(cont, oid));
+
+	epr.epr_hi = 4;
+	rc = vos_aggregate(arg->ctx.tc_co_hdl, &epr, NULL, NULL, 0);
+	assert_rc_equal(rc, 0);
+	assert_int_equal(tier_media(arg, oid, dkey, akey), DAOS_MEDIA_NVME);
+	assert_int_equal(tier_media(arg, oid, dkey, akey_hot), DAOS_MEDIA_NVME);
+	fetch_value(arg, oid, 4, 0, dkey, akey, DAOS_IOD_ARRAY, 1, &recx, buf);
+	assert_memory_equal(buf, buf_u, AT_TIER_REC_SZ);
+
+	pool->vp_tier_budget = budget;
+	D_FREE(buf);
+	D_FREE(buf_u);
+	cleanup();
+}
+
 static void
 print_space_info(vos_pool_info_t *pi, char *desc)
 {
@@ -3060,6 +3259,11 @@ static const struct CMUnitTest aggregate_tests[] = {
     {"VOS435: Test aggregation timestamp functions", aggregate_35, NULL, NULL},
     {"VOS436: Aggregate SV, multiple objects, flat dkeys", aggregate_36, NULL, agg_tst_teardown},
     {"VOS437: Aggregate EV, multiple objects, flat dkeys", aggregate_37, NULL, agg_tst_teardown},
+    {"VOS438: Aggregate SV, multiple objects, by partitions", aggregate_38, NULL,
+     agg_tst_teardown},
+    {"VOS439: Aggregate EV, multiple objects, by partitions", aggregate_39, NULL,
+     agg_tst_teardown},
+    {"VOS440: Promote hot and demote cold extents", aggregate_40, NULL, agg_tst_teardown},
 };
 
 int
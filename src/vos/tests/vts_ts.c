@@ -663,6 +663,77 @@ lru_array_multi_test(void **state)
 	lru_array_multi_test_iter(state);
 }
 
+static void
+lru_array_resize_check(struct lru_arg *ts_arg, int nr, uint32_t size)
+{
+	struct lru_record	*entry;
+	bool			 found;
+	int			 i;
+
+	for (i = 0; i < nr; i++) {
+		found = lrua_lookup(ts_arg->array, &ts_arg->indexes[i].idx, &entry);
+		if (ts_arg->indexes[i].idx < size) {
+			assert_true(found);
+			assert_true(entry->magic1 == MAGIC1);
+			assert_true(entry->magic2 == MAGIC2);
+			assert_true(entry->idx == ts_arg->indexes[i].idx);
+			assert_true(entry->record == &ts_arg->indexes[i]);
+			assert_true(ts_arg->indexes[i].value == i);
+		} else {
+			assert_false(found);
+			assert_true(ts_arg->indexes[i].value == MAGIC1);
+		}
+	}
+}
+
+static void
+lru_array_resize_test(void **state)
+{
+	struct lru_arg		*ts_arg = *state;
+	struct lru_record	*entry;
+	int			 i;
+	int			 rc;
+
+	for (i = 0; i < LRU_ARRAY_SIZE; i++) {
+		rc = lrua_alloc(ts_arg->array, &ts_arg->indexes[i].idx, &entry);
+		assert_rc_equal(rc, 0);
+		entry->record = &ts_arg->indexes[i];
+		ts_arg->indexes[i].value = i;
+	}
+	assert_true(lrua_array_full(ts_arg->array));
+
+	/** Growing keeps every entry at its index */
+	rc = lrua_array_resize(ts_arg->array, LRU_ARRAY_SIZE * 2);
+	assert_rc_equal(rc, 0);
+	assert_false(lrua_array_full(ts_arg->array));
+	lru_array_resize_check(ts_arg, LRU_ARRAY_SIZE, LRU_ARRAY_SIZE * 2);
+
+	/** The new entries are used before anything is evicted */
+	for (i = LRU_ARRAY_SIZE; i < LRU_ARRAY_SIZE * 2; i++) {
+		rc = lrua_alloc(ts_arg->array, &ts_arg->indexes[i].idx, &entry);
+		assert_rc_equal(rc, 0);
+		assert_true(ts_arg->indexes[i].idx >= LRU_ARRAY_SIZE);
+		entry->record = &ts_arg->indexes[i];
+		ts_arg->indexes[i].value = i;
+	}
+	assert_true(lrua_array_full(ts_arg->array));
+	lru_array_resize_check(ts_arg, LRU_ARRAY_SIZE * 2, LRU_ARRAY_SIZE * 2);
+
+	/** Shrinking evicts the entries beyond the new size only */
+	rc = lrua_array_resize(ts_arg->array, LRU_ARRAY_SIZE / 2);
+	assert_rc_equal(rc, 0);
+	assert_true(lrua_array_full(ts_arg->array));
+	lru_array_resize_check(ts_arg, LRU_ARRAY_SIZE * 2, LRU_ARRAY_SIZE / 2);
+
+	/** The LRU order is kept, the first entry looked up is the first to go */
+	for (i = 0; ts_arg->indexes[i].idx >= LRU_ARRAY_SIZE / 2; i++)
+		;
+	rc = lrua_alloc(ts_arg->array, &ts_arg->indexes[NUM_INDEXES - 1].idx, &entry);
+	assert_rc_equal(rc, 0);
+	entry->record = &ts_arg->indexes[NUM_INDEXES - 1];
+	assert_true(ts_arg->indexes[i].value == MAGIC1);
+}
+
 static int
 init_lru_test(void **state)
 {
@@ -775,6 +846,8 @@ static const struct CMUnitTest ts_tests[] = {
 		init_lru_multi_test, finalize_lru_test},
 	{ "VOS600.4: VOS timestamp allocation test", ilog_test_ts_get,
 		ts_test_init, ts_test_fini},
+	{ "VOS600.5: LRU array resize", lru_array_resize_test, init_lru_test,
+		finalize_lru_test},
 };
 
 int
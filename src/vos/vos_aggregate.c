@@ -161,8 +161,15 @@ struct vos_agg_param {
 	/* Boundary for aggregatable write filter */
 	daos_epoch_t		ap_filter_epoch;
 	uint32_t		ap_flags;
+	/*
+	 * Partitioned aggregation, see vos_aggregate_part(). Zero ap_part_nr for the
+	 * whole container, ap_part == ap_part_nr for the final pass over objects.
+	 */
+	uint32_t		ap_part;
+	uint32_t		ap_part_nr;
 	unsigned int ap_discard : 1, ap_csum_err : 1, ap_nospc_err : 1, ap_in_progress : 1,
-	    ap_discard_obj : 1;
+	    ap_discard_obj : 1,
+	    ap_tier : 1; /* current object is tracked for data placement, see vos_tier.c */
 	struct umem_instance	*ap_umm;
 	int			(*ap_yield_func)(void *arg);
 	void			*ap_yield_arg;
@@ -301,6 +308,10 @@ need_aggregate(daos_handle_t ih, struct vos_agg_param *agg_param, vos_iter_desc_
 	if (agg_param->ap_discard_obj || agg_param->ap_discard)
 		return true;
 
+	/** Data of hot objects, or of objects which cooled down, may have to move */
+	if (agg_param->ap_tier)
+		return true;
+
 	if (desc->id_agg_write <= agg_param->ap_filter_epoch &&
 	    desc->id_parent_punch <= agg_param->ap_filter_epoch)
 		agg_needed = false;
@@ -311,6 +322,42 @@ need_aggregate(daos_handle_t ih, struct vos_agg_param *agg_param, vos_iter_desc_
 	return agg_needed;
 }
 
+/*
+ * Punched obj/dkey/akeys, and the punch entries of their incarnation logs, have to stay until an
+ * incremental reintegration replays them on the target that missed the punch.
+ */
+static inline bool
+agg_keep_punch(struct vos_agg_param *agg_param)
+{
+	return agg_param->ap_flags & VOS_AGG_FL_KEEP_PUNCH;
+}
+
+/* Aggregating the dkeys of one partition, objects are left to the final pass */
+static inline bool
+agg_part_keys(struct vos_agg_param *agg_param)
+{
+	return agg_param->ap_part < agg_param->ap_part_nr;
+}
+
+/* Whether the dkey belongs to another partition, or it's the final pass over objects */
+static inline bool
+agg_part_skip_dkey(struct vos_agg_param *agg_param, daos_key_t *dkey)
+{
+	uint64_t	hash;
+
+	if (agg_param->ap_part_nr == 0)
+		return false;
+
+	if (agg_param->ap_part == agg_param->ap_part_nr)
+		return true;
+
+	/* Seeded by the object, so single-dkey objects are spread over partitions as well */
+	hash = d_hash_murmur64(dkey->iov_buf, dkey->iov_len,
+			       (uint32_t)agg_param->ap_oid.id_pub.lo);
+
+	return hash % agg_param->ap_part_nr != agg_param->ap_part;
+}
+
 static inline bool
 vos_aggregate_yield(struct vos_agg_param *agg_param)
 {
@@ -343,6 +390,17 @@ vos_agg_filter(daos_handle_t ih, vos_iter_desc_t *desc, void *cb_arg, unsigned i
 	struct vos_agg_param	*agg_param = cb_arg;
 	int			 rc = 0;
 
+	if (desc->id_type == VOS_ITER_OBJ)
+		agg_param->ap_tier = !agg_param->ap_discard && !agg_param->ap_discard_obj &&
+				     vos_tier_agg_visit(vos_hdl2cont(agg_param->ap_coh),
+							desc->id_oid, !agg_part_keys(agg_param));
+
+	if (desc->id_type == VOS_ITER_DKEY && agg_part_skip_dkey(agg_param, &desc->id_key)) {
+		*acts |= VOS_ITER_CB_SKIP;
+		credits_consume(&agg_param->ap_credits, AGG_OP_SKIP);
+		D_GOTO(out, rc = 0);
+	}
+
 	rc = need_aggregate(ih, agg_param, desc);
 	if (rc == 0) {
 		if (desc->id_type == VOS_ITER_OBJ) {
@@ -362,6 +420,13 @@ vos_agg_filter(daos_handle_t ih, vos_iter_desc_t *desc, void *cb_arg, unsigned i
 	if (rc < 0) /** Ignore the filter error, let iterator handle it on actual probe */
 		D_GOTO(out, rc = 0);
 
+	/* Other partitions may be in the object, it's only removed by the final pass */
+	if (desc->id_type == VOS_ITER_OBJ && agg_part_keys(agg_param))
+		D_GOTO(out, rc = 0);
+
+	if (agg_keep_punch(agg_param))
+		D_GOTO(out, rc = 0);
+
 	if (desc->id_type == VOS_ITER_OBJ)
 		rc = oi_iter_check_punch(ih);
 	else
@@ -393,7 +458,11 @@ vos_agg_obj(daos_handle_t ih, vos_iter_entry_t *entry,
 	    struct vos_agg_param *agg_param, unsigned int *acts)
 {
 	agg_param->ap_oid = entry->ie_oid;
-	inc_agg_counter(agg_param, VOS_ITER_OBJ, AGG_OP_SCAN);
+	/* Only account the object once for partitioned aggregation */
+	if (agg_part_keys(agg_param))
+		credits_consume(&agg_param->ap_credits, AGG_OP_SCAN);
+	else
+		inc_agg_counter(agg_param, VOS_ITER_OBJ, AGG_OP_SCAN);
 
 	return 0;
 }
@@ -982,7 +1051,7 @@ reserve_segment(struct vos_object *obj, struct agg_io_context *io,
 
 	memset(addr, 0, sizeof(*addr));
 
-	if (vos_io_scm(vos_obj2pool(obj), DAOS_IOD_ARRAY, size, VOS_IOS_AGGREGATION)) {
+	if (vos_tier_agg_scm(obj, size)) {
 		/** Store on SCM */
 		off = vos_reserve_scm(obj->obj_cont, io->ic_rsrvd_scm, size);
 		if (UMOFF_IS_NULL(off)) {
@@ -1095,7 +1164,7 @@ fill_one_segment(daos_handle_t ih, struct agg_merge_window *mw,
 	struct bio_io_context	*bio_ctxt;
 	struct bio_sglist	 bsgl = { 0 }, bsgl_dst = { 0 };
 	bio_addr_t		 addr_src;
-	daos_size_t		 seg_size, copy_size, read_size = 0;
+	daos_size_t		 seg_size, copy_size, read_size = 0, scm_size = 0;
 	struct evt_extent	 ext = { 0 };
 	daos_off_t		 phy_lo = 0;
 	unsigned int		 i, seg_count, biov_idx = 0;
@@ -1175,6 +1244,8 @@ fill_one_segment(daos_handle_t ih, struct agg_merge_window *mw,
 		addr_src.ba_off += (ext.ex_lo - phy_lo) * ent_in->ei_inob;
 
 		D_ASSERT(!bio_addr_is_hole(&addr_src));
+		if (addr_src.ba_type == DAOS_MEDIA_SCM)
+			scm_size += copy_size;
 
 		D_ASSERT(biov_idx < bsgl.bs_nr);
 		bio_iov_set(&bsgl.bs_iovs[biov_idx], addr_src, copy_size);
@@ -1227,6 +1298,11 @@ post:
 	} else {
 		struct vos_agg_metrics	*vam = agg_cont2metrics(obj->obj_cont);
 
+		obj->obj_cont->vc_agg_merged += seg_size;
+		if (ent_in->ei_addr.ba_type == DAOS_MEDIA_SCM)
+			vos_tier_moved(vos_obj2pool(obj), seg_size - scm_size, 0);
+		else
+			vos_tier_moved(vos_obj2pool(obj), 0, scm_size);
 		if (vam) {
 			if (vam->vam_merge_recs)
 				d_tm_inc_counter(vam->vam_merge_recs, seg_count);
@@ -1619,7 +1695,7 @@ free_removal_records(struct agg_merge_window *mw, d_list_t *head, bool top)
 }
 
 static inline bool
-need_merge(daos_handle_t ih, uint16_t src_media, int lgc_cnt, daos_size_t seg_size)
+need_merge(daos_handle_t ih, uint16_t src_media, int lgc_cnt, daos_size_t seg_size, bool tier)
 {
 	struct vos_obj_iter	*oiter = vos_hdl2oiter(ih);
 	struct vos_object	*obj = oiter->it_obj;
@@ -1628,14 +1704,19 @@ need_merge(daos_handle_t ih, uint16_t src_media, int lgc_cnt, daos_size_t seg_si
 
 	D_ASSERTF(lgc_cnt > 0 && seg_size > 0, "lgc_cnt=%d seg_size=" DF_U64 "\n", lgc_cnt,
 		  seg_size);
-	if (lgc_cnt == 1)
+	if (lgc_cnt == 1 && !tier)
 		return false;
 
-	if (vos_io_scm(vos_obj2pool(obj), DAOS_IOD_ARRAY, seg_size, VOS_IOS_AGGREGATION))
+	if (tier ? vos_tier_agg_scm(obj, seg_size) :
+		   vos_io_scm(vos_obj2pool(obj), DAOS_IOD_ARRAY, seg_size, VOS_IOS_AGGREGATION))
 		tgt_media = DAOS_MEDIA_SCM;
 	else
 		tgt_media = DAOS_MEDIA_NVME;
 
+	/* A single record of a tracked object is only moved to the other tier */
+	if (lgc_cnt == 1)
+		return src_media != tgt_media;
+
 	/* Some data can be migrated from SCM to NVMe to alleviate SCM pressure */
 	if (src_media != tgt_media)
 		return true;
@@ -1666,7 +1747,8 @@ need_merge(daos_handle_t ih, uint16_t src_media, int lgc_cnt, daos_size_t seg_si
  *
  * 1. If any invisible data to be removed, flush merge window to free space.
  * 2. If any data could be migrated from SCM to NVMe, flush merge window to alleviate
- *    SCM space pressure.
+ *    SCM space pressure. For the objects tracked by vos_tier.c, that's also any data
+ *    to be promoted to SCM or demoted to NVMe, single records included.
  * 3. If any removal records, punch records could be removed or merged, flush merge
  *    window to condense VOS tree.
  * 4. If only records coalescing within same media (eg. merging small SCM records to a
@@ -1711,7 +1793,8 @@ need_flush(daos_handle_t ih, struct vos_agg_param *agg_param, bool last)
 			return true;
 
 		if (i == 0 || (hole != bio_addr_is_hole(&phy_ent->pe_addr))) {
-			if (i && need_merge(ih, src_media, lgc_cnt, seg_width * mw->mw_rsize))
+			if (i && need_merge(ih, src_media, lgc_cnt, seg_width * mw->mw_rsize,
+					    agg_param->ap_tier && !hole))
 				return true;
 
 			src_media = phy_ent->pe_addr.ba_type;
@@ -1735,7 +1818,8 @@ need_flush(daos_handle_t ih, struct vos_agg_param *agg_param, bool last)
 		hole = bio_addr_is_hole(&phy_ent->pe_addr);
 	}
 
-	if (lgc_cnt && need_merge(ih, src_media, lgc_cnt, seg_width * mw->mw_rsize))
+	if (lgc_cnt && need_merge(ih, src_media, lgc_cnt, seg_width * mw->mw_rsize,
+				  agg_param->ap_tier && !hole))
 		return true;
 
 	clear_merge_window(mw);
@@ -2397,6 +2481,8 @@ vos_aggregate_post_cb(daos_handle_t ih, vos_iter_entry_t *entry,
 			agg_param->ap_skip_obj = false;
 			break;
 		}
+		if (agg_part_keys(agg_param) || agg_keep_punch(agg_param))
+			break;
 		rc = oi_iter_aggregate(ih, agg_param->ap_discard_obj);
 		break;
 	case VOS_ITER_DKEY:
@@ -2411,6 +2497,8 @@ vos_aggregate_post_cb(daos_handle_t ih, vos_iter_entry_t *entry,
 		}
 		agg_param->ap_trace_start = 0;
 		agg_param->ap_trace_count = 0;
+		if (agg_keep_punch(agg_param))
+			break;
 		rc = vos_obj_iter_aggregate(ih, agg_param->ap_discard_obj);
 		break;
 	case VOS_ITER_SINGLE:
@@ -2543,6 +2631,8 @@ aggregate_enter(struct vos_container *cont, int agg_mode, daos_epoch_range_t *ep
 
 		cont->vc_in_aggregation = 1;
 		cont->vc_epr_aggregation = *epr;
+		cont->vc_agg_merged = 0;
+		cont->vc_agg_start = daos_getmtime_coarse();
 
 		if (vam && vam->vam_epr_dur)
 			d_tm_mark_duration_start(vam->vam_epr_dur, D_TM_CLOCK_THREAD_CPUTIME);
@@ -2593,6 +2683,17 @@ aggregate_exit(struct vos_container *cont, int agg_mode)
 		break;
 	case AGG_MODE_AGGREGATE:
 		D_ASSERT(cont->vc_in_aggregation);
+		if (cont->vc_agg_merged != 0) {
+			uint64_t	msecs = daos_getmtime_coarse() - cont->vc_agg_start;
+			uint64_t	rate = cont->vc_agg_merged * 1000 / max(msecs, 1);
+
+			D_DEBUG(DB_EPC, DF_CONT": merged "DF_U64" bytes in "DF_U64" msecs, epr["
+				DF_U64", "DF_U64"]\n", DP_CONT(cont->vc_pool->vp_id, cont->vc_id),
+				cont->vc_agg_merged, msecs, cont->vc_epr_aggregation.epr_lo,
+				cont->vc_epr_aggregation.epr_hi);
+			if (vam && vam->vam_merge_rate)
+				d_tm_set_gauge(vam->vam_merge_rate, rate);
+		}
 		cont->vc_in_aggregation = 0;
 		cont->vc_epr_aggregation.epr_lo = 0;
 		cont->vc_epr_aggregation.epr_hi = 0;
@@ -2637,9 +2738,13 @@ vos_aggregate_exit(daos_handle_t coh)
 	aggregate_exit(vos_hdl2cont(coh), AGG_MODE_AGGREGATE);
 }
 
-int
-vos_aggregate(daos_handle_t coh, daos_epoch_range_t *epr,
-	      int (*yield_func)(void *arg), void *yield_arg, uint32_t flags)
+/*
+ * Aggregate the whole container (part_nr == 0) or one partition of it, \a incomplete is
+ * set when something was left behind, then the HAE must not be bumped.
+ */
+static int
+agg_run(daos_handle_t coh, daos_epoch_range_t *epr, uint32_t part, uint32_t part_nr,
+	int (*yield_func)(void *arg), void *yield_arg, uint32_t flags, bool *incomplete)
 {
 	struct vos_container	*cont = vos_hdl2cont(coh);
 	struct agg_data		*ad;
@@ -2647,22 +2752,13 @@ vos_aggregate(daos_handle_t coh, daos_epoch_range_t *epr,
 	daos_epoch_t		 agg_write;
 	bool			 has_agg_write;
 	int			 rc;
-	bool			 run_agg = false;
 
-	D_DEBUG(DB_TRACE, "epr: %lu -> %lu\n", epr->epr_lo, epr->epr_hi);
-	D_ASSERT(epr != NULL);
-	D_ASSERTF(epr->epr_lo < epr->epr_hi && epr->epr_hi != DAOS_EPOCH_MAX,
-		  "epr_lo:"DF_U64", epr_hi:"DF_U64"\n",
-		  epr->epr_lo, epr->epr_hi);
+	*incomplete = false;
 
 	D_ALLOC_PTR(ad);
 	if (ad == NULL)
 		return -DER_NOMEM;
 
-	rc = aggregate_enter(cont, AGG_MODE_AGGREGATE, epr);
-	if (rc)
-		goto free_agg_data;
-
 	/** Use the lower end of the epoch range as the barrier when we are aggregating a
 	 *  deleted snapshot.  If there is no write above that range for a given key,
 	 *  the scan would be a noop anyway.
@@ -2674,8 +2770,12 @@ vos_aggregate(daos_handle_t coh, daos_epoch_range_t *epr,
 
 	feats = dbtree_feats_get(&cont->vc_cont_df->cd_obj_root);
 	has_agg_write = vos_feats_agg_time_get(feats, &agg_write);
-	if (has_agg_write && agg_write <= ad->ad_agg_param.ap_filter_epoch)
-		goto update_hae;
+	/* Hot or cooling objects are revisited even if nothing was written */
+	if (has_agg_write && agg_write <= ad->ad_agg_param.ap_filter_epoch &&
+	    cont->vc_tier_nr == 0) {
+		D_FREE(ad);
+		return 0;
+	}
 
 	/* Set iteration parameters */
 	ad->ad_iter_param.ip_hdl = coh;
@@ -2698,9 +2798,10 @@ vos_aggregate(daos_handle_t coh, daos_epoch_range_t *epr,
 	ad->ad_agg_param.ap_discard = 0;
 	ad->ad_agg_param.ap_yield_func = yield_func;
 	ad->ad_agg_param.ap_yield_arg = yield_arg;
-	run_agg = true;
 	merge_window_init(&ad->ad_agg_param.ap_window);
 	ad->ad_agg_param.ap_flags = flags;
+	ad->ad_agg_param.ap_part = part;
+	ad->ad_agg_param.ap_part_nr = part_nr;
 
 	ad->ad_iter_param.ip_flags |= VOS_IT_FOR_PURGE;
 	rc = vos_iterate(&ad->ad_iter_param, VOS_ITER_OBJ, true, &ad->ad_anchors,
@@ -2708,7 +2809,7 @@ vos_aggregate(daos_handle_t coh, daos_epoch_range_t *epr,
 			 &ad->ad_agg_param, NULL);
 	if (rc != 0 || ad->ad_agg_param.ap_nospc_err) {
 		close_merge_window(&ad->ad_agg_param.ap_window, rc);
-		goto exit;
+		*incomplete = true;
 	} else if (ad->ad_agg_param.ap_csum_err) {
 		rc = -DER_CSUM;	/* Inform caller the csum error */
 		close_merge_window(&ad->ad_agg_param.ap_window, rc);
@@ -2721,35 +2822,93 @@ vos_aggregate(daos_handle_t coh, daos_epoch_range_t *epr,
 		 * NB: We may be able to improve this by tracking the lowest epoch
 		 * of such  entries and updating the HAE to that value - 1.
 		 */
-		goto exit;
+		*incomplete = true;
 	}
 
-update_hae:
+	if (merge_window_status(&ad->ad_agg_param.ap_window) != MW_CLOSED)
+		D_ASSERTF(false, "Merge window resource leaked.\n");
+
+	D_FREE(ad);
+	return rc;
+}
+
+static void
+agg_update_hae(struct vos_container *cont, daos_epoch_range_t *epr)
+{
 	/*
 	 * Update HAE, when aggregating for snapshot deletion, the
 	 * @epr->epr_hi could be smaller than the HAE
 	 */
 	if (cont->vc_cont_df->cd_hae < epr->epr_hi)
 		cont->vc_cont_df->cd_hae = epr->epr_hi;
-exit:
+}
+
+static inline void
+agg_fail_inc(struct vos_container *cont)
+{
+	struct vos_agg_metrics *vam = agg_cont2metrics(cont);
+
+	if (vam && vam->vam_fail_count)
+		d_tm_inc_counter(vam->vam_fail_count, 1);
+}
+
+int
+vos_aggregate(daos_handle_t coh, daos_epoch_range_t *epr,
+	      int (*yield_func)(void *arg), void *yield_arg, uint32_t flags)
+{
+	struct vos_container	*cont = vos_hdl2cont(coh);
+	bool			 incomplete;
+	int			 rc;
+
+	D_DEBUG(DB_TRACE, "epr: %lu -> %lu\n", epr->epr_lo, epr->epr_hi);
+	D_ASSERT(epr != NULL);
+	D_ASSERTF(epr->epr_lo < epr->epr_hi && epr->epr_hi != DAOS_EPOCH_MAX,
+		  "epr_lo:"DF_U64", epr_hi:"DF_U64"\n",
+		  epr->epr_lo, epr->epr_hi);
+
+	rc = aggregate_enter(cont, AGG_MODE_AGGREGATE, epr);
+	if (rc)
+		goto out;
+
+	rc = agg_run(coh, epr, 0, 0, yield_func, yield_arg, flags, &incomplete);
+	if ((rc == 0 || rc == -DER_CSUM) && !incomplete)
+		agg_update_hae(cont, epr);
+
 	aggregate_exit(cont, AGG_MODE_AGGREGATE);
+out:
+	if (rc < 0)
+		agg_fail_inc(cont);
 
-	if (run_agg && merge_window_status(&ad->ad_agg_param.ap_window) != MW_CLOSED)
-		D_ASSERTF(false, "Merge window resource leaked.\n");
+	return rc;
+}
 
-free_agg_data:
-	D_FREE(ad);
+int
+vos_aggregate_part(daos_handle_t coh, daos_epoch_range_t *epr, uint32_t part,
+		   uint32_t part_nr, int (*yield_func)(void *arg), void *yield_arg,
+		   uint32_t flags, bool *incomplete)
+{
+	struct vos_container	*cont = vos_hdl2cont(coh);
+	int			 rc;
 
-	if (rc < 0) {
-		struct vos_agg_metrics *vam = agg_cont2metrics(cont);
+	D_ASSERT(cont->vc_in_aggregation);
+	D_ASSERTF(part_nr > 0 && part <= part_nr, "part %u, part_nr %u\n", part, part_nr);
 
-		if (vam && vam->vam_fail_count)
-			d_tm_inc_counter(vam->vam_fail_count, 1);
-	}
+	rc = agg_run(coh, epr, part, part_nr, yield_func, yield_arg, flags, incomplete);
+	if (rc < 0)
+		agg_fail_inc(cont);
 
 	return rc;
 }
 
+void
+vos_aggregate_hae_update(daos_handle_t coh, daos_epoch_range_t *epr)
+{
+	struct vos_container	*cont = vos_hdl2cont(coh);
+
+	D_ASSERT(cont->vc_in_aggregation);
+	agg_update_hae(cont, epr);
+}
+
 int
 vos_discard(daos_handle_t coh, daos_unit_oid_t *oidp, daos_epoch_range_t *epr,
 	    int (*yield_func)(void *arg), void *yield_arg)
@@ -588,6 +588,8 @@ vos_tls_init(int tags, int xs_id, int tgt_id)
 		if (rc)
 			D_WARN("Failed to create vos obj cnt: "DF_RC"\n", DP_RC(rc));
 
+		if (tls->vtl_ts_table != NULL)
+			vos_ts_metrics_init(tls->vtl_ts_table, tgt_id);
 	}
 
 	rc = d_tm_add_metric(&tls->vtl_lru_alloc_size, D_TM_GAUGE,
@@ -681,6 +683,16 @@ vos_mod_init(void)
 	d_getenv_bool("DAOS_DKEY_PUNCH_PROPAGATE", &vos_dkey_punch_propagate);
 	D_INFO("DKEY punch propagation is %s\n", vos_dkey_punch_propagate ? "enabled" : "disabled");
 
+	d_getenv_uint("DAOS_VOS_TIER_SCM_PCT", &vos_tier_scm_pct);
+	if (vos_tier_scm_pct > VOS_TIER_SCM_PCT_MAX)
+		vos_tier_scm_pct = VOS_TIER_SCM_PCT_MAX;
+	if (vos_tier_scm_pct != 0)
+		D_INFO("Hot data may be placed on up to %u%% of SCM\n", vos_tier_scm_pct);
+
+	d_getenv_uint("DAOS_VOS_TS_CACHE_MB", &vos_ts_cache_mb);
+	if (vos_ts_cache_mb != 0)
+		D_INFO("Set timestamp cache budget to %u MiB per target\n", vos_ts_cache_mb);
+
 
 	return rc;
 }
@@ -696,7 +708,8 @@ vos_metrics_count(void)
 {
 	return vea_metrics_count() +
 	       (sizeof(struct vos_agg_metrics) + sizeof(struct vos_space_metrics) +
-		sizeof(struct vos_chkpt_metrics)) / sizeof(struct d_tm_node_t *);
+		sizeof(struct vos_chkpt_metrics) + sizeof(struct vos_umem_cache_metrics)) /
+	       sizeof(struct d_tm_node_t *);
 }
 
 static void
@@ -821,6 +834,12 @@ vos_metrics_alloc(const char *path, int tgt_id)
 	if (rc)
 		D_WARN("Failed to create 'merged_size' telemetry : "DF_RC"\n", DP_RC(rc));
 
+	/* VOS aggregation merge throughput of the last aggregated EPR */
+	rc = d_tm_add_metric(&vam->vam_merge_rate, D_TM_GAUGE, "merge throughput", "bytes/sec",
+			     "%s/%s/merge_rate/tgt_%u", path, VOS_AGG_DIR, tgt_id);
+	if (rc)
+		D_WARN("Failed to create 'merge_rate' telemetry : "DF_RC"\n", DP_RC(rc));
+
 	/* VOS aggregation failed */
 	rc = d_tm_add_metric(&vam->vam_fail_count, D_TM_COUNTER, "aggregation failures", NULL,
 			     "%s/%s/fail_count/tgt_%u", path, VOS_AGG_DIR, tgt_id);
@@ -830,6 +849,9 @@ vos_metrics_alloc(const char *path, int tgt_id)
 	/* Metrics related to VOS checkpointing */
 	vos_chkpt_metrics_init(&vp_metrics->vp_chkpt_metrics, path, tgt_id);
 
+	/* Metrics related to the metadata page cache */
+	vos_umem_cache_metrics_init(&vp_metrics->vp_umem_cache_metrics, path, tgt_id);
+
 	/* VOS space SCM used metric */
 	rc = d_tm_add_metric(&vsm->vsm_scm_used, D_TM_GAUGE, "SCM space used", "bytes",
 			     "%s/%s/scm_used/tgt_%u", path, VOS_SPACE_DIR, tgt_id);
@@ -863,6 +885,9 @@ vos_metrics_alloc(const char *path, int tgt_id)
 	/* Initialize metrics for WAL */
 	vos_wal_metrics_init(&vp_metrics->vp_wal_metrics, path, tgt_id);
 
+	/* Metrics related to hot/cold data placement */
+	vos_tier_metrics_init(&vp_metrics->vp_tier_metrics, path, tgt_id);
+
 	return vp_metrics;
 }
 
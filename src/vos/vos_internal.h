@@ -140,6 +140,13 @@ enum {
 
 extern unsigned int vos_agg_nvme_thresh;
 extern bool vos_dkey_punch_propagate;
+extern unsigned int vos_ts_cache_mb;
+extern unsigned int vos_tier_scm_pct;
+
+/* Maximum percentage of SCM used for hot data placement */
+#define VOS_TIER_SCM_PCT_MAX	90
+/* Maximum number of hot objects tracked per container */
+#define VOS_TIER_OIDS_MAX	32
 
 static inline uint32_t vos_byte2blkcnt(uint64_t bytes)
 {
@@ -184,6 +191,7 @@ struct vos_agg_metrics {
 	struct d_tm_node_t	*vam_del_ev;		/* Deleted EV records */
 	struct d_tm_node_t	*vam_merge_recs;	/* Total merged EV records */
 	struct d_tm_node_t	*vam_merge_size;	/* Total merged size */
+	struct d_tm_node_t	*vam_merge_rate;	/* Merged size per second, last EPR */
 	struct d_tm_node_t	*vam_fail_count;	/* Aggregation failed */
 };
 
@@ -208,9 +216,25 @@ struct vos_chkpt_metrics {
 	struct d_tm_node_t	*vcm_dirty_chunks;
 	struct d_tm_node_t	*vcm_iovs_copied;
 	struct d_tm_node_t	*vcm_wal_purged;
+	struct d_tm_node_t	*vcm_bandwidth;
+	struct d_tm_node_t	*vcm_wal_headroom;
 };
 
 void vos_chkpt_metrics_init(struct vos_chkpt_metrics *vc_metrics, const char *path, int tgt_id);
+
+/*
+ * VOS Pool metrics for the metadata page cache. Hits, misses and evictions only
+ * move once page accesses go through umem_cache_load()/umem_cache_pin().
+ */
+struct vos_umem_cache_metrics {
+	struct d_tm_node_t	*vum_hits;
+	struct d_tm_node_t	*vum_misses;
+	struct d_tm_node_t	*vum_evictions;
+	struct d_tm_node_t	*vum_mapped;
+};
+
+void vos_umem_cache_metrics_init(struct vos_umem_cache_metrics *vu_metrics, const char *path,
+				 int tgt_id);
 void
 vos_gc_metrics_init(struct vos_gc_metrics *vc_metrics, const char *path, int tgt_id);
 
@@ -236,13 +260,26 @@ struct vos_wal_metrics {
 
 void vos_wal_metrics_init(struct vos_wal_metrics *vw_metrics, const char *path, int tgt_id);
 
+/* VOS Pool metrics for hot/cold data placement */
+struct vos_tier_metrics {
+	struct d_tm_node_t	*vtm_scm_hits;		/* Fetched extents on SCM */
+	struct d_tm_node_t	*vtm_nvme_hits;		/* Fetched extents on NVMe */
+	struct d_tm_node_t	*vtm_promoted;		/* Bytes moved from NVMe to SCM */
+	struct d_tm_node_t	*vtm_demoted;		/* Bytes moved from SCM to NVMe */
+	struct d_tm_node_t	*vtm_hot_objs;		/* Objects tracked as hot */
+};
+
+void vos_tier_metrics_init(struct vos_tier_metrics *vt_metrics, const char *path, int tgt_id);
+
 struct vos_pool_metrics {
 	void			*vp_vea_metrics;
 	struct vos_agg_metrics	 vp_agg_metrics;
 	struct vos_gc_metrics    vp_gc_metrics;
 	struct vos_space_metrics vp_space_metrics;
 	struct vos_chkpt_metrics vp_chkpt_metrics;
+	struct vos_umem_cache_metrics vp_umem_cache_metrics;
 	struct vos_wal_metrics	 vp_wal_metrics;
+	struct vos_tier_metrics	 vp_tier_metrics;
 	/* TODO: add more metrics for VOS */
 };
 
@@ -305,6 +342,20 @@ struct vos_pool {
 	uint32_t		 vp_data_thresh;
 	/** Space (in percentage) reserved for rebuild */
 	unsigned int		 vp_space_rb;
+	/** SCM space hot data may be placed in, 0 if tiering is disabled */
+	daos_size_t		 vp_tier_budget;
+	/** SCM room of aggregation for hot data, refreshed every second */
+	daos_size_t		 vp_tier_room;
+	uint64_t		 vp_tier_room_ts;
+};
+
+/** Object tracked for hot/cold data placement, see vos_tier.c */
+struct vos_tier_obj {
+	daos_unit_oid_t		vto_oid;
+	/* Last access (sec) */
+	uint64_t		vto_access;
+	/* Heat of the object as of the last access */
+	uint32_t		vto_heat;
 };
 
 /**
@@ -348,6 +399,9 @@ struct vos_container {
 	daos_epoch_range_t	vc_epr_aggregation;
 	/* Current ongoing discard EPR */
 	daos_epoch_range_t	vc_epr_discard;
+	/* Bytes merged by current ongoing aggregation, and when it started (msecs) */
+	uint64_t		vc_agg_merged;
+	uint64_t		vc_agg_start;
 	/* Last timestamp when VOS aggregation reporting ENOSPACE */
 	uint64_t		vc_agg_nospc_ts;
 	/* Last timestamp when IO reporting ENOSPACE */
@@ -365,6 +419,9 @@ struct vos_container {
 				vc_cmt_dtx_indexed:1;
 	unsigned int		vc_obj_discard_count;
 	unsigned int		vc_open_count;
+	/* Hot objects, revisited by aggregation to move their data between SCM and NVMe */
+	uint32_t		vc_tier_nr;
+	struct vos_tier_obj	vc_tier_objs[VOS_TIER_OIDS_MAX];
 };
 
 struct vos_dtx_act_ent {
@@ -1459,7 +1516,10 @@ vos_space_query(struct vos_pool *pool, struct vos_pool_space *vps, bool slow);
 int
 vos_space_hold(struct vos_pool *pool, uint64_t flags, daos_key_t *dkey,
 	       unsigned int iod_nr, daos_iod_t *iods,
-	       struct dcs_iod_csums *iods_csums, daos_size_t *space_hld);
+	       struct dcs_iod_csums *iods_csums, bool *tier_hot, daos_size_t *space_hld);
+/** SCM space hot data can still take, within the tiering budget and the SCM reservations */
+daos_size_t
+vos_space_tier_room(struct vos_pool *pool, struct vos_pool_space *vps);
 void
 vos_space_unhold(struct vos_pool *pool, daos_size_t *space_hld);
 void
@@ -1818,6 +1878,49 @@ vos_io_scm(struct vos_pool *pool, daos_iod_type_t type, daos_size_t size, enum v
 	return false;
 }
 
+/**
+ * Hot/cold data placement, see vos_tier.c
+ */
+
+/** Account for an access to the object, tracks it in its container once it is hot */
+void
+vos_tier_obj_access(struct vos_object *obj);
+
+/** Whether the object is tracked and still hot, the object doesn't need to be held */
+bool
+vos_tier_hot(struct vos_container *cont, daos_unit_oid_t oid);
+
+/**
+ * Whether aggregation should visit the object even if it wasn't written, to move its data.
+ * Objects not accessed for long are untracked by the last pass of aggregation over them.
+ */
+bool
+vos_tier_agg_visit(struct vos_container *cont, daos_unit_oid_t oid, bool last_pass);
+
+/** Drop all the tracked objects of a container being freed */
+void
+vos_tier_cont_fini(struct vos_container *cont);
+
+/**
+ * Same as vos_io_scm(), except that the small extents of hot objects go to SCM. Updates
+ * only pass \a hot once vos_space_hold() found room for them in the tiering budget.
+ */
+bool
+vos_tier_scm(struct vos_pool *pool, bool hot, daos_iod_type_t type, daos_size_t size,
+	     enum vos_io_stream ios);
+
+/** Whether aggregation should store a merged extent of \a obj on SCM */
+bool
+vos_tier_agg_scm(struct vos_object *obj, daos_size_t size);
+
+/** Account for a fetched extent in the tier hit rates */
+void
+vos_tier_fetch_hit(struct vos_pool *pool, bio_addr_t *addr);
+
+/** Account for data moved between tiers by aggregation */
+void
+vos_tier_moved(struct vos_pool *pool, daos_size_t promoted, daos_size_t demoted);
+
 /**
  * Insert object ID and its parent container into the array of objects touched by the ongoing
  * local transaction.
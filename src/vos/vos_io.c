@@ -70,7 +70,8 @@ struct vos_io_context {
 	    ic_dedup        : 1, /** candidate for dedup */
 	    ic_dedup_verify : 1, ic_read_ts_only : 1, ic_check_existence : 1, ic_remove : 1,
 	    ic_skip_fetch : 1, ic_agg_needed : 1, ic_skip_akey_support : 1, ic_rebuild : 1,
-	    ic_ec : 1; /**< see VOS_OF_EC */
+	    ic_ec : 1,      /**< see VOS_OF_EC */
+	    ic_tier_hot : 1; /**< the object is hot, see vos_tier.c */
 	/**
 	 * Input shadow recx lists, one for each iod. Now only used for degraded
 	 * mode EC obj fetch handling.
@@ -873,6 +874,7 @@ akey_fetch_single(daos_handle_t toh, const daos_epoch_range_t *epr,
 		return -DER_CSUM;
 	}
 
+	vos_tier_fetch_hit(vos_cont2pool(ioc->ic_cont), &biov.bi_addr);
 	rc = iod_fetch(ioc, &biov);
 	if (rc != 0)
 		goto out;
@@ -1040,6 +1042,7 @@ akey_fetch_recx(daos_handle_t toh, const daos_epoch_range_t *epr,
 			if (rc != 0)
 				goto failed;
 		}
+		vos_tier_fetch_hit(vos_cont2pool(ioc->ic_cont), &ent->en_addr);
 		bio_iov_set(&biov, ent->en_addr, nr * inob);
 		ioc->ic_io_size += nr * inob;
 		if (ci_is_valid(&ent->en_csum)) {
@@ -1564,6 +1567,8 @@ vos_fetch_begin(daos_handle_t coh, daos_unit_oid_t oid, daos_epoch_t epoch,
 	rc = vos_obj_hold(vos_obj_cache_current(ioc->ic_cont->vc_pool->vp_sysdb),
 			  ioc->ic_cont, oid, &ioc->ic_epr, ioc->ic_bound, VOS_OBJ_VISIBLE,
 			  DAOS_INTENT_DEFAULT, &ioc->ic_obj, ioc->ic_ts_set);
+	if (rc == 0 && !ioc->ic_read_ts_only)
+		vos_tier_obj_access(ioc->ic_obj);
 	if (stop_check(ioc, VOS_COND_FETCH_MASK | VOS_OF_COND_PER_AKEY, NULL,
 		       &rc, false)) {
 		if (rc == 0) {
@@ -2284,7 +2289,8 @@ akey_update_begin(struct vos_io_context *ioc)
 		size = (iod->iod_type == DAOS_IOD_SINGLE) ? iod->iod_size :
 				iod->iod_recxs[i].rx_nr * iod->iod_size;
 
-		if (vos_io_scm(vos_cont2pool(ioc->ic_cont), iod->iod_type, size, VOS_IOS_GENERIC))
+		if (vos_tier_scm(vos_cont2pool(ioc->ic_cont), ioc->ic_tier_hot, iod->iod_type, size,
+				 VOS_IOS_GENERIC))
 			media = DAOS_MEDIA_SCM;
 		else
 			media = DAOS_MEDIA_NVME;
@@ -2466,6 +2472,9 @@ vos_update_end(daos_handle_t ioh, uint32_t pm_ver, daos_key_t *dkey, int err,
 	if (err != 0)
 		goto abort;
 
+	if (!ioc->ic_rebuild)
+		vos_tier_obj_access(ioc->ic_obj);
+
 	if (dtx_is_valid_handle(dth))
 		minor_epc = dth->dth_op_seq;
 	else
@@ -2574,6 +2583,7 @@ vos_update_begin(daos_handle_t coh, daos_unit_oid_t oid, daos_epoch_t epoch,
 		 uint32_t dedup_th, daos_handle_t *ioh, struct dtx_handle *dth)
 {
 	struct vos_io_context	*ioc;
+	bool			 tier_hot;
 	int			 rc;
 
 	if (oid.id_shard % 3 == 1 && DAOS_FAIL_CHECK(DAOS_DTX_FAIL_IO))
@@ -2600,14 +2610,17 @@ vos_update_begin(daos_handle_t coh, daos_unit_oid_t oid, daos_epoch_t epoch,
 	if (rc != 0)
 		return rc;
 
+	tier_hot = !ioc->ic_rebuild && vos_tier_hot(ioc->ic_cont, oid);
+
 	/* flags may have VOS_OF_CRIT to skip sys/held checks here */
 	rc = vos_space_hold(vos_cont2pool(ioc->ic_cont), flags, dkey, iod_nr,
-			    iods, iods_csums, &ioc->ic_space_held[0]);
+			    iods, iods_csums, &tier_hot, &ioc->ic_space_held[0]);
 	if (rc != 0) {
 		D_ERROR(DF_UOID": Hold space failed. "DF_RC"\n",
 			DP_UOID(oid), DP_RC(rc));
 		goto error;
 	}
+	ioc->ic_tier_hot = tier_hot;
 
 	rc = dkey_update_begin(ioc);
 	if (rc != 0) {
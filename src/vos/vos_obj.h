@@ -51,6 +51,10 @@ struct vos_object {
 	bool				obj_zombie;
 	/** Object is in discard */
 	bool				obj_discard;
+	/** Access heat for data placement, decays over time, see vos_tier.c */
+	uint32_t			obj_heat;
+	/** Last time the heat decayed (sec) */
+	uint64_t			obj_heat_ts;
 };
 
 enum {
@@ -514,6 +514,63 @@ vos_chkpt_metrics_init(struct vos_chkpt_metrics *vc_metrics, const char *path, i
 	if (rc)
 		D_WARN("failed to create checkpoint_wal_purged metric: "DF_RC"\n", DP_RC(rc));
 
+	rc = d_tm_add_metric(&vc_metrics->vcm_bandwidth, D_TM_STATS_GAUGE,
+			     "Rate of dirty chunks written by the checkpoint", "bytes/sec",
+			     "%s/%s/bandwidth/tgt_%d", path, CHKPT_TELEMETRY_DIR, tgt_id);
+	if (rc)
+		D_WARN("failed to create checkpoint_bandwidth metric: "DF_RC"\n", DP_RC(rc));
+
+	rc = d_tm_add_metric(&vc_metrics->vcm_wal_headroom, D_TM_GAUGE,
+			     "Free WAL space after the checkpoint", "%",
+			     "%s/%s/wal_headroom/tgt_%d", path, CHKPT_TELEMETRY_DIR, tgt_id);
+	if (rc)
+		D_WARN("failed to create checkpoint_wal_headroom metric: "DF_RC"\n", DP_RC(rc));
+}
+
+#define	UMEM_CACHE_TELEMETRY_DIR	"umem_cache"
+
+void
+vos_umem_cache_metrics_init(struct vos_umem_cache_metrics *vu_metrics, const char *path,
+			    int tgt_id)
+{
+	int rc;
+
+	rc = d_tm_add_metric(&vu_metrics->vum_hits, D_TM_COUNTER,
+			     "Number of metadata page loads served from the cache", NULL,
+			     "%s/%s/hits/tgt_%d", path, UMEM_CACHE_TELEMETRY_DIR, tgt_id);
+	if (rc)
+		D_WARN("failed to create umem_cache_hits metric: "DF_RC"\n", DP_RC(rc));
+
+	rc = d_tm_add_metric(&vu_metrics->vum_misses, D_TM_COUNTER,
+			     "Number of metadata pages read from the meta blob", NULL,
+			     "%s/%s/misses/tgt_%d", path, UMEM_CACHE_TELEMETRY_DIR, tgt_id);
+	if (rc)
+		D_WARN("failed to create umem_cache_misses metric: "DF_RC"\n", DP_RC(rc));
+
+	rc = d_tm_add_metric(&vu_metrics->vum_evictions, D_TM_COUNTER,
+			     "Number of clean metadata pages evicted", NULL,
+			     "%s/%s/evictions/tgt_%d", path, UMEM_CACHE_TELEMETRY_DIR, tgt_id);
+	if (rc)
+		D_WARN("failed to create umem_cache_evictions metric: "DF_RC"\n", DP_RC(rc));
+
+	rc = d_tm_add_metric(&vu_metrics->vum_mapped, D_TM_GAUGE,
+			     "Number of metadata pages in the cache", "pages",
+			     "%s/%s/mapped/tgt_%d", path, UMEM_CACHE_TELEMETRY_DIR, tgt_id);
+	if (rc)
+		D_WARN("failed to create umem_cache_mapped metric: "DF_RC"\n", DP_RC(rc));
+}
+
+static void
+vos_umem_cache_metrics_update(struct vos_umem_cache_metrics *vu_metrics,
+			      struct umem_cache *cache)
+{
+	if (cache == NULL)
+		return;
+
+	d_tm_set_counter(vu_metrics->vum_hits, cache->ca_stats.ucs_hits);
+	d_tm_set_counter(vu_metrics->vum_misses, cache->ca_stats.ucs_misses);
+	d_tm_set_counter(vu_metrics->vum_evictions, cache->ca_stats.ucs_evictions);
+	d_tm_set_gauge(vu_metrics->vum_mapped, cache->ca_mapped);
 }
 
 void
@@ -575,8 +632,8 @@ vos_pool_needs_checkpoint(daos_handle_t poh)
 	return bio_nvme_configured(SMD_DEV_TYPE_META);
 }
 
-int
-vos_pool_checkpoint(daos_handle_t poh)
+static int
+pool_checkpoint(daos_handle_t poh, uint64_t max_pages)
 {
 	struct vos_pool               *pool;
 	uint64_t                       tx_id;
@@ -585,6 +642,8 @@ vos_pool_checkpoint(daos_handle_t poh)
 	struct bio_wal_info            wal_info;
 	int                            rc;
 	uint64_t                       purge_size = 0;
+	uint64_t                       start;
+	uint64_t                       duration;
 	struct umem_cache_chkpt_stats  stats;
 	struct vos_chkpt_metrics      *chkpt_metrics = NULL;
 
@@ -594,8 +653,12 @@ vos_pool_checkpoint(daos_handle_t poh)
 	umm   = vos_pool2umm(pool);
 	store = &umm->umm_pool->up_store;
 
-	if (pool->vp_metrics != NULL)
+	if (pool->vp_metrics != NULL) {
 		chkpt_metrics = &pool->vp_metrics->vp_chkpt_metrics;
+		/** Checkpoints run periodically, report the page cache activity at the same pace */
+		vos_umem_cache_metrics_update(&pool->vp_metrics->vp_umem_cache_metrics,
+					      store->cache);
+	}
 
 	if (chkpt_metrics != NULL)
 		d_tm_mark_duration_start(chkpt_metrics->vcm_duration, D_TM_CLOCK_REALTIME);
@@ -607,16 +670,21 @@ vos_pool_checkpoint(daos_handle_t poh)
 		return 0;
 	}
 
-	D_DEBUG(DB_MD, "Checkpoint started pool=" DF_UUID ", committed_id=" DF_X64 "\n",
-		DP_UUID(pool->vp_id), tx_id);
+	D_DEBUG(DB_MD, "Checkpoint started pool=" DF_UUID ", committed_id=" DF_X64
+		", max_pages=" DF_U64 "\n", DP_UUID(pool->vp_id), tx_id, max_pages);
 
 	rc = bio_meta_clear_empty(store->stor_priv);
 	if (rc)
 		return rc;
 
-	rc = umem_cache_checkpoint(store, pool->vp_wait_cb, pool->vp_chkpt_arg, &tx_id, &stats);
+	start = daos_get_ntime();
+	rc = umem_cache_checkpoint_incr(store, pool->vp_wait_cb, pool->vp_chkpt_arg, max_pages,
+					&tx_id, &stats);
+	duration = daos_get_ntime() - start;
 
-	if (rc == 0)
+	/** An incremental checkpoint may leave the oldest transactions dirty, nothing to purge */
+	if (rc == 0 && tx_id != -1ULL &&
+	    store->stor_ops->so_wal_id_cmp(store, tx_id, wal_info.wi_ckp_id) > 0)
 		rc = bio_wal_checkpoint(store->stor_priv, tx_id, &purge_size);
 
 	bio_wal_query(store->stor_priv, &wal_info);
@@ -636,11 +704,31 @@ vos_pool_checkpoint(daos_handle_t poh)
 			d_tm_set_gauge(chkpt_metrics->vcm_dirty_chunks, stats.uccs_nr_dchunks);
 			d_tm_set_gauge(chkpt_metrics->vcm_iovs_copied, stats.uccs_nr_iovs);
 			d_tm_set_gauge(chkpt_metrics->vcm_wal_purged, purge_size);
+			if (duration != 0)
+				d_tm_set_gauge(chkpt_metrics->vcm_bandwidth,
+					       (uint64_t)stats.uccs_nr_dchunks * UMEM_CACHE_CHUNK_SZ *
+						   NSEC_PER_SEC / duration);
 		}
+		if (wal_info.wi_tot_blks != 0)
+			d_tm_set_gauge(chkpt_metrics->vcm_wal_headroom,
+				       (uint64_t)(wal_info.wi_tot_blks - wal_info.wi_used_blks) * 100 /
+					   wal_info.wi_tot_blks);
 	}
 	return rc;
 }
 
+int
+vos_pool_checkpoint(daos_handle_t poh)
+{
+	return pool_checkpoint(poh, 0);
+}
+
+int
+vos_pool_checkpoint_incr(daos_handle_t poh, uint64_t max_pages)
+{
+	return pool_checkpoint(poh, max_pages);
+}
+
 int
 vos_pool_settings_init(bool md_on_ssd)
 {
@@ -1402,6 +1490,10 @@ pool_open(void *ph, struct vos_pool_df *pool_df, unsigned int flags, void *metri
 	else
 		pool->vp_data_thresh = DAOS_PROP_PO_DATA_THRESH_DEFAULT;
 
+	/* Further capped by the free SCM out of the reservations, see vos_space_tier_room() */
+	if (pool->vp_vea_info != NULL && vos_tier_scm_pct != 0)
+		pool->vp_tier_budget = pool_df->pd_scm_sz * vos_tier_scm_pct / 100;
+
 	vos_space_sys_init(pool);
 	/* Ensure GC is triggered after server restart */
 	gc_add_pool(pool);
@@ -18,6 +18,13 @@
 #define SEC2NS(s) (s * 1E9)
 #define NS2MS(s) (s / 1E6)
 
+/* Bounds of the scrub batch, adjusted to the observed load of the target */
+#define SCRUB_BATCH_MIN		(64 << 10)
+#define SCRUB_BATCH_MAX		(8 << 20)
+/* Bounds of the back off while waiting for the target to be idle in lazy mode */
+#define SCRUB_BUSY_SLEEP_MIN_MS	10
+#define SCRUB_BUSY_SLEEP_MAX_MS	1000
+
 #define m_inc_counter(m) d_tm_inc_counter((m), 1)
 #define m_reset_counter(m) d_tm_set_counter((m), 0)
 
@@ -38,6 +45,7 @@ static inline void
 sc_scrub_bytes_scrubbed(struct scrub_ctx *ctx, uint64_t bytes)
 {
 	ctx->sc_bytes_scrubbed += bytes;
+	ctx->sc_batch_bytes += bytes;
 	d_tm_inc_counter(ctx->sc_metrics.scm_bytes_scrubbed, bytes);
 	d_tm_inc_counter(ctx->sc_metrics.scm_bytes_scrubbed_total, bytes);
 }
@@ -47,6 +55,8 @@ sc_scrub_bytes_scrubbed_reset(struct scrub_ctx *ctx)
 {
 	d_tm_set_counter(ctx->sc_metrics.scm_bytes_scrubbed_last, ctx->sc_bytes_scrubbed);
 	d_tm_set_counter(ctx->sc_metrics.scm_bytes_scrubbed, 0);
+	d_tm_set_gauge(ctx->sc_metrics.scm_coverage, 0);
+	ctx->sc_bytes_scrubbed_last = ctx->sc_bytes_scrubbed;
 	ctx->sc_bytes_scrubbed = 0;
 }
 
@@ -66,11 +76,29 @@ sc_m_pool_start(struct scrub_ctx *ctx)
 	d_tm_mark_duration_start(ctx->sc_metrics.scm_last_duration, D_TM_CLOCK_REALTIME);
 }
 
+/* Scrub rate of the current tree scrub and how much of the previous one it has covered */
+static void
+sc_m_rate_update(struct scrub_ctx *ctx)
+{
+	struct timespec	now;
+	uint64_t	ms;
+
+	d_gettime(&now);
+	ms = d_timediff_ns(&ctx->sc_pool_start_scrub, &now) / NSEC_PER_MSEC;
+	if (ms > 0)
+		d_tm_set_gauge(ctx->sc_metrics.scm_bytes_per_sec,
+			       ctx->sc_bytes_scrubbed * 1000 / ms);
+	if (ctx->sc_bytes_scrubbed_last > 0)
+		d_tm_set_gauge(ctx->sc_metrics.scm_coverage,
+			       min(ctx->sc_bytes_scrubbed * 100 / ctx->sc_bytes_scrubbed_last, 100));
+}
+
 static void
 sc_m_pool_stop(struct scrub_ctx *ctx)
 {
 	ctx->sc_pool_last_csum_calcs = ctx->sc_pool_csum_calcs;
 
+	sc_m_rate_update(ctx);
 	d_tm_mark_duration_end(ctx->sc_metrics.scm_last_duration);
 	d_tm_set_counter(ctx->sc_metrics.scm_csum_calcs_last, ctx->sc_pool_last_csum_calcs);
 	d_tm_set_gauge(ctx->sc_metrics.scm_next_csum_scrub, 0);
@@ -282,13 +310,14 @@ sc_wait_until_should_continue(struct scrub_ctx *ctx)
 			sc_sleep(ctx, min(1000, msec_between));
 		}
 	} else if (sc_mode(ctx) == DAOS_SCRUB_MODE_LAZY) {
+		uint32_t	backoff = SCRUB_BUSY_SLEEP_MIN_MS;
+
 		sc_sleep(ctx, 0);
 		while (!sc_is_idle(ctx) && sc_mode(ctx) == DAOS_SCRUB_MODE_LAZY) {
 			sc_m_track_busy(ctx);
-			/* Don't actually know how long it will be but wait for 1 second before
-			 * trying again
-			 */
-			sc_sleep(ctx, 1000);
+			/* Don't know how long the target stays busy, back off until it's idle */
+			sc_sleep(ctx, backoff);
+			backoff = min(backoff * 2, SCRUB_BUSY_SLEEP_MAX_MS);
 		}
 		sc_m_track_idle(ctx);
 	} else {
@@ -304,6 +333,36 @@ sc_verify_finish(struct scrub_ctx *ctx)
 {
 	sc_csum_calc_inc(ctx);
 	sc_m_pool_csum_inc(ctx);
+	ctx->sc_batch_csums++;
+}
+
+/**
+ * Called after each verified value. The scrubber only paces itself (by schedule in
+ * timed mode, by load in lazy mode) once a batch of bytes has been verified, before
+ * that it just yields. The batch doubles while the target is idle and halves while
+ * it is busy.
+ */
+static void
+sc_batch_done(struct scrub_ctx *ctx)
+{
+	if (ctx->sc_batch_max == 0)
+		ctx->sc_batch_max = SCRUB_BATCH_MIN;
+
+	if (ctx->sc_batch_bytes < ctx->sc_batch_max) {
+		sc_sleep(ctx, 0);
+		return;
+	}
+
+	if (sc_is_idle(ctx))
+		ctx->sc_batch_max = min(ctx->sc_batch_max * 2, SCRUB_BATCH_MAX);
+	else
+		ctx->sc_batch_max = max(ctx->sc_batch_max / 2, SCRUB_BATCH_MIN);
+
+	C_TRACE("Scrub batch of %u csums, "DF_U64" bytes, next batch "DF_U64" bytes\n",
+		ctx->sc_batch_csums, ctx->sc_batch_bytes, ctx->sc_batch_max);
+	ctx->sc_batch_bytes = 0;
+	ctx->sc_batch_csums = 0;
+	sc_m_rate_update(ctx);
 	sc_wait_until_should_continue(ctx);
 }
 
@@ -391,9 +450,8 @@ sc_handle_corruption(struct scrub_ctx *ctx)
 }
 
 /**
- * Will verify the checksum(s) for the current recx. It will do it one chunk
- * at a time instead of all at once so that it can yield/sleep between each
- * calculation.
+ * Will verify the checksum(s) for the current recx, all the chunks back to back.
+ * Pacing happens per batch of values, see sc_batch_done().
  */
 static int
 sc_verify_recx(struct scrub_ctx *ctx, d_iov_t *data)
@@ -421,6 +479,8 @@ sc_verify_recx(struct scrub_ctx *ctx, d_iov_t *data)
 
 	/** Create a buffer to calculate the checksum into */
 	D_ALLOC(csum_buf, csum_len);
+	if (csum_buf == NULL)
+		return -DER_NOMEM;
 
 	/**
 	 * loop through each checksum and chunk of the recx based
@@ -516,10 +576,16 @@ sc_verify_obj_value(struct scrub_ctx *ctx, struct bio_iov *biov, daos_handle_t i
 	data_len = iod->iod_type == DAOS_IOD_ARRAY ?
 		   iod->iod_recxs[0].rx_nr * iod->iod_size :
 		   iod->iod_size;
-	/* allocate memory to fetch data into */
-	D_ALLOC(data.iov_buf, data_len);
-	data.iov_buf_len = data_len;
-	data.iov_len = data_len;
+	/* the buffer to fetch data into is kept for the whole tree scrub */
+	if (data_len > ctx->sc_buf_len) {
+		D_FREE(ctx->sc_buf);
+		ctx->sc_buf_len = 0;
+		D_ALLOC_NZ(ctx->sc_buf, data_len);
+		if (ctx->sc_buf == NULL)
+			return -DER_NOMEM;
+		ctx->sc_buf_len = data_len;
+	}
+	d_iov_set(&data, ctx->sc_buf, data_len);
 
 	/* Fetch data */
 	iter = vos_hdl2iter(ih);
@@ -535,10 +601,10 @@ sc_verify_obj_value(struct scrub_ctx *ctx, struct bio_iov *biov, daos_handle_t i
 			 * need to count the number of corrupted records found previously
 			 */
 			d_tm_inc_counter(ctx->sc_metrics.scm_corruption_total, 1);
-		D_GOTO(out, rc = DER_SUCCESS);
+		return DER_SUCCESS;
 	} else if (rc != 0) {
 		D_WARN("Unable to fetch data for scrubber: "DF_RC"\n", DP_RC(rc));
-		D_GOTO(out, rc);
+		return rc;
 	}
 
 	ctx->sc_cur_biov = biov;
@@ -548,9 +614,8 @@ sc_verify_obj_value(struct scrub_ctx *ctx, struct bio_iov *biov, daos_handle_t i
 	ctx->sc_cur_biov = NULL;
 	if (rc != 0)
 		D_ERROR("Error while scrubbing: "DF_RC"\n", DP_RC(rc));
-
-out:
-	D_FREE(data.iov_buf);
+	else
+		sc_batch_done(ctx);
 
 	return rc;
 }
@@ -838,6 +903,10 @@ static void
 sc_pool_stop(struct scrub_ctx *ctx)
 {
 	sc_m_pool_stop(ctx);
+	D_FREE(ctx->sc_buf);
+	ctx->sc_buf_len = 0;
+	ctx->sc_batch_bytes = 0;
+	ctx->sc_batch_csums = 0;
 	ctx->sc_status = SCRUB_STATUS_NOT_RUNNING;
 }
 
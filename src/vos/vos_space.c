@@ -201,11 +201,12 @@ estimate_space_key(struct umem_instance *umm, daos_key_t *key)
 /*
  * Estimate how much space will be consumed by an update request. This
  * conservative estimation always assumes new object, dkey, akey will be
- * created for the update.
+ * created for the update. The small extents of hot objects are accounted
+ * on SCM, as they're placed by vos_tier_scm().
  */
 static void
 estimate_space(struct vos_pool *pool, daos_key_t *dkey, unsigned int iod_nr,
-	       daos_iod_t *iods, struct dcs_iod_csums *iods_csums,
+	       daos_iod_t *iods, struct dcs_iod_csums *iods_csums, bool hot,
 	       daos_size_t *space_est)
 {
 	struct umem_instance	*umm = vos_pool2umm(pool);
@@ -235,7 +236,7 @@ estimate_space(struct vos_pool *pool, daos_key_t *dkey, unsigned int iod_nr,
 			size = iod->iod_size;
 
 			/* Single value record */
-			if (vos_io_scm(pool, iod->iod_type, size, VOS_IOS_GENERIC)) {
+			if (vos_tier_scm(pool, hot, iod->iod_type, size, VOS_IOS_GENERIC)) {
 				/** store data on DAOS_MEDIA_SCM */
 				scm += vos_recx2irec_size(size, csums);
 			} else {
@@ -256,7 +257,7 @@ estimate_space(struct vos_pool *pool, daos_key_t *dkey, unsigned int iod_nr,
 			size = recx->rx_nr * iod->iod_size;
 
 			/* Extent */
-			if (vos_io_scm(pool, iod->iod_type, size, VOS_IOS_GENERIC))
+			if (vos_tier_scm(pool, hot, iod->iod_type, size, VOS_IOS_GENERIC))
 				/** store data on DAOS_MEDIA_SCM */
 				scm += size;
 			else if (size != 0)
@@ -274,13 +275,34 @@ estimate_space(struct vos_pool *pool, daos_key_t *dkey, unsigned int iod_nr,
 	space_est[DAOS_MEDIA_NVME] = nvme * VOS_BLK_SZ;
 }
 
+daos_size_t
+vos_space_tier_room(struct vos_pool *pool, struct vos_pool_space *vps)
+{
+	daos_size_t	used, reserved;
+
+	if (pool->vp_tier_budget == 0)
+		return 0;
+
+	used = SCM_TOTAL(vps) - SCM_FREE(vps);
+	if (used >= pool->vp_tier_budget)
+		return 0;
+
+	/* Never eat into the system, held and rebuild reserved SCM space */
+	reserved = SCM_SYS(vps) + POOL_SCM_HELD(pool) + SCM_TOTAL(vps) * pool->vp_space_rb / 100;
+	if (SCM_FREE(vps) <= reserved)
+		return 0;
+
+	return min(pool->vp_tier_budget - used, SCM_FREE(vps) - reserved);
+}
+
 int
 vos_space_hold(struct vos_pool *pool, uint64_t flags, daos_key_t *dkey,
 	       unsigned int iod_nr, daos_iod_t *iods,
-	       struct dcs_iod_csums *iods_csums, daos_size_t *space_hld)
+	       struct dcs_iod_csums *iods_csums, bool *tier_hot, daos_size_t *space_hld)
 {
 	struct vos_pool_space	vps = { 0 };
 	daos_size_t		space_est[DAOS_MEDIA_MAX] = { 0, 0 };
+	daos_size_t		cold_est[DAOS_MEDIA_MAX] = { 0, 0 };
 	daos_size_t		scm_left, nvme_left, rb_reserve;
 	int			rc;
 
@@ -291,7 +313,18 @@ vos_space_hold(struct vos_pool *pool, uint64_t flags, daos_key_t *dkey,
 		return rc;
 	}
 
-	estimate_space(pool, dkey, iod_nr, iods, iods_csums, &space_est[0]);
+	estimate_space(pool, dkey, iod_nr, iods, iods_csums, *tier_hot, &space_est[0]);
+
+	/* Hot data is placed on NVMe as usual once the tiering room is used up */
+	if (*tier_hot) {
+		estimate_space(pool, dkey, iod_nr, iods, iods_csums, false, &cold_est[0]);
+		if (space_est[DAOS_MEDIA_SCM] - cold_est[DAOS_MEDIA_SCM] >
+		    vos_space_tier_room(pool, &vps)) {
+			*tier_hot = false;
+			space_est[DAOS_MEDIA_SCM] = cold_est[DAOS_MEDIA_SCM];
+			space_est[DAOS_MEDIA_NVME] = cold_est[DAOS_MEDIA_NVME];
+		}
+	}
 
 	/* if this is a critical update, skip SCM and NVMe sys/held checks */
 	if (flags & VOS_OF_CRIT)
@@ -0,0 +1,301 @@
+/**
+ * (C) Copyright 2024 Intel Corporation.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause-Patent
+ */
+/**
+ * Hot/cold data placement between SCM and NVMe.
+ *
+ * Each cached object keeps an access heat, bumped by fetch and update and halved every
+ * TIER_HEAT_HALF_LIFE seconds. An object crossing TIER_HEAT_HOT is tracked by its container,
+ * its small extents are then written to SCM even above the pool data threshold, as long as
+ * the SCM used by the pool stays under the tiering budget and out of the SCM reserved for
+ * the system, the in-flight updates and rebuild, see vos_space_tier_room(). The tracked
+ * entry mirrors the heat of the object, so that updates and aggregation, which don't all
+ * hold the object, agree on whether it's still hot. Aggregation revisits the tracked
+ * objects whether they were written or not, promotes their NVMe extents while they are hot
+ * and demotes them once they cooled down, see need_merge() and reserve_segment(). Objects
+ * not accessed for TIER_COLD_AGE are untracked, their heat can't be above 1 by then.
+ *
+ * vos/vos_tier.c
+ */
+#define D_LOGFAC	DD_FAC(vos)
+
+#include <daos/common.h>
+#include "vos_internal.h"
+#include "vos_obj.h"
+
+/** Percentage of SCM which hot data may use, 0 disables tiering */
+unsigned int vos_tier_scm_pct;
+
+/** Seconds for the heat of an object to halve */
+#define TIER_HEAT_HALF_LIFE	8
+/** Heat for an object to be tracked, it's hot until the heat drops under half of that */
+#define TIER_HEAT_HOT		64
+#define TIER_HEAT_MAX		(1U << 10)
+/** Seconds without access for an object to be untracked */
+#define TIER_COLD_AGE		(TIER_HEAT_HALF_LIFE * 10)
+/** Extents larger than this are left on NVMe, whatever the heat */
+#define TIER_SIZE_MAX		(64UL << 10)
+/** Minimal seconds interval for refreshing the SCM room of aggregation */
+#define TIER_ROOM_INTV		1
+
+static inline struct vos_tier_metrics *
+tier_pool2metrics(struct vos_pool *pool)
+{
+	if (pool->vp_metrics == NULL)
+		return NULL;
+
+	return &pool->vp_metrics->vp_tier_metrics;
+}
+
+static inline uint32_t
+tier_heat_at(uint32_t heat, uint64_t heat_ts, uint64_t now)
+{
+	uint64_t	periods = (now - heat_ts) / TIER_HEAT_HALF_LIFE;
+
+	return periods >= 32 ? 0 : heat >> periods;
+}
+
+static uint32_t
+tier_heat_decay(struct vos_object *obj, uint64_t now)
+{
+	if ((now - obj->obj_heat_ts) / TIER_HEAT_HALF_LIFE != 0) {
+		obj->obj_heat = tier_heat_at(obj->obj_heat, obj->obj_heat_ts, now);
+		obj->obj_heat_ts = now;
+	}
+
+	return obj->obj_heat;
+}
+
+static int
+tier_oid_find(struct vos_container *cont, daos_unit_oid_t oid)
+{
+	int	i;
+
+	for (i = 0; i < cont->vc_tier_nr; i++) {
+		if (daos_unit_oid_compare(cont->vc_tier_objs[i].vto_oid, oid) == 0)
+			return i;
+	}
+
+	return -1;
+}
+
+static void
+tier_track(struct vos_container *cont, daos_unit_oid_t oid, uint32_t heat, uint64_t now)
+{
+	struct vos_tier_metrics	*vtm = tier_pool2metrics(cont->vc_pool);
+
+	if (cont->vc_tier_nr == VOS_TIER_OIDS_MAX)
+		return;
+
+	D_DEBUG(DB_TRACE, "Track hot object "DF_UOID"\n", DP_UOID(oid));
+	cont->vc_tier_objs[cont->vc_tier_nr].vto_oid = oid;
+	cont->vc_tier_objs[cont->vc_tier_nr].vto_access = now;
+	cont->vc_tier_objs[cont->vc_tier_nr].vto_heat = heat;
+	cont->vc_tier_nr++;
+	if (vtm != NULL)
+		d_tm_inc_gauge(vtm->vtm_hot_objs, 1);
+}
+
+static void
+tier_untrack(struct vos_container *cont, int i)
+{
+	struct vos_tier_metrics	*vtm = tier_pool2metrics(cont->vc_pool);
+
+	D_DEBUG(DB_TRACE, "Untrack cold object "DF_UOID"\n",
+		DP_UOID(cont->vc_tier_objs[i].vto_oid));
+	cont->vc_tier_objs[i] = cont->vc_tier_objs[--cont->vc_tier_nr];
+	if (vtm != NULL)
+		d_tm_dec_gauge(vtm->vtm_hot_objs, 1);
+}
+
+bool
+vos_tier_hot(struct vos_container *cont, daos_unit_oid_t oid)
+{
+	struct vos_tier_obj	*vto;
+	int			 i;
+
+	if (cont->vc_tier_nr == 0)
+		return false;
+
+	i = tier_oid_find(cont, oid);
+	if (i < 0)
+		return false;
+
+	vto = &cont->vc_tier_objs[i];
+	return tier_heat_at(vto->vto_heat, vto->vto_access, daos_gettime_coarse()) >=
+	       TIER_HEAT_HOT / 2;
+}
+
+bool
+vos_tier_agg_visit(struct vos_container *cont, daos_unit_oid_t oid, bool last_pass)
+{
+	int	i;
+
+	if (cont->vc_tier_nr == 0)
+		return false;
+
+	i = tier_oid_find(cont, oid);
+	if (i < 0)
+		return false;
+
+	/** Still visited, to demote what the previous passes didn't */
+	if (last_pass && daos_gettime_coarse() - cont->vc_tier_objs[i].vto_access > TIER_COLD_AGE)
+		tier_untrack(cont, i);
+
+	return true;
+}
+
+void
+vos_tier_cont_fini(struct vos_container *cont)
+{
+	struct vos_tier_metrics	*vtm = tier_pool2metrics(cont->vc_pool);
+
+	if (vtm != NULL && cont->vc_tier_nr != 0)
+		d_tm_dec_gauge(vtm->vtm_hot_objs, cont->vc_tier_nr);
+	cont->vc_tier_nr = 0;
+}
+
+void
+vos_tier_obj_access(struct vos_object *obj)
+{
+	struct vos_container	*cont = obj->obj_cont;
+	uint64_t		 now;
+	uint32_t		 heat;
+	int			 i;
+
+	if (cont->vc_pool->vp_tier_budget == 0)
+		return;
+
+	now = daos_gettime_coarse();
+	heat = tier_heat_decay(obj, now);
+	if (heat < TIER_HEAT_MAX)
+		obj->obj_heat = ++heat;
+
+	/** Mirror the heat, for the updates which don't hold the object */
+	i = cont->vc_tier_nr == 0 ? -1 : tier_oid_find(cont, obj->obj_id);
+	if (i >= 0) {
+		cont->vc_tier_objs[i].vto_access = now;
+		cont->vc_tier_objs[i].vto_heat = heat;
+	} else if (heat >= TIER_HEAT_HOT) {
+		tier_track(cont, obj->obj_id, heat, now);
+	}
+}
+
+bool
+vos_tier_scm(struct vos_pool *pool, bool hot, daos_iod_type_t type, daos_size_t size,
+	     enum vos_io_stream ios)
+{
+	if (vos_io_scm(pool, type, size, ios))
+		return true;
+
+	return hot && size <= TIER_SIZE_MAX && pool->vp_tier_budget != 0;
+}
+
+static daos_size_t
+tier_agg_room(struct vos_pool *pool)
+{
+	struct vos_pool_space	vps = { 0 };
+	uint64_t		now = daos_gettime_coarse();
+	int			rc;
+
+	if (now - pool->vp_tier_room_ts < TIER_ROOM_INTV)
+		return pool->vp_tier_room;
+
+	rc = vos_space_query(pool, &vps, false);
+	if (rc) {
+		/** Stop promoting until the next successful query */
+		D_WARN("Query pool:"DF_UUID" space failed. "DF_RC"\n",
+		       DP_UUID(pool->vp_id), DP_RC(rc));
+		pool->vp_tier_room = 0;
+	} else {
+		pool->vp_tier_room = vos_space_tier_room(pool, &vps);
+	}
+	pool->vp_tier_room_ts = now;
+
+	return pool->vp_tier_room;
+}
+
+bool
+vos_tier_agg_scm(struct vos_object *obj, daos_size_t size)
+{
+	struct vos_pool	*pool = vos_obj2pool(obj);
+
+	if (vos_io_scm(pool, DAOS_IOD_ARRAY, size, VOS_IOS_AGGREGATION))
+		return true;
+
+	if (size > TIER_SIZE_MAX || !vos_tier_hot(obj->obj_cont, obj->obj_id))
+		return false;
+
+	return tier_agg_room(pool) >= size;
+}
+
+void
+vos_tier_fetch_hit(struct vos_pool *pool, bio_addr_t *addr)
+{
+	struct vos_tier_metrics	*vtm = tier_pool2metrics(pool);
+
+	if (vtm == NULL || bio_addr_is_hole(addr))
+		return;
+
+	if (addr->ba_type == DAOS_MEDIA_SCM)
+		d_tm_inc_counter(vtm->vtm_scm_hits, 1);
+	else
+		d_tm_inc_counter(vtm->vtm_nvme_hits, 1);
+}
+
+void
+vos_tier_moved(struct vos_pool *pool, daos_size_t promoted, daos_size_t demoted)
+{
+	struct vos_tier_metrics	*vtm = tier_pool2metrics(pool);
+
+	/** Until the next refresh, the room of aggregation shrinks by what it promoted */
+	pool->vp_tier_room -= min(promoted, pool->vp_tier_room);
+
+	if (vtm == NULL)
+		return;
+
+	if (promoted != 0)
+		d_tm_inc_counter(vtm->vtm_promoted, promoted);
+	if (demoted != 0)
+		d_tm_inc_counter(vtm->vtm_demoted, demoted);
+}
+
+#define TIER_TELEMETRY_DIR	"vos_tier"
+
+void
+vos_tier_metrics_init(struct vos_tier_metrics *vt_metrics, const char *path, int tgt_id)
+{
+	int	rc;
+
+	rc = d_tm_add_metric(&vt_metrics->vtm_scm_hits, D_TM_COUNTER,
+			     "Number of fetched extents read from SCM", NULL,
+			     "%s/%s/scm_hits/tgt_%d", path, TIER_TELEMETRY_DIR, tgt_id);
+	if (rc)
+		D_WARN("failed to create tier scm_hits metric: "DF_RC"\n", DP_RC(rc));
+
+	rc = d_tm_add_metric(&vt_metrics->vtm_nvme_hits, D_TM_COUNTER,
+			     "Number of fetched extents read from NVMe", NULL,
+			     "%s/%s/nvme_hits/tgt_%d", path, TIER_TELEMETRY_DIR, tgt_id);
+	if (rc)
+		D_WARN("failed to create tier nvme_hits metric: "DF_RC"\n", DP_RC(rc));
+
+	rc = d_tm_add_metric(&vt_metrics->vtm_promoted, D_TM_COUNTER,
+			     "Data moved from NVMe to SCM by aggregation", "bytes",
+			     "%s/%s/promoted/tgt_%d", path, TIER_TELEMETRY_DIR, tgt_id);
+	if (rc)
+		D_WARN("failed to create tier promoted metric: "DF_RC"\n", DP_RC(rc));
+
+	rc = d_tm_add_metric(&vt_metrics->vtm_demoted, D_TM_COUNTER,
+			     "Data moved from SCM to NVMe by aggregation", "bytes",
+			     "%s/%s/demoted/tgt_%d", path, TIER_TELEMETRY_DIR, tgt_id);
+	if (rc)
+		D_WARN("failed to create tier demoted metric: "DF_RC"\n", DP_RC(rc));
+
+	rc = d_tm_add_metric(&vt_metrics->vtm_hot_objs, D_TM_GAUGE,
+			     "Number of objects tracked as hot", "objs",
+			     "%s/%s/hot_objs/tgt_%d", path, TIER_TELEMETRY_DIR, tgt_id);
+	if (rc)
+		D_WARN("failed to create tier hot_objs metric: "DF_RC"\n", DP_RC(rc));
+}
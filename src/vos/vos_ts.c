@@ -29,6 +29,17 @@ static const uint32_t type_counts[] = {
 #define DKEY_MISS_SIZE (1 << 16)
 #define AKEY_MISS_SIZE (1 << 16)
 
+/** Budget for the timestamp cache of a target, 0 is the default size of all the types */
+unsigned int vos_ts_cache_mb;
+
+/** A type may shrink or grow by this factor from its default size */
+#define TS_RESIZE_FACTOR	8
+/** Minimum time between two resizes (ms) */
+#define TS_RESIZE_INTVL		1000
+
+/** Memory footprint of a timestamp LRU entry */
+#define TS_ENTRY_SIZE	(sizeof(struct lru_entry) + ((sizeof(struct vos_ts_entry) + 7) & ~7))
+
 #define TS_TRACE(action, entry, idx, type)				\
 	D_DEBUG(DB_TRACE, "%s %s at idx %d(%p), read.hi="DF_U64		\
 		" read.lo="DF_U64"\n", action, type_strs[type], idx,	\
@@ -152,14 +163,22 @@ vos_ts_table_alloc(struct vos_ts_table **ts_tablep, struct vos_tls *tls)
 
 	ts_table->tt_ts_rl = vos_start_epoch;
 	ts_table->tt_ts_rh = vos_start_epoch;
-	uuid_clear(ts_table->tt_tx_rl.dti_uuid);
-	uuid_clear(ts_table->tt_tx_rh.dti_uuid);
+	ts_table->tt_resize_time = daos_getmtime_coarse();
 	miss_cursor = ts_table->tt_misses;
 	for (i = 0; i < VOS_TS_TYPE_COUNT; i++) {
 		info = &ts_table->tt_type_info[i];
 
 		info->ti_type = i;
 		info->ti_count = type_counts[i];
+		ts_table->tt_budget += (uint64_t)type_counts[i] * TS_ENTRY_SIZE;
+		/** The container cache is small and its evictions update the global timestamps */
+		if (i == VOS_TS_TYPE_CONT) {
+			info->ti_min_count = info->ti_count;
+			info->ti_max_count = info->ti_count;
+		} else {
+			info->ti_min_count = info->ti_count / TS_RESIZE_FACTOR;
+			info->ti_max_count = info->ti_count * TS_RESIZE_FACTOR;
+		}
 		info->ti_table = ts_table;
 		info->ti_tls = tls;
 		switch (i) {
@@ -207,6 +226,9 @@ vos_ts_table_alloc(struct vos_ts_table **ts_tablep, struct vos_tls *tls)
 			goto cleanup;
 	}
 
+	if (vos_ts_cache_mb != 0)
+		ts_table->tt_budget = (uint64_t)vos_ts_cache_mb << 20;
+
 	*ts_tablep = ts_table;
 
 	return 0;
@@ -253,6 +275,11 @@ vos_ts_evict_lru(struct vos_ts_table *ts_table, struct vos_ts_entry **entryp,
 	struct vos_ts_info	*info = &ts_table->tt_type_info[type];
 	int			 rc;
 
+	if (lrua_array_full(info->ti_array)) {
+		info->ti_evictions++;
+		d_tm_inc_counter(info->ti_evict_cnt, 1);
+	}
+
 	rc = lrua_alloc(ts_table->tt_type_info[type].ti_array, idx, &entry);
 	D_ASSERT(rc == 0); /** autoeviction and no allocation */
 
@@ -295,6 +322,7 @@ vos_ts_set_allocate(struct vos_ts_set **ts_set, uint64_t flags,
 		    const struct dtx_handle *dth, bool standalone)
 {
 	const struct dtx_id	*tx_id = NULL;
+	struct vos_ts_table	*ts_table;
 	uint32_t		 size;
 	uint64_t		 array_size;
 	uint64_t		 cond_mask = VOS_COND_FETCH_MASK |
@@ -322,11 +350,17 @@ vos_ts_set_allocate(struct vos_ts_set **ts_set, uint64_t flags,
 	(*ts_set)->ts_set_size = size;
 	if (tx_id != NULL) {
 		(*ts_set)->ts_in_tx = true;
-		uuid_copy((*ts_set)->ts_tx_id.dti_uuid, tx_id->dti_uuid);
-		(*ts_set)->ts_tx_id.dti_hlc = tx_id->dti_hlc;
+		vos_ts_tx_set(&(*ts_set)->ts_tx_id, tx_id);
 	} /* ts_in_tx is false by default */
 	vos_ts_set_append_cflags(*ts_set, cflags);
 
+	/** The table is only resized when no set may hold pointers to its entries */
+	ts_table = vos_ts_table_get(standalone);
+	if (ts_table != NULL) {
+		(*ts_set)->ts_table = ts_table;
+		ts_table->tt_sets_nr++;
+	}
+
 	return 0;
 }
 
@@ -365,8 +399,8 @@ vos_ts_set_upgrade(struct vos_ts_set *ts_set)
 }
 
 static inline bool
-vos_ts_check_conflict(daos_epoch_t read_time, const struct dtx_id *read_id,
-		      daos_epoch_t write_time, const struct dtx_id *write_id)
+vos_ts_check_conflict(daos_epoch_t read_time, const struct vos_ts_tx *read_id,
+		      daos_epoch_t write_time, const struct vos_ts_tx *write_id)
 
 {
 	if (write_time > read_time)
@@ -375,10 +409,22 @@ vos_ts_check_conflict(daos_epoch_t read_time, const struct dtx_id *read_id,
 	if (write_time != read_time)
 		return true;
 
-	if (read_id->dti_hlc != write_id->dti_hlc)
-		return true;
+	return read_id->tx_hlc != write_id->tx_hlc || read_id->tx_uuid != write_id->tx_uuid;
+}
+
+/** Conflicts found on a negative entry may come from an unrelated key sharing the entry or from
+ *  an evicted one, count them to tell whether the cache is too small.
+ */
+static inline bool
+vos_ts_check_neg_conflict(struct vos_ts_entry *neg, daos_epoch_t read_time,
+			  const struct vos_ts_tx *read_id, daos_epoch_t write_time,
+			  const struct vos_ts_tx *write_id)
+{
+	if (!vos_ts_check_conflict(read_time, read_id, write_time, write_id))
+		return false;
 
-	return uuid_compare(read_id->dti_uuid, write_id->dti_uuid) != 0;
+	d_tm_inc_counter(neg->te_info->ti_conflict_cnt, 1);
+	return true;
 }
 
 bool
@@ -415,9 +461,10 @@ vos_ts_check_read_conflict(struct vos_ts_set *ts_set, int idx,
 		if (conflict || entry->te_negative == NULL)
 			return conflict;
 
-		return vos_ts_check_conflict(entry->te_negative->te_ts.tp_ts_rl,
-					     &entry->te_negative->te_ts.tp_tx_rl,
-					     write_time, &ts_set->ts_tx_id);
+		return vos_ts_check_neg_conflict(entry->te_negative,
+						 entry->te_negative->te_ts.tp_ts_rl,
+						 &entry->te_negative->te_ts.tp_tx_rl,
+						 write_time, &ts_set->ts_tx_id);
 	}
 
 	/* check the high time */
@@ -427,7 +474,114 @@ vos_ts_check_read_conflict(struct vos_ts_set *ts_set, int idx,
 	if (conflict || entry->te_negative == NULL)
 		return conflict;
 
-	return vos_ts_check_conflict(entry->te_negative->te_ts.tp_ts_rh,
-				     &entry->te_negative->te_ts.tp_tx_rh, write_time,
-				     &ts_set->ts_tx_id);
+	return vos_ts_check_neg_conflict(entry->te_negative, entry->te_negative->te_ts.tp_ts_rh,
+					 &entry->te_negative->te_ts.tp_tx_rh, write_time,
+					 &ts_set->ts_tx_id);
+}
+
+static int
+ts_resize_one(struct vos_ts_table *ts_table, struct vos_ts_info *info, uint32_t count,
+	      uint64_t *used)
+{
+	int	rc;
+
+	rc = lrua_array_resize(info->ti_array, count);
+	if (rc != 0)
+		return rc;
+
+	D_DEBUG(DB_TRACE, "Resized %s timestamp cache from %u to %u entries, "DF_U64
+		" evictions\n", type_strs[info->ti_type], info->ti_count, count,
+		info->ti_evictions);
+	*used = *used - (uint64_t)info->ti_count * TS_ENTRY_SIZE + (uint64_t)count * TS_ENTRY_SIZE;
+	info->ti_count = count;
+	d_tm_set_gauge(info->ti_size, count);
+	return 0;
+}
+
+/*
+ * A type is grown when more than a quarter of its entries were evicted to make room since the
+ * last resize.  Types which had no eviction give their memory back when the budget is exhausted.
+ * Shrinking moves the timestamps of the evicted entries to the negative entries, as any
+ * eviction does, so it is never unsafe, only less precise.
+ */
+void
+vos_ts_table_resize(struct vos_ts_table *ts_table)
+{
+	struct vos_ts_info	*info;
+	struct vos_ts_info	*idle;
+	uint64_t		 now;
+	uint64_t		 used = 0;
+	int			 i;
+	int			 j;
+
+	D_ASSERT(ts_table->tt_sets_nr == 0);
+
+	now = daos_getmtime_coarse();
+	if (now - ts_table->tt_resize_time < TS_RESIZE_INTVL)
+		return;
+	ts_table->tt_resize_time = now;
+
+	for (i = 0; i < VOS_TS_TYPE_COUNT; i++)
+		used += (uint64_t)ts_table->tt_type_info[i].ti_count * TS_ENTRY_SIZE;
+
+	for (i = VOS_TS_TYPE_COUNT - 1; i >= 0; i--) {
+		info = &ts_table->tt_type_info[i];
+		if (info->ti_evictions <= info->ti_count / 4 || info->ti_count >= info->ti_max_count)
+			continue;
+
+		while (used + (uint64_t)info->ti_count * TS_ENTRY_SIZE > ts_table->tt_budget) {
+			idle = NULL;
+			for (j = 0; j < VOS_TS_TYPE_COUNT; j++) {
+				if (j == i || ts_table->tt_type_info[j].ti_evictions != 0 ||
+				    ts_table->tt_type_info[j].ti_count <=
+				    ts_table->tt_type_info[j].ti_min_count)
+					continue;
+				if (idle == NULL || ts_table->tt_type_info[j].ti_count > idle->ti_count)
+					idle = &ts_table->tt_type_info[j];
+			}
+			if (idle == NULL ||
+			    ts_resize_one(ts_table, idle, idle->ti_count / 2, &used) != 0)
+				break;
+		}
+
+		if (used + (uint64_t)info->ti_count * TS_ENTRY_SIZE <= ts_table->tt_budget)
+			ts_resize_one(ts_table, info, info->ti_count * 2, &used);
+	}
+
+	for (i = 0; i < VOS_TS_TYPE_COUNT; i++)
+		ts_table->tt_type_info[i].ti_evictions = 0;
+}
+
+#define TS_TELEMETRY_DIR	"io/ts"
+
+void
+vos_ts_metrics_init(struct vos_ts_table *ts_table, int tgt_id)
+{
+	struct vos_ts_info	*info;
+	int			 i;
+	int			 rc;
+
+	for (i = 0; i < VOS_TS_TYPE_COUNT; i++) {
+		info = &ts_table->tt_type_info[i];
+
+		rc = d_tm_add_metric(&info->ti_evict_cnt, D_TM_COUNTER,
+				     "Number of timestamp entries evicted to make room", NULL,
+				     "%s/%s/evictions/tgt_%d", TS_TELEMETRY_DIR, type_strs[i], tgt_id);
+		if (rc)
+			D_WARN("failed to create ts evictions metric: "DF_RC"\n", DP_RC(rc));
+
+		rc = d_tm_add_metric(&info->ti_conflict_cnt, D_TM_COUNTER,
+				     "Number of write conflicts raised by a negative entry", NULL,
+				     "%s/%s/neg_conflicts/tgt_%d", TS_TELEMETRY_DIR, type_strs[i],
+				     tgt_id);
+		if (rc)
+			D_WARN("failed to create ts conflicts metric: "DF_RC"\n", DP_RC(rc));
+
+		rc = d_tm_add_metric(&info->ti_size, D_TM_GAUGE,
+				     "Number of timestamp entries", "entries",
+				     "%s/%s/size/tgt_%d", TS_TELEMETRY_DIR, type_strs[i], tgt_id);
+		if (rc)
+			D_WARN("failed to create ts size metric: "DF_RC"\n", DP_RC(rc));
+		d_tm_set_gauge(info->ti_size, info->ti_count);
+	}
 }
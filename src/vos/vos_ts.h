@@ -29,23 +29,40 @@ struct vos_ts_info {
 	struct vos_ts_entry	*ti_misses;
 	/** TLS for tracking memory usage */
 	struct vos_tls		*ti_tls;
+	/** Number of LRU entries evicted to make room */
+	struct d_tm_node_t	*ti_evict_cnt;
+	/** Number of write conflicts raised by a negative entry */
+	struct d_tm_node_t	*ti_conflict_cnt;
+	/** Current number of entries */
+	struct d_tm_node_t	*ti_size;
+	/** Evictions since the table was last resized */
+	uint64_t		ti_evictions;
 	/** Type identifier */
 	uint32_t		ti_type;
 	/** Mask for negative entry cache */
 	uint32_t		ti_cache_mask;
-	/** Number of entries in cache for type (for testing) */
+	/** Number of entries in cache for type */
 	uint32_t		ti_count;
+	/** Bounds of ti_count when the table is resized */
+	uint32_t		ti_min_count;
+	uint32_t		ti_max_count;
+};
+
+/** Compact identifier of a reading transaction, the HLC and the UUID folded to 64 bits */
+struct vos_ts_tx {
+	uint64_t	tx_hlc;
+	uint64_t	tx_uuid;
 };
 
 struct vos_ts_pair {
 	/** Low read time or read time for the object/key */
-	daos_epoch_t	tp_ts_rl;
+	daos_epoch_t	 tp_ts_rl;
 	/** High read time or read time for the object/key */
-	daos_epoch_t	tp_ts_rh;
+	daos_epoch_t	 tp_ts_rh;
 	/** Low read tx */
-	struct dtx_id	tp_tx_rl;
+	struct vos_ts_tx tp_tx_rl;
 	/** High read tx */
-	struct dtx_id	tp_tx_rh;
+	struct vos_ts_tx tp_tx_rh;
 };
 
 struct vos_wts_cache {
@@ -117,7 +134,9 @@ struct vos_ts_set {
 	/** Max type */
 	uint16_t		 ts_max_type;
 	/** Transaction that owns the set */
-	struct dtx_id		 ts_tx_id;
+	struct vos_ts_tx	 ts_tx_id;
+	/** Table the entries of the set belong to */
+	struct vos_ts_table	*ts_table;
 	/** size of the set */
 	uint32_t		 ts_set_size;
 	/** Number of initialized entries */
@@ -149,11 +168,17 @@ struct vos_ts_table {
 	/** Global write timestamps */
 	struct vos_wts_cache	tt_w_cache;
 	/** Transaction id associated with global read low timestamp */
-	struct dtx_id		tt_tx_rl;
+	struct vos_ts_tx	tt_tx_rl;
 	/** Transaction id associated with global read high timestamp */
-	struct dtx_id		tt_tx_rh;
+	struct vos_ts_tx	tt_tx_rh;
 	/** Negative entry cache */
 	struct vos_ts_entry	*tt_misses;
+	/** Memory budget for the LRU entries of all types */
+	uint64_t		tt_budget;
+	/** Last time the table was resized (ms) */
+	uint64_t		tt_resize_time;
+	/** Number of allocated sets, entries can only move when there is none */
+	uint32_t		tt_sets_nr;
 	/** Timestamp table pointers for a type */
 	struct vos_ts_info	tt_type_info[VOS_TS_TYPE_COUNT];
 };
@@ -639,6 +664,14 @@ vos_ts_table_alloc(struct vos_ts_table **ts_table, struct vos_tls *tls);
 void
 vos_ts_table_free(struct vos_ts_table **ts_table, struct vos_tls *tls);
 
+/** Create the telemetry of the timestamp cache
+ *
+ * \param[in]	ts_table	Thread local table
+ * \param[in]	tgt_id		Target of the xstream
+ */
+void
+vos_ts_metrics_init(struct vos_ts_table *ts_table, int tgt_id);
+
 /** Allocate a timestamp set
  *
  * \param[in,out]	ts_set	Pointer to set
@@ -663,6 +696,30 @@ vos_ts_set_allocate(struct vos_ts_set **ts_set, uint64_t flags,
 void
 vos_ts_set_upgrade(struct vos_ts_set *ts_set);
 
+/** Resize the LRU arrays of the table according to their eviction rate, only done when there
+ *  is no set referencing entries.
+ *
+ * \param[in]	ts_table	The timestamp table
+ */
+void
+vos_ts_table_resize(struct vos_ts_table *ts_table);
+
+/** Internal API: account for a freed timestamp set */
+static inline void
+vos_ts_set_release(struct vos_ts_set *ts_set)
+{
+	struct vos_ts_table	*ts_table;
+
+	if (ts_set == NULL || ts_set->ts_table == NULL)
+		return;
+
+	ts_table = ts_set->ts_table;
+
+	D_ASSERT(ts_table->tt_sets_nr > 0);
+	if (--ts_table->tt_sets_nr == 0)
+		vos_ts_table_resize(ts_table);
+}
+
 /** Free an allocated timestamp set
  *
  * Implemented as a macro to improve logging.
@@ -670,21 +727,36 @@ vos_ts_set_upgrade(struct vos_ts_set *ts_set);
  * \param[in]	ts_set	Set to free
  */
 
-#define vos_ts_set_free(ts_set) D_FREE(ts_set)
+#define vos_ts_set_free(ts_set)			\
+	do {					\
+		vos_ts_set_release(ts_set);	\
+		D_FREE(ts_set);			\
+	} while (0)
+
+/** Internal API to convert a transaction id to its compact form */
+static inline void
+vos_ts_tx_set(struct vos_ts_tx *dest, const struct dtx_id *src)
+{
+	uint64_t	uuid[2];
+
+	memcpy(uuid, src->dti_uuid, sizeof(uuid));
+	dest->tx_hlc  = src->dti_hlc;
+	dest->tx_uuid = uuid[0] ^ uuid[1];
+}
 
 /** Internal API to copy timestamp */
 static inline void
-vos_ts_copy(daos_epoch_t *dest_epc, struct dtx_id *dest_id,
-	    daos_epoch_t src_epc, const struct dtx_id *src_id)
+vos_ts_copy(daos_epoch_t *dest_epc, struct vos_ts_tx *dest_id,
+	    daos_epoch_t src_epc, const struct vos_ts_tx *src_id)
 {
 	*dest_epc = src_epc;
-	daos_dti_copy(dest_id, src_id);
+	*dest_id  = *src_id;
 }
 
 /** Internal API to update low read timestamp and tx id */
 static inline void
 vos_ts_rl_update(struct vos_ts_entry *entry, daos_epoch_t read_time,
-		 const struct dtx_id *tx_id)
+		 const struct vos_ts_tx *tx_id)
 {
 	if (entry == NULL || read_time < entry->te_ts.tp_ts_rl)
 		return;
@@ -696,7 +768,7 @@ vos_ts_rl_update(struct vos_ts_entry *entry, daos_epoch_t read_time,
 /** Internal API to update high read timestamp and tx id */
 static inline void
 vos_ts_rh_update(struct vos_ts_entry *entry, daos_epoch_t read_time,
-		 const struct dtx_id *tx_id)
+		 const struct vos_ts_tx *tx_id)
 {
 	if (entry == NULL || read_time < entry->te_ts.tp_ts_rh)
 		return;